@@ -56,12 +56,18 @@ namespace Nightbird::N3DS
 	{
 		Cleanup();
 
+		if (audio.IsStreamed())
+		{
+			Core::Log::Error("N3DS::AudioBuffer: Streamed audio not supported");
+			return false;
+		}
+
 		m_Channels = audio.GetChannels();
 		m_ChannelBuffers.resize(m_Channels);
 
 		for (uint8_t channel = 0; channel < m_Channels; channel++)
 		{
-			const std::vector<uint8_t>& blob = audio.GetChannelData(channel);
+			const auto& blob = audio.GetChannelData(channel);
 			if (blob.size() < k_DSPHeaderSize)
 			{
 				Core::Log::Error("N3DS::AudioBuffer: Channel blob too small for channel " + std::to_string(channel));
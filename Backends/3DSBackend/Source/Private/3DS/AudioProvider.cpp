@@ -4,6 +4,7 @@
 
 #include <uuid.h>
 
+#include <algorithm>
 #include <cstring>
 
 namespace Nightbird::N3DS
@@ -68,7 +69,7 @@ namespace Nightbird::N3DS
 		}
 	}
 
-	Audio::Handle AudioProvider::Play(const Core::AudioAsset& audio, bool loop)
+	Audio::Handle AudioProvider::Play(const Core::AudioAsset& audio, bool loop, Audio::Priority priority)
 	{
 		if (!m_Initialized)
 			return Audio::InvalidHandle;
@@ -87,6 +88,7 @@ namespace Nightbird::N3DS
 		sound.channelCount = channelCount;
 		sound.looping = loop;
 		sound.playOnce = false;
+		sound.sampleRate = audio.GetSampleRate();
 
 		if (!sound.buffer.Load(audio))
 		{
@@ -104,7 +106,7 @@ namespace Nightbird::N3DS
 		return handle;
 	}
 
-	void AudioProvider::PlayOnce(const Core::AudioAsset& audio)
+	void AudioProvider::PlayOnce(const Core::AudioAsset& audio, Audio::Priority priority)
 	{
 		if (!m_Initialized)
 			return;
@@ -123,6 +125,7 @@ namespace Nightbird::N3DS
 		sound.channelCount = channelCount;
 		sound.looping = false;
 		sound.playOnce = true;
+		sound.sampleRate = audio.GetSampleRate();
 
 		if (!sound.buffer.Load(audio))
 		{
@@ -194,28 +197,34 @@ namespace Nightbird::N3DS
 		{
 			if (sound.handle == handle)
 			{
-				for (uint8_t channel = 0; channel < sound.channelCount; channel++)
-				{
-					float mix[12] = {};
-					if (sound.channelCount == 1)
-					{
-						mix[0] = volume;
-						mix[1] = volume;
-					}
-					else
-					{
-						if (channel == 0)
-							mix[0] = volume; // Front left
-						else
-							mix[1] = volume; // Front right
-					}
-					ndspChnSetMix(sound.startChannel + channel, mix);
-				}
+				sound.volume = volume;
+				SetMix(sound, volume, volume);
 				return;
 			}
 		}
 	}
 
+	void AudioProvider::SetSpatialParams(const Audio::SpatialParams* params, size_t count)
+	{
+		if (!m_Initialized)
+			return;
+
+		for (size_t i = 0; i < count; i++)
+		{
+			for (auto& sound : m_ActiveSounds)
+			{
+				if (sound.handle != params[i].handle)
+					continue;
+
+				// Hard pans reach +3 dB on one side, NDSP doesn't clamp the mix so keep it from clipping
+				SetMix(sound, std::min(sound.volume * params[i].gainLeft, 1.0f), std::min(sound.volume * params[i].gainRight, 1.0f));
+				for (uint8_t channel = 0; channel < sound.channelCount; channel++)
+					ndspChnSetRate(sound.startChannel + channel, sound.sampleRate * params[i].pitch);
+				break;
+			}
+		}
+	}
+
 	bool AudioProvider::IsPlaying(Audio::Handle handle) const
 	{
 		for (const auto& sound : m_ActiveSounds)
@@ -233,6 +242,27 @@ namespace Nightbird::N3DS
 		return false;
 	}
 
+	void AudioProvider::SetMix(const ActiveSound& sound, float left, float right)
+	{
+		for (uint8_t channel = 0; channel < sound.channelCount; channel++)
+		{
+			float mix[12] = {};
+			if (sound.channelCount == 1)
+			{
+				mix[0] = left;
+				mix[1] = right;
+			}
+			else
+			{
+				if (channel == 0)
+					mix[0] = left; // Front left
+				else
+					mix[1] = right; // Front right
+			}
+			ndspChnSetMix(sound.startChannel + channel, mix);
+		}
+	}
+
 	int AudioProvider::FindFreeChannels(uint8_t count) const
 	{
 		for (int i = 0; i <= k_MaxChannels - count; i++)
@@ -21,13 +21,14 @@ namespace Nightbird::N3DS
 		void Shutdown() override;
 		void Update() override;
 
-		Audio::Handle Play(const Core::AudioAsset& audio, bool loop) override;
-		void PlayOnce(const Core::AudioAsset& audio) override;
+		Audio::Handle Play(const Core::AudioAsset& audio, bool loop, Audio::Priority priority) override;
+		void PlayOnce(const Core::AudioAsset& audio, Audio::Priority priority) override;
 		void Stop(Audio::Handle handle) override;
 		void Pause(Audio::Handle handle) override;
 		void Resume(Audio::Handle handle) override;
 
 		void SetVolume(Audio::Handle handle, float volume) override;
+		void SetSpatialParams(const Audio::SpatialParams* params, size_t count) override;
 
 		bool IsPlaying(Audio::Handle handle) const override;
 
@@ -42,6 +43,8 @@ namespace Nightbird::N3DS
 			uint8_t channelCount;
 			bool looping;
 			bool playOnce;
+			uint32_t sampleRate;
+			float volume = 1.0f;
 		};
 
 		std::array<bool, k_MaxChannels> m_ActiveChannels{};
@@ -52,5 +55,6 @@ namespace Nightbird::N3DS
 
 		int FindFreeChannels(uint8_t count) const;
 		void FreeSound(ActiveSound& sound);
+		void SetMix(const ActiveSound& sound, float left, float right);
 	};
 }
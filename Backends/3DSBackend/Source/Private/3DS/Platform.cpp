@@ -58,6 +58,12 @@ namespace Nightbird::N3DS
 		return "sdmc:/Nightbird/Cooked";
 	}
 
+	size_t Platform::GetAssetMemoryBudget() const
+	{
+		// Leaves room in the 64 MB application region for code, linear heap and the scene
+		return 24 * 1024 * 1024;
+	}
+
 	Input::Provider& Platform::GetInputProvider()
 	{
 		return m_InputProvider;
@@ -21,6 +21,7 @@ namespace Nightbird::N3DS
 		virtual void GetFramebufferSize(int* width, int* height) const override;
 
 		virtual std::string GetCookedAssetsPath() const override;
+		virtual size_t GetAssetMemoryBudget() const override;
 
 		Input::Provider& GetInputProvider() override;
 		Audio::Provider& GetAudioProvider() override;
@@ -66,7 +66,7 @@ namespace Nightbird::PICA
 	void Renderer::SubmitScene(const Core::Scene& scene, const Core::Camera& camera)
 	{
 		m_ActiveCamera = &camera;
-		m_Renderables = scene.CollectRenderables();
+		m_Renderables = &scene.GetRenderables();
 	}
 
 	bool Renderer::BeginFrame(Core::RenderSurface& surface)
@@ -92,7 +92,7 @@ namespace Nightbird::PICA
 
 		C3D_FVUnifMtx4x4(GPU_VERTEX_SHADER, m_ULocProjection, &projection);
 
-		for (const auto& renderable : m_Renderables)
+		for (const auto& renderable : *m_Renderables)
 		{
 			Geometry& geometry = GetOrCreateGeometry(renderable.primitive);
 			Material& material = GetOrCreateMaterial(renderable.primitive->GetMaterial().get());
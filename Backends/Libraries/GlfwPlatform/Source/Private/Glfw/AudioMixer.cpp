@@ -0,0 +1,122 @@
+#include "Glfw/AudioMixer.h"
+
+#include <algorithm>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define NB_AUDIO_SSE2 1
+#include <emmintrin.h>
+#endif
+
+namespace Nightbird::Glfw
+{
+	static constexpr float SampleScale = 1.0f / 32768.0f;
+
+	void ConvertToStereo(const int16_t* source, uint32_t channels, uint32_t frameCount, float* destination)
+	{
+		if (channels == 1)
+		{
+			for (uint32_t frame = 0; frame < frameCount; ++frame)
+			{
+				float sample = source[frame] * SampleScale;
+				destination[frame * 2] = sample;
+				destination[frame * 2 + 1] = sample;
+			}
+			return;
+		}
+
+		if (channels == 2)
+		{
+			uint32_t sampleCount = frameCount * 2;
+			uint32_t i = 0;
+
+#if NB_AUDIO_SSE2
+			const __m128 scale = _mm_set1_ps(SampleScale);
+			for (; i + 8 <= sampleCount; i += 8)
+			{
+				__m128i samples = _mm_loadu_si128(reinterpret_cast<const __m128i*>(source + i));
+				// Sign extend by placing each sample in the top half of a 32-bit lane
+				__m128i low = _mm_srai_epi32(_mm_unpacklo_epi16(samples, samples), 16);
+				__m128i high = _mm_srai_epi32(_mm_unpackhi_epi16(samples, samples), 16);
+				_mm_storeu_ps(destination + i, _mm_mul_ps(_mm_cvtepi32_ps(low), scale));
+				_mm_storeu_ps(destination + i + 4, _mm_mul_ps(_mm_cvtepi32_ps(high), scale));
+			}
+#endif
+
+			for (; i < sampleCount; ++i)
+				destination[i] = source[i] * SampleScale;
+			return;
+		}
+
+		for (uint32_t frame = 0; frame < frameCount; ++frame)
+		{
+			destination[frame * 2] = source[frame * channels] * SampleScale;
+			destination[frame * 2 + 1] = source[frame * channels + 1] * SampleScale;
+		}
+	}
+
+	void MixStereo(float* destination, const float* source, uint32_t frameCount, float gainLeft, float gainRight)
+	{
+		uint32_t sampleCount = frameCount * 2;
+		uint32_t i = 0;
+
+#if NB_AUDIO_SSE2
+		const __m128 gain = _mm_setr_ps(gainLeft, gainRight, gainLeft, gainRight);
+		for (; i + 8 <= sampleCount; i += 8)
+		{
+			__m128 mixed0 = _mm_add_ps(_mm_loadu_ps(destination + i), _mm_mul_ps(_mm_loadu_ps(source + i), gain));
+			__m128 mixed1 = _mm_add_ps(_mm_loadu_ps(destination + i + 4), _mm_mul_ps(_mm_loadu_ps(source + i + 4), gain));
+			_mm_storeu_ps(destination + i, mixed0);
+			_mm_storeu_ps(destination + i + 4, mixed1);
+		}
+#endif
+
+		for (; i < sampleCount; i += 2)
+		{
+			destination[i] += source[i] * gainLeft;
+			destination[i + 1] += source[i + 1] * gainRight;
+		}
+	}
+
+	void MixStereoRamp(float* destination, const float* source, uint32_t frameCount, float startLeft, float startRight, float endLeft, float endRight)
+	{
+		if (frameCount == 0)
+			return;
+
+		float stepLeft = (endLeft - startLeft) / frameCount;
+		float stepRight = (endRight - startRight) / frameCount;
+		uint32_t frame = 0;
+
+#if NB_AUDIO_SSE2
+		// Two frames per vector, the gains of frames n and n + 1
+		__m128 gain = _mm_setr_ps(startLeft, startRight, startLeft + stepLeft, startRight + stepRight);
+		const __m128 step = _mm_setr_ps(stepLeft * 2.0f, stepRight * 2.0f, stepLeft * 2.0f, stepRight * 2.0f);
+		for (; frame + 2 <= frameCount; frame += 2)
+		{
+			float* target = destination + frame * 2;
+			_mm_storeu_ps(target, _mm_add_ps(_mm_loadu_ps(target), _mm_mul_ps(_mm_loadu_ps(source + frame * 2), gain)));
+			gain = _mm_add_ps(gain, step);
+		}
+#endif
+
+		for (; frame < frameCount; ++frame)
+		{
+			destination[frame * 2] += source[frame * 2] * (startLeft + stepLeft * frame);
+			destination[frame * 2 + 1] += source[frame * 2 + 1] * (startRight + stepRight * frame);
+		}
+	}
+
+	void ClampSamples(float* destination, const float* source, uint32_t sampleCount)
+	{
+		uint32_t i = 0;
+
+#if NB_AUDIO_SSE2
+		const __m128 minimum = _mm_set1_ps(-1.0f);
+		const __m128 maximum = _mm_set1_ps(1.0f);
+		for (; i + 4 <= sampleCount; i += 4)
+			_mm_storeu_ps(destination + i, _mm_min_ps(_mm_max_ps(_mm_loadu_ps(source + i), minimum), maximum));
+#endif
+
+		for (; i < sampleCount; ++i)
+			destination[i] = std::clamp(source[i], -1.0f, 1.0f);
+	}
+}
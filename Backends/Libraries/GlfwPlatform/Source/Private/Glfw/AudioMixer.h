@@ -0,0 +1,21 @@
+#pragma once
+
+#include <cstdint>
+
+namespace Nightbird::Glfw
+{
+	// Sample kernels of the desktop software mixer. Buffers are interleaved stereo floats,
+	// SSE2 is used where available and every kernel has a scalar fallback.
+
+	// Converts PCM16 frames to stereo, mono is copied to both sides and channels past the second are dropped
+	void ConvertToStereo(const int16_t* source, uint32_t channels, uint32_t frameCount, float* destination);
+
+	// Adds frameCount stereo frames of source scaled by the per-side gains into destination
+	void MixStereo(float* destination, const float* source, uint32_t frameCount, float gainLeft, float gainRight);
+
+	// Like MixStereo with the gains moving linearly from the start gains towards the end gains, reaching them after the last frame
+	void MixStereoRamp(float* destination, const float* source, uint32_t frameCount, float startLeft, float startRight, float endLeft, float endRight);
+
+	// Copies sampleCount samples clamped to [-1, 1]
+	void ClampSamples(float* destination, const float* source, uint32_t sampleCount);
+}
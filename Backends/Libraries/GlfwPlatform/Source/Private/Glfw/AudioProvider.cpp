@@ -1,27 +1,77 @@
 #include "Glfw/AudioProvider.h"
 
+#include "Glfw/AudioMixer.h"
+
 #include "Core/AudioAsset.h"
 #include "Core/Log.h"
 
 #define MINIAUDIO_IMPLEMENTATION
 #include <miniaudio.h>
 
+#include <algorithm>
 #include <cstring>
+#include <string>
 
 namespace Nightbird::Glfw
 {
 	void AudioProvider::Initialize()
 	{
-		ma_engine_config config = ma_engine_config_init();
-		ma_result result = ma_engine_init(&config, &m_AudioEngine);
+		m_Commands = std::make_unique<Core::SPSCQueue<Command>>(CommandCapacity);
+		m_QueuedCommands = 0;
+		m_AppliedCommands.store(0, std::memory_order_relaxed);
+
+		m_Slots.assign(m_VoiceLimit, Slot{});
+		m_ActiveSlots.clear();
+		m_ActiveSlots.reserve(m_VoiceLimit);
+
+		// Reversed so the lowest indices are handed out first
+		m_FreeSlots.clear();
+		m_FreeSlots.reserve(m_VoiceLimit);
+		for (uint32_t index = m_VoiceLimit; index > 0; --index)
+			m_FreeSlots.push_back(index - 1);
+
+		m_FinishedGenerations = std::make_unique<std::atomic<uint32_t>[]>(m_VoiceLimit);
+		m_SpatialStates = std::make_unique<SpatialState[]>(m_VoiceLimit);
+
+		m_Voices.assign(m_VoiceLimit, Voice{});
+		m_ActiveVoices.clear();
+		m_ActiveVoices.reserve(m_VoiceLimit);
+
+		m_MixBuffer.resize(BatchFrames * OutputChannels);
+		m_SourceBuffer.resize((BatchFrames * MaxRateRatio + 2) * OutputChannels);
+		m_VoiceBuffer.resize(BatchFrames * OutputChannels);
+		m_StreamBuffer.resize(BatchFrames * 8);
+
+		ma_device_config config = ma_device_config_init(ma_device_type_playback);
+		config.playback.format = ma_format_f32;
+		config.playback.channels = OutputChannels;
+		config.dataCallback = DataCallback;
+		config.pUserData = this;
+		// Every frame is written and clamped by Mix
+		config.noPreSilencedOutputBuffer = MA_TRUE;
+		config.noClip = MA_TRUE;
+
+		ma_result result = ma_device_init(nullptr, &config, &m_Device);
 		if (result != MA_SUCCESS)
 		{
-			Core::Log::Error("AudioProvider: Failed to initialize miniaudio engine");
+			Core::Log::Error("AudioProvider: Failed to initialize miniaudio device");
+			return;
+		}
+		m_SampleRate = m_Device.sampleRate;
+
+		m_Streamer.Start();
+
+		result = ma_device_start(&m_Device);
+		if (result != MA_SUCCESS)
+		{
+			Core::Log::Error("AudioProvider: Failed to start miniaudio device");
+			m_Streamer.Stop();
+			ma_device_uninit(&m_Device);
 			return;
 		}
 
 		m_Initialized = true;
-		Core::Log::Info("AudioProvider: Initialized");
+		Core::Log::Info("AudioProvider: Initialized with " + std::to_string(m_VoiceLimit) + " voices at " + std::to_string(m_SampleRate) + " Hz");
 	}
 
 	void AudioProvider::Shutdown()
@@ -29,11 +79,19 @@ namespace Nightbird::Glfw
 		if (!m_Initialized)
 			return;
 
-		for (auto& sound : m_ActiveSounds)
-			DestroySound(*sound);
+		// Stops the device thread, nothing reads the voices or commands after this
+		ma_device_uninit(&m_Device);
+		m_Streamer.Stop();
+
+		m_Slots.clear();
+		m_FreeSlots.clear();
+		m_ActiveSlots.clear();
+		m_RetiredStreams.clear();
+		m_OverflowCommands.clear();
+		m_Commands.reset();
+		m_Voices.clear();
+		m_ActiveVoices.clear();
 
-		m_ActiveSounds.clear();
-		ma_engine_uninit(&m_AudioEngine);
 		m_Initialized = false;
 	}
 
@@ -42,25 +100,47 @@ namespace Nightbird::Glfw
 		if (!m_Initialized)
 			return;
 
-		for (int i = static_cast<int>(m_ActiveSounds.size()) - 1; i >= 0; i--)
+		size_t pushed = 0;
+		while (pushed < m_OverflowCommands.size() && m_Commands->Push(m_OverflowCommands[pushed]))
+			++pushed;
+		m_OverflowCommands.erase(m_OverflowCommands.begin(), m_OverflowCommands.begin() + pushed);
+
+		// Backwards so releasing swaps in a slot that was already visited
+		for (size_t i = m_ActiveSlots.size(); i > 0; --i)
 		{
-			auto& sound = m_ActiveSounds[i];
-			if (sound->playOnce && !ma_sound_is_playing(&sound->sound))
+			uint32_t index = m_ActiveSlots[i - 1];
+			Slot& slot = m_Slots[index];
+
+			// The device thread already dropped the voice
+			if (IsFinished(index))
 			{
-				DestroySound(*sound);
-				m_ActiveSounds.erase(m_ActiveSounds.begin() + i);
+				ReleaseSlot(index, false);
+				continue;
+			}
+
+			if (slot.stream)
+			{
+				uint32_t underruns = slot.stream->GetUnderrunCount();
+				if (underruns != slot.reportedUnderruns)
+				{
+					Core::Log::Warning("AudioProvider: Audio stream ran dry " + std::to_string(underruns - slot.reportedUnderruns) + " times");
+					slot.reportedUnderruns = underruns;
+				}
 			}
 		}
+
+		uint64_t applied = m_AppliedCommands.load(std::memory_order_acquire);
+		std::erase_if(m_RetiredStreams, [applied](const RetiredStream& retired) { return retired.sequence <= applied; });
 	}
 
-	Audio::Handle AudioProvider::Play(const Core::AudioAsset& audio, bool loop)
+	Audio::Handle AudioProvider::Play(const Core::AudioAsset& audio, bool loop, Audio::Priority priority)
 	{
-		return StartSound(audio, loop, false);
+		return StartVoice(audio, loop, priority);
 	}
 
-	void AudioProvider::PlayOnce(const Core::AudioAsset& audio)
+	void AudioProvider::PlayOnce(const Core::AudioAsset& audio, Audio::Priority priority)
 	{
-		StartSound(audio, false, true);
+		StartVoice(audio, false, priority);
 	}
 
 	void AudioProvider::Stop(Audio::Handle handle)
@@ -68,19 +148,8 @@ namespace Nightbird::Glfw
 		if (!m_Initialized)
 			return;
 
-		ActiveSound* sound = FindSound(handle);
-		if (!sound)
-			return;
-
-		DestroySound(*sound);
-		for (auto it = m_ActiveSounds.begin(); it != m_ActiveSounds.end(); ++it)
-		{
-			if ((*it)->handle == handle)
-			{
-				m_ActiveSounds.erase(it);
-				break;
-			}
-		}
+		if (FindSlot(handle))
+			ReleaseSlot(handle & IndexMask, true);
 	}
 
 	void AudioProvider::Pause(Audio::Handle handle)
@@ -88,9 +157,17 @@ namespace Nightbird::Glfw
 		if (!m_Initialized)
 			return;
 
-		ActiveSound* sound = FindSound(handle);
-		if (sound)
-			ma_sound_stop(&sound->sound);
+		Slot* slot = FindSlot(handle);
+		if (!slot || slot->state != SlotState::Playing)
+			return;
+
+		slot->state = SlotState::Paused;
+
+		Command command;
+		command.type = CommandType::Pause;
+		command.index = handle & IndexMask;
+		command.generation = slot->generation;
+		QueueCommand(command);
 	}
 
 	void AudioProvider::Resume(Audio::Handle handle)
@@ -98,9 +175,17 @@ namespace Nightbird::Glfw
 		if (!m_Initialized)
 			return;
 
-		ActiveSound* sound = FindSound(handle);
-		if (sound)
-			ma_sound_start(&sound->sound);
+		Slot* slot = FindSlot(handle);
+		if (!slot || slot->state != SlotState::Paused)
+			return;
+
+		slot->state = SlotState::Playing;
+
+		Command command;
+		command.type = CommandType::Resume;
+		command.index = handle & IndexMask;
+		command.generation = slot->generation;
+		QueueCommand(command);
 	}
 
 	void AudioProvider::SetVolume(Audio::Handle handle, float volume)
@@ -108,9 +193,33 @@ namespace Nightbird::Glfw
 		if (!m_Initialized)
 			return;
 
-		ActiveSound* sound = FindSound(handle);
-		if (sound)
-			ma_sound_set_volume(&sound->sound, volume);
+		Slot* slot = FindSlot(handle);
+		if (!slot)
+			return;
+
+		Command command;
+		command.type = CommandType::SetVolume;
+		command.index = handle & IndexMask;
+		command.generation = slot->generation;
+		command.volume = volume;
+		QueueCommand(command);
+	}
+
+	void AudioProvider::SetSpatialParams(const Audio::SpatialParams* params, size_t count)
+	{
+		if (!m_Initialized)
+			return;
+
+		for (size_t i = 0; i < count; ++i)
+		{
+			if (!FindSlot(params[i].handle))
+				continue;
+
+			SpatialState& state = m_SpatialStates[params[i].handle & IndexMask];
+			state.gainLeft.store(params[i].gainLeft, std::memory_order_relaxed);
+			state.gainRight.store(params[i].gainRight, std::memory_order_relaxed);
+			state.pitch.store(params[i].pitch, std::memory_order_relaxed);
+		}
 	}
 
 	bool AudioProvider::IsPlaying(Audio::Handle handle) const
@@ -118,14 +227,225 @@ namespace Nightbird::Glfw
 		if (!m_Initialized)
 			return false;
 
-		const ActiveSound* sound = FindSound(handle);
-		if (!sound)
-			return false;
+		const Slot* slot = FindSlot(handle);
+		return slot && slot->state == SlotState::Playing && !IsFinished(handle & IndexMask);
+	}
+
+	void AudioProvider::SetVoiceLimit(uint32_t voiceLimit)
+	{
+		m_VoiceLimit = std::clamp<uint32_t>(voiceLimit, 1, MaxVoiceLimit);
+	}
+
+	uint32_t AudioProvider::GetVoiceLimit() const
+	{
+		return m_VoiceLimit;
+	}
 
-		return ma_sound_is_playing(&sound->sound);
+	void AudioProvider::DataCallback(ma_device* device, void* output, const void* input, ma_uint32 frameCount)
+	{
+		static_cast<AudioProvider*>(device->pUserData)->Mix(static_cast<float*>(output), frameCount);
+	}
+
+	void AudioProvider::Mix(float* output, uint32_t frameCount)
+	{
+		Command command;
+		uint64_t applied = 0;
+		while (m_Commands->Pop(command))
+		{
+			ApplyCommand(command);
+			++applied;
+		}
+
+		// Only this thread writes the count, the game thread reads it to free retired streams
+		if (applied > 0)
+			m_AppliedCommands.store(m_AppliedCommands.load(std::memory_order_relaxed) + applied, std::memory_order_release);
+
+		for (uint32_t done = 0; done < frameCount; done += BatchFrames)
+		{
+			uint32_t count = std::min(frameCount - done, BatchFrames);
+			std::fill_n(m_MixBuffer.data(), count * OutputChannels, 0.0f);
+
+			// Backwards so deactivating swaps in a voice that was already mixed
+			for (size_t i = m_ActiveVoices.size(); i > 0; --i)
+			{
+				uint32_t index = m_ActiveVoices[i - 1];
+				Voice& voice = m_Voices[index];
+				if (voice.paused)
+					continue;
+
+				// Streams start once their first chunks have been read
+				if (voice.stream && !voice.stream->IsReady())
+					continue;
+
+				const SpatialState& state = m_SpatialStates[index];
+				voice.pitch = state.pitch.load(std::memory_order_relaxed);
+
+				const float* frames = RenderVoice(voice, count);
+				if (!frames)
+				{
+					DeactivateVoice(index);
+					m_FinishedGenerations[index].store(voice.generation, std::memory_order_release);
+					continue;
+				}
+
+				float gainLeft = voice.volume * state.gainLeft.load(std::memory_order_relaxed);
+				float gainRight = voice.volume * state.gainRight.load(std::memory_order_relaxed);
+				if (!voice.hasGains || (gainLeft == voice.gainLeft && gainRight == voice.gainRight))
+					MixStereo(m_MixBuffer.data(), frames, count, gainLeft, gainRight);
+				else
+					MixStereoRamp(m_MixBuffer.data(), frames, count, voice.gainLeft, voice.gainRight, gainLeft, gainRight);
+
+				voice.gainLeft = gainLeft;
+				voice.gainRight = gainRight;
+				voice.hasGains = true;
+			}
+
+			ClampSamples(output + static_cast<size_t>(done) * OutputChannels, m_MixBuffer.data(), count * OutputChannels);
+		}
+	}
+
+	void AudioProvider::ApplyCommand(const Command& command)
+	{
+		Voice& voice = m_Voices[command.index];
+
+		if (command.type == CommandType::Play)
+		{
+			if (voice.active)
+				DeactivateVoice(command.index);
+
+			voice = Voice{};
+			voice.generation = command.generation;
+			voice.active = true;
+			voice.loop = command.loop;
+			voice.volume = command.volume;
+			voice.samples = command.samples;
+			voice.frameCount = command.frameCount;
+			voice.channels = command.channels;
+			voice.stream = command.stream;
+			voice.step = command.step;
+
+			voice.activeIndex = static_cast<uint32_t>(m_ActiveVoices.size());
+			m_ActiveVoices.push_back(command.index);
+			return;
+		}
+
+		// Commands for a voice that already finished are dropped
+		if (!voice.active || voice.generation != command.generation)
+			return;
+
+		switch (command.type)
+		{
+		case CommandType::Stop:
+			DeactivateVoice(command.index);
+			break;
+		case CommandType::Pause:
+			voice.paused = true;
+			break;
+		case CommandType::Resume:
+			voice.paused = false;
+			break;
+		case CommandType::SetVolume:
+			voice.volume = command.volume;
+			break;
+		default:
+			break;
+		}
 	}
 
-	Audio::Handle AudioProvider::StartSound(const Core::AudioAsset& audio, bool loop, bool playOnce)
+	void AudioProvider::DeactivateVoice(uint32_t index)
+	{
+		Voice& voice = m_Voices[index];
+
+		uint32_t last = m_ActiveVoices.back();
+		m_ActiveVoices[voice.activeIndex] = last;
+		m_Voices[last].activeIndex = voice.activeIndex;
+		m_ActiveVoices.pop_back();
+
+		voice.active = false;
+		voice.stream = nullptr;
+	}
+
+	const float* AudioProvider::RenderVoice(Voice& voice, uint32_t frameCount)
+	{
+		// The clip ran out during the previous batch, which played it up to the two history frames
+		if (voice.sourceEnded)
+			return nullptr;
+
+		if (!voice.primed)
+		{
+			FetchFrames(voice, voice.history, 2);
+			voice.primed = true;
+		}
+
+		// Pitch scales the resampling step, capped so the batch still fits the source buffer
+		double step = std::min(voice.step * voice.pitch, static_cast<double>(MaxRateRatio));
+
+		// The source holds the two history frames followed by every frame this batch moves past
+		double end = voice.fraction + frameCount * step;
+		uint32_t fetchCount = static_cast<uint32_t>(end);
+
+		float* source = m_SourceBuffer.data();
+		std::memcpy(source, voice.history, sizeof(voice.history));
+		FetchFrames(voice, source + 2 * OutputChannels, fetchCount);
+		std::memcpy(voice.history, source + static_cast<size_t>(fetchCount) * OutputChannels, sizeof(voice.history));
+
+		// Same rate as the device, the source frames are the output
+		if (step == 1.0 && voice.fraction == 0.0)
+			return source;
+
+		float* destination = m_VoiceBuffer.data();
+		for (uint32_t frame = 0; frame < frameCount; ++frame)
+		{
+			double position = voice.fraction + frame * step;
+			uint32_t index = static_cast<uint32_t>(position);
+			float t = static_cast<float>(position - index);
+
+			const float* a = source + static_cast<size_t>(index) * OutputChannels;
+			const float* b = a + OutputChannels;
+			destination[frame * 2] = a[0] + (b[0] - a[0]) * t;
+			destination[frame * 2 + 1] = a[1] + (b[1] - a[1]) * t;
+		}
+
+		voice.fraction = end - fetchCount;
+		return destination;
+	}
+
+	void AudioProvider::FetchFrames(Voice& voice, float* destination, uint32_t frameCount)
+	{
+		uint32_t done = 0;
+		while (done < frameCount && !voice.sourceEnded)
+		{
+			float* target = destination + static_cast<size_t>(done) * OutputChannels;
+
+			if (voice.stream)
+			{
+				uint32_t count = std::min<uint32_t>(frameCount - done, static_cast<uint32_t>(m_StreamBuffer.size() / voice.channels));
+				bool atEnd = false;
+				uint32_t read = voice.stream->Read(m_StreamBuffer.data(), count, atEnd);
+				ConvertToStereo(m_StreamBuffer.data(), voice.channels, read, target);
+				done += read;
+				voice.sourceEnded = atEnd;
+				continue;
+			}
+
+			uint32_t count = std::min(frameCount - done, voice.frameCount - voice.cursor);
+			ConvertToStereo(voice.samples + static_cast<size_t>(voice.cursor) * voice.channels, voice.channels, count, target);
+			done += count;
+			voice.cursor += count;
+
+			if (voice.cursor == voice.frameCount)
+			{
+				if (voice.loop)
+					voice.cursor = 0;
+				else
+					voice.sourceEnded = true;
+			}
+		}
+
+		std::fill(destination + static_cast<size_t>(done) * OutputChannels, destination + static_cast<size_t>(frameCount) * OutputChannels, 0.0f);
+	}
+
+	Audio::Handle AudioProvider::StartVoice(const Core::AudioAsset& audio, bool loop, Audio::Priority priority)
 	{
 		if (!m_Initialized)
 			return Audio::InvalidHandle;
@@ -137,77 +457,166 @@ namespace Nightbird::Glfw
 			return Audio::InvalidHandle;
 		}
 
-		auto activeSound = std::make_unique<ActiveSound>();
-		activeSound->handle = m_NextHandle++;
-		activeSound->playOnce = playOnce;
-
-		const auto& blob = audio.GetChannelData(0);
-		if (blob.empty())
+		if (audio.GetChannels() == 0 || audio.GetFrameCount() == 0)
 		{
 			Core::Log::Error("AudioProvider: Audio data empty");
 			return Audio::InvalidHandle;
 		}
 
-		ma_audio_buffer_config bufferConfig = ma_audio_buffer_config_init(ma_format_s16, audio.GetChannels(), audio.GetFrameCount(), blob.data(), nullptr);
-		bufferConfig.sampleRate = audio.GetSampleRate();
-
-		ma_result result = ma_audio_buffer_init(&bufferConfig, &activeSound->audioBuffer);
-		if (result != MA_SUCCESS)
+		double step = static_cast<double>(audio.GetSampleRate()) / m_SampleRate;
+		if (step <= 0.0 || step > MaxRateRatio)
 		{
-			Core::Log::Error("AudioProvider: Failed to init audio buffer");
+			Core::Log::Error("AudioProvider: Unsupported sample rate: " + std::to_string(audio.GetSampleRate()));
 			return Audio::InvalidHandle;
 		}
-		activeSound->audioBufferInitialized = true;
 
-		result = ma_sound_init_from_data_source(&m_AudioEngine, &activeSound->audioBuffer, 0, nullptr, &activeSound->sound);
-		if (result != MA_SUCCESS)
+		if (!audio.IsStreamed() && audio.GetChannelData(0).size() < static_cast<size_t>(audio.GetFrameCount()) * audio.GetChannels() * sizeof(int16_t))
 		{
-			Core::Log::Error("AudioProvider: Failed to init sound");
+			Core::Log::Error("AudioProvider: Audio data empty");
+			return Audio::InvalidHandle;
+		}
+
+		uint32_t index = AcquireSlot(priority);
+		if (index == NoVoice)
 			return Audio::InvalidHandle;
+
+		// Unpanned until the first spatial update
+		SpatialState& spatial = m_SpatialStates[index];
+		spatial.gainLeft.store(1.0f, std::memory_order_relaxed);
+		spatial.gainRight.store(1.0f, std::memory_order_relaxed);
+		spatial.pitch.store(1.0f, std::memory_order_relaxed);
+
+		Slot& slot = m_Slots[index];
+		slot.state = SlotState::Playing;
+		slot.priority = priority;
+		slot.startOrder = m_NextStartOrder++;
+		slot.reportedUnderruns = 0;
+		slot.activeIndex = static_cast<uint32_t>(m_ActiveSlots.size());
+		m_ActiveSlots.push_back(index);
+
+		Command command;
+		command.type = CommandType::Play;
+		command.index = index;
+		command.generation = slot.generation;
+		command.loop = loop;
+		command.channels = audio.GetChannels();
+		command.frameCount = audio.GetFrameCount();
+		command.step = step;
+
+		if (audio.IsStreamed())
+		{
+			// Streamed clips hold no samples, the streaming thread reads them into a small ring buffer
+			slot.stream = std::make_shared<Core::AudioStream>(audio, loop);
+			command.stream = slot.stream.get();
+			m_Streamer.Add(slot.stream);
+		}
+		else
+		{
+			command.samples = reinterpret_cast<const int16_t*>(audio.GetChannelData(0).data());
 		}
-		activeSound->soundInitialized = true;
 
-		ma_sound_set_looping(&activeSound->sound, loop ? MA_TRUE : MA_FALSE);
-		ma_sound_start(&activeSound->sound);
+		QueueCommand(command);
 
-		Audio::Handle handle = activeSound->handle;
-		m_ActiveSounds.push_back(std::move(activeSound));
-		return handle;
+		return (slot.generation << IndexBits) | index;
 	}
 
-	AudioProvider::ActiveSound* AudioProvider::FindSound(Audio::Handle handle)
+	void AudioProvider::QueueCommand(const Command& command)
 	{
-		for (auto& sound : m_ActiveSounds)
-		{
-			if (sound->handle == handle)
-				return sound.get();
-		}
-		return nullptr;
+		++m_QueuedCommands;
+
+		// Once anything has overflowed, later commands wait behind it to keep the order
+		if (!m_OverflowCommands.empty() || !m_Commands->Push(command))
+			m_OverflowCommands.push_back(command);
 	}
 
-	const AudioProvider::ActiveSound* AudioProvider::FindSound(Audio::Handle handle) const
+	uint32_t AudioProvider::AcquireSlot(Audio::Priority priority)
 	{
-		for (const auto& sound : m_ActiveSounds)
+		if (!m_FreeSlots.empty())
 		{
-			if (sound->handle == handle)
-				return sound.get();
+			uint32_t index = m_FreeSlots.back();
+			m_FreeSlots.pop_back();
+			return index;
+		}
+
+		// Out of voices, reuse a finished one or steal the oldest of the lowest priority ones unless they all outrank this sound
+		uint32_t victim = NoVoice;
+		for (uint32_t index : m_ActiveSlots)
+		{
+			if (IsFinished(index))
+			{
+				ReleaseSlot(index, false);
+				m_FreeSlots.pop_back();
+				return index;
+			}
+
+			const Slot& slot = m_Slots[index];
+			if (victim == NoVoice || slot.priority < m_Slots[victim].priority || (slot.priority == m_Slots[victim].priority && slot.startOrder < m_Slots[victim].startOrder))
+				victim = index;
 		}
-		return nullptr;
+
+		if (victim == NoVoice || m_Slots[victim].priority > priority)
+			return NoVoice;
+
+		ReleaseSlot(victim, true);
+		m_FreeSlots.pop_back();
+		return victim;
 	}
 
-	void AudioProvider::DestroySound(ActiveSound& sound)
+	void AudioProvider::ReleaseSlot(uint32_t index, bool notifyDevice)
 	{
-		if (sound.soundInitialized)
+		Slot& slot = m_Slots[index];
+
+		if (notifyDevice)
 		{
-			ma_sound_stop(&sound.sound);
-			ma_sound_uninit(&sound.sound);
-			sound.soundInitialized = false;
+			Command command;
+			command.type = CommandType::Stop;
+			command.index = index;
+			command.generation = slot.generation;
+			QueueCommand(command);
 		}
 
-		if (sound.audioBufferInitialized)
+		if (slot.stream)
 		{
-			ma_audio_buffer_uninit(&sound.audioBuffer);
-			sound.audioBufferInitialized = false;
+			m_Streamer.Remove(slot.stream.get());
+			m_RetiredStreams.push_back({ std::move(slot.stream), m_QueuedCommands });
+			slot.stream.reset();
 		}
+
+		// Swap the last active slot into this one's place
+		uint32_t last = m_ActiveSlots.back();
+		m_ActiveSlots[slot.activeIndex] = last;
+		m_Slots[last].activeIndex = slot.activeIndex;
+		m_ActiveSlots.pop_back();
+
+		// Outstanding handles to this voice go stale, generation 0 is skipped so no handle equals InvalidHandle
+		slot.generation = (slot.generation + 1) & GenerationMask;
+		if (slot.generation == 0)
+			slot.generation = 1;
+		slot.state = SlotState::Free;
+
+		m_FreeSlots.push_back(index);
+	}
+
+	bool AudioProvider::IsFinished(uint32_t index) const
+	{
+		return m_FinishedGenerations[index].load(std::memory_order_acquire) == m_Slots[index].generation;
+	}
+
+	AudioProvider::Slot* AudioProvider::FindSlot(Audio::Handle handle)
+	{
+		uint32_t index = handle & IndexMask;
+		if (index >= m_Slots.size())
+			return nullptr;
+
+		Slot& slot = m_Slots[index];
+		if (slot.state == SlotState::Free || slot.generation != handle >> IndexBits)
+			return nullptr;
+
+		return &slot;
+	}
+
+	const AudioProvider::Slot* AudioProvider::FindSlot(Audio::Handle handle) const
+	{
+		return const_cast<AudioProvider*>(this)->FindSlot(handle);
 	}
 }
@@ -3,11 +3,15 @@
 #include "Audio/AudioProvider.h"
 #include "Audio/AudioHandle.h"
 
-#include "Core/AudioAsset.h"
+#include "Core/AudioStream.h"
+#include "Core/SPSCQueue.h"
 
 #include <miniaudio.h>
 
+#include <atomic>
+#include <cstdint>
 #include <memory>
+#include <vector>
 
 namespace Nightbird::Core
 {
@@ -16,43 +20,191 @@ namespace Nightbird::Core
 
 namespace Nightbird::Glfw
 {
+	// Mixes a fixed pool of voices in software on the miniaudio device thread. Handles hold a voice
+	// index and a generation, so lookups are O(1) and handles of finished or stolen voices go stale.
+	// The provider is driven from one game thread, which only queues commands for the device
+	// thread. Neither side ever locks, and playing an in-memory clip allocates nothing.
 	class AudioProvider : public Audio::Provider
 	{
 	public:
+		static constexpr uint32_t DefaultVoiceLimit = 256;
+		static constexpr uint32_t MaxVoiceLimit = 4096;
+
 		void Initialize() override;
 		void Shutdown() override;
 		void Update() override;
 
-		Audio::Handle Play(const Core::AudioAsset& audio, bool loop) override;
-		void PlayOnce(const Core::AudioAsset& audio) override;
+		Audio::Handle Play(const Core::AudioAsset& audio, bool loop, Audio::Priority priority) override;
+		void PlayOnce(const Core::AudioAsset& audio, Audio::Priority priority) override;
 		void Stop(Audio::Handle handle) override;
 		void Pause(Audio::Handle handle) override;
 		void Resume(Audio::Handle handle) override;
 
 		void SetVolume(Audio::Handle handle, float volume) override;
+		void SetSpatialParams(const Audio::SpatialParams* params, size_t count) override;
 
 		bool IsPlaying(Audio::Handle handle) const override;
 
+		// Takes effect at the next Initialize
+		void SetVoiceLimit(uint32_t voiceLimit);
+		uint32_t GetVoiceLimit() const;
+
 	private:
-		struct ActiveSound
+		// Low bits of a handle are the voice index, the rest its generation
+		static constexpr uint32_t IndexBits = 12;
+		static constexpr uint32_t IndexMask = (1u << IndexBits) - 1;
+		static constexpr uint32_t GenerationMask = (1u << (32 - IndexBits)) - 1;
+		static constexpr uint32_t NoVoice = UINT32_MAX;
+
+		static constexpr uint32_t OutputChannels = 2;
+		static constexpr uint32_t BatchFrames = 256;
+		// Largest source to output sample rate ratio a voice can be resampled by
+		static constexpr uint32_t MaxRateRatio = 8;
+		static constexpr size_t CommandCapacity = 1024;
+
+		enum class CommandType : uint8_t
+		{
+			Play,
+			Stop,
+			Pause,
+			Resume,
+			SetVolume
+		};
+
+		struct Command
+		{
+			CommandType type = CommandType::Stop;
+			uint32_t index = 0;
+			uint32_t generation = 0;
+			float volume = 1.0f;
+
+			// Play only
+			bool loop = false;
+			uint8_t channels = 0;
+			uint32_t frameCount = 0;
+			double step = 1.0;
+			const int16_t* samples = nullptr;
+			Core::AudioStream* stream = nullptr;
+		};
+
+		enum class SlotState : uint8_t
+		{
+			Free,
+			Playing,
+			Paused
+		};
+
+		// Game thread view of a voice
+		struct Slot
 		{
-			Audio::Handle handle;
-			ma_audio_buffer audioBuffer;
-			ma_sound sound;
-			bool audioBufferInitialized = false;
-			bool soundInitialized = false;
-			bool playOnce = false;
+			uint32_t generation = 1;
+			SlotState state = SlotState::Free;
+			Audio::Priority priority = 0;
+			// Orders voices of equal priority for stealing, the oldest goes first
+			uint64_t startOrder = 0;
+			// Position in m_ActiveSlots
+			uint32_t activeIndex = 0;
+			std::shared_ptr<Core::AudioStream> stream;
+			uint32_t reportedUnderruns = 0;
 		};
 
-		ma_engine m_AudioEngine;
-		Audio::Handle m_NextHandle = 1;
-		std::vector<std::unique_ptr<ActiveSound>> m_ActiveSounds;
+		// Spatial parameters of a voice, written by the game thread and read by the device thread every batch.
+		// They change every frame, so they skip the command queue and only the latest values matter.
+		struct SpatialState
+		{
+			std::atomic<float> gainLeft = 1.0f;
+			std::atomic<float> gainRight = 1.0f;
+			std::atomic<float> pitch = 1.0f;
+		};
+
+		// Streams of released voices, kept alive until the device thread has seen the command that stopped them
+		struct RetiredStream
+		{
+			std::shared_ptr<Core::AudioStream> stream;
+			uint64_t sequence = 0;
+		};
+
+		// Device thread view of a voice
+		struct Voice
+		{
+			uint32_t generation = 0;
+			bool active = false;
+			bool paused = false;
+			bool loop = false;
+			// Position in m_ActiveVoices
+			uint32_t activeIndex = 0;
+			float volume = 1.0f;
+			float pitch = 1.0f;
+			// Gains of the previous batch, changes are ramped across a batch so they don't click
+			float gainLeft = 0.0f;
+			float gainRight = 0.0f;
+			bool hasGains = false;
+
+			// In-memory clips read from samples, streamed clips from stream
+			const int16_t* samples = nullptr;
+			uint32_t frameCount = 0;
+			uint8_t channels = 0;
+			uint32_t cursor = 0;
+			Core::AudioStream* stream = nullptr;
+			bool sourceEnded = false;
+
+			// Linear resampling, source frames per output frame and the position between the two history frames
+			double step = 1.0;
+			double fraction = 0.0;
+			float history[4] = {};
+			bool primed = false;
+		};
+
+		ma_device m_Device;
+		Core::AudioStreamer m_Streamer;
+
+		std::unique_ptr<Core::SPSCQueue<Command>> m_Commands;
+		// Sequence number of the last command queued by the game thread and the last one applied by the device thread
+		uint64_t m_QueuedCommands = 0;
+		std::atomic<uint64_t> m_AppliedCommands = 0;
+		// Commands that didn't fit in the ring, pushed in order by the next Update
+		std::vector<Command> m_OverflowCommands;
+
+		// Game thread
+		std::vector<Slot> m_Slots;
+		std::vector<uint32_t> m_FreeSlots;
+		std::vector<uint32_t> m_ActiveSlots;
+		std::vector<RetiredStream> m_RetiredStreams;
+		uint64_t m_NextStartOrder = 0;
+
+		// Written by the device thread, the generation of each voice whose clip has ended
+		std::unique_ptr<std::atomic<uint32_t>[]> m_FinishedGenerations;
+		std::unique_ptr<SpatialState[]> m_SpatialStates;
+
+		// Device thread
+		std::vector<Voice> m_Voices;
+		std::vector<uint32_t> m_ActiveVoices;
+		std::vector<float> m_MixBuffer;
+		std::vector<float> m_SourceBuffer;
+		std::vector<float> m_VoiceBuffer;
+		std::vector<int16_t> m_StreamBuffer;
+
+		uint32_t m_VoiceLimit = DefaultVoiceLimit;
+		uint32_t m_SampleRate = 0;
 
 		bool m_Initialized = false;
 
-		Audio::Handle StartSound(const Core::AudioAsset& audio, bool loop, bool playOnce);
-		ActiveSound* FindSound(Audio::Handle handle);
-		const ActiveSound* FindSound(Audio::Handle handle) const;
-		void DestroySound(ActiveSound& sound);
+		static void DataCallback(ma_device* device, void* output, const void* input, ma_uint32 frameCount);
+		void Mix(float* output, uint32_t frameCount);
+		void ApplyCommand(const Command& command);
+		void DeactivateVoice(uint32_t index);
+		// Renders frameCount output frames of the voice at its pitch, returns the stereo frames or null once the clip has drained
+		const float* RenderVoice(Voice& voice, uint32_t frameCount);
+		// Reads the next frameCount source frames as stereo, silence past the end of the clip
+		void FetchFrames(Voice& voice, float* destination, uint32_t frameCount);
+
+		Audio::Handle StartVoice(const Core::AudioAsset& audio, bool loop, Audio::Priority priority);
+		void QueueCommand(const Command& command);
+		uint32_t AcquireSlot(Audio::Priority priority);
+		// Frees the slot, notifyDevice stops the voice on the device thread as well
+		void ReleaseSlot(uint32_t index, bool notifyDevice);
+		bool IsFinished(uint32_t index) const;
+		Slot* FindSlot(Audio::Handle handle);
+		const Slot* FindSlot(Audio::Handle handle) const;
 	};
 }
@@ -137,10 +137,10 @@ namespace Nightbird::Vulkan
 	void Renderer::SubmitScene(const Core::Scene& scene, const Core::Camera& camera)
 	{
 		m_ActiveCamera = &camera;
-		m_Renderables = scene.CollectRenderables();
-		m_DirectionalLights = scene.CollectDirectionalLights();
-		m_PointLights = scene.CollectPointLights();
-		m_Skybox = scene.FindSkybox();
+		m_Renderables = &scene.GetRenderables();
+		m_DirectionalLights = &scene.GetDirectionalLights();
+		m_PointLights = &scene.GetPointLights();
+		m_Skybox = scene.GetSkybox();
 	}
 
 	bool Renderer::BeginFrame(Core::RenderSurface& coreSurface)
@@ -279,7 +279,7 @@ namespace Nightbird::Vulkan
 		m_FrameDescriptorSetManager->UpdateCamera(frameIndex, cameraUBO);
 
 		std::vector<DirectionalLightData> directionalLightData;
-		for (const auto* directionalLight : m_DirectionalLights)
+		for (const auto* directionalLight : *m_DirectionalLights)
 		{
 			DirectionalLightData data{};
 			glm::mat4 worldMatrix = directionalLight->GetWorldMatrix();
@@ -292,7 +292,7 @@ namespace Nightbird::Vulkan
 		m_FrameDescriptorSetManager->UpdateDirectionalLights(frameIndex, directionalLightData);
 
 		std::vector<PointLightData> pointLightData;
-		for (const auto* pointLight : m_PointLights)
+		for (const auto* pointLight : *m_PointLights)
 		{
 			PointLightData data{};
 			glm::vec3 worldPos = glm::vec3(pointLight->GetWorldMatrix()[3]);
@@ -320,7 +320,7 @@ namespace Nightbird::Vulkan
 		std::vector<const Core::Renderable*> opaqueRenderables;
 		std::vector<const Core::Renderable*> transparentRenderables;
 
-		for (const auto& renderable : m_Renderables)
+		for (const auto& renderable : *m_Renderables)
 		{
 			if (renderable.primitive->GetMaterial()->transparencyEnabled)
 				transparentRenderables.push_back(&renderable);
@@ -99,9 +99,9 @@ namespace Nightbird::Vulkan
 
 		const Core::Camera* m_ActiveCamera = nullptr;
 
-		std::vector<Core::Renderable> m_Renderables;
-		std::vector<Core::DirectionalLight*> m_DirectionalLights;
-		std::vector<Core::PointLight*> m_PointLights;
+		const std::vector<Core::Renderable>* m_Renderables = nullptr;
+		const std::vector<Core::DirectionalLight*>* m_DirectionalLights = nullptr;
+		const std::vector<Core::PointLight*>* m_PointLights = nullptr;
 		const Core::Skybox* m_Skybox = nullptr;
 		std::unique_ptr<Geometry> m_SkyboxGeometry;
 
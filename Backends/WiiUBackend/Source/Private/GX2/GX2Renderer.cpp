@@ -100,7 +100,7 @@ namespace Nightbird::GX2
 	void Renderer::SubmitScene(const Core::Scene& scene, const Core::Camera& camera)
 	{
 		m_ActiveCamera = &camera;
-		m_Renderables = scene.CollectRenderables();
+		m_Renderables = &scene.GetRenderables();
 	}
 
 	bool Renderer::BeginFrame(Core::RenderSurface& surface)
@@ -149,19 +149,20 @@ namespace Nightbird::GX2
 		GX2Invalidate(GX2_INVALIDATE_MODE_CPU | GX2_INVALIDATE_MODE_UNIFORM_BLOCK, m_CameraData, 36 * sizeof(float));
 		GX2SetVertexUniformBlock(m_CameraBlockLocation, 36 * sizeof(float), m_CameraData);
 		
-		uint32_t renderableCount = static_cast<uint32_t>(m_Renderables.size());
+		const std::vector<Core::Renderable>& renderables = *m_Renderables;
+		uint32_t renderableCount = static_cast<uint32_t>(renderables.size());
 		float* modelDataPool = (float*)MEMAllocFromDefaultHeapEx(16 * sizeof(float) * renderableCount, GX2_UNIFORM_BLOCK_ALIGNMENT);
 
 		for (uint32_t i = 0; i < renderableCount; ++i)
 		{
 			float* modelData = modelDataPool + 16 * i;
-			UploadMatrix(modelData, m_Renderables[i].transform);
+			UploadMatrix(modelData, renderables[i].transform);
 
 			GX2Invalidate(GX2_INVALIDATE_MODE_CPU | GX2_INVALIDATE_MODE_UNIFORM_BLOCK, modelData, 16 * sizeof(float));
 			GX2SetVertexUniformBlock(m_ModelBlockLocation, 16 * sizeof(float), modelData);
 
-			Geometry& geometry = GetOrCreateGeometry(m_Renderables[i].primitive);
-			Material& material = GetOrCreateMaterial(m_Renderables[i].primitive->GetMaterial().get());
+			Geometry& geometry = GetOrCreateGeometry(renderables[i].primitive);
+			Material& material = GetOrCreateMaterial(renderables[i].primitive->GetMaterial().get());
 
 			GX2SetPixelTexture(&material.GetBaseColorTexture().GetTexture(), 3);
 			GX2SetPixelSampler(&material.GetBaseColorTexture().GetSampler(), 3);
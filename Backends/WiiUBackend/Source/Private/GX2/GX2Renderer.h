@@ -44,7 +44,7 @@ namespace Nightbird::GX2
 
 	private:
 		const Core::Camera* m_ActiveCamera = nullptr;
-		std::vector<Core::Renderable> m_Renderables;
+		const std::vector<Core::Renderable>* m_Renderables = nullptr;
 		std::unordered_map<const Core::MeshPrimitive*, Geometry> m_GeometryCache;
 		std::unordered_map<const Core::Material*, Material> m_MaterialCache;
 
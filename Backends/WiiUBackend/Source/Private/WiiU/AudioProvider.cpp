@@ -58,12 +58,12 @@ namespace Nightbird::WiiU
 		}
 	}
 
-	Audio::Handle AudioProvider::Play(const Core::AudioAsset& audio, bool loop)
+	Audio::Handle AudioProvider::Play(const Core::AudioAsset& audio, bool loop, Audio::Priority priority)
 	{
 		return StartSound(audio, loop, false);
 	}
 
-	void AudioProvider::PlayOnce(const Core::AudioAsset& audio)
+	void AudioProvider::PlayOnce(const Core::AudioAsset& audio, Audio::Priority priority)
 	{
 		StartSound(audio, false, true);
 	}
@@ -165,6 +165,11 @@ namespace Nightbird::WiiU
 		// }
 	}
 
+	void AudioProvider::SetSpatialParams(const Audio::SpatialParams* params, size_t count)
+	{
+		// Panning and pitch wait on per-voice mixing, see SetVolume
+	}
+
 	bool AudioProvider::IsPlaying(Audio::Handle handle) const
 	{
 		if (!m_Initialized)
@@ -192,6 +197,12 @@ namespace Nightbird::WiiU
 			return Audio::InvalidHandle;
 		}
 
+		if (audio.IsStreamed())
+		{
+			Core::Log::Error("AudioProvider: Streamed audio not supported");
+			return Audio::InvalidHandle;
+		}
+
 		uint8_t channels = audio.GetChannels();
 		if (channels == 0)
 		{
@@ -21,13 +21,14 @@ namespace Nightbird::WiiU
 		void Shutdown() override;
 		void Update() override;
 
-		Audio::Handle Play(const Core::AudioAsset& audio, bool loop) override;
-		void PlayOnce(const Core::AudioAsset& audio) override;
+		Audio::Handle Play(const Core::AudioAsset& audio, bool loop, Audio::Priority priority) override;
+		void PlayOnce(const Core::AudioAsset& audio, Audio::Priority priority) override;
 		void Stop(Audio::Handle handle) override;
 		void Pause(Audio::Handle handle) override;
 		void Resume(Audio::Handle handle) override;
 
 		void SetVolume(Audio::Handle handle, float volume) override;
+		void SetSpatialParams(const Audio::SpatialParams* params, size_t count) override;
 
 		bool IsPlaying(Audio::Handle handle) const override;
 
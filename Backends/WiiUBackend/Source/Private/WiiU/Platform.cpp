@@ -62,6 +62,11 @@ namespace Nightbird::WiiU
 		return std::string(WHBGetSdCardMountPath()) + "/Nightbird/Cooked";
 	}
 
+	size_t Platform::GetAssetMemoryBudget() const
+	{
+		return 384 * 1024 * 1024;
+	}
+
 	Input::Provider& Platform::GetInputProvider()
 	{
 		return m_InputProvider;
@@ -13,10 +13,33 @@ namespace Nightbird::Editor
 	class AudioCooker
 	{
 	public:
-		void Cook(const std::filesystem::path& assetPath, const uuids::uuid& uuid, const std::filesystem::path& outputDir, CookTarget target, Endianness endianness);
+		static constexpr uint32_t Version = 3;
+
+		// Clips at least this large once decoded are streamed from disk when the target supports it
+		static constexpr size_t StreamThreshold = 2 * 1024 * 1024;
+
+		enum class StreamMode
+		{
+			Auto,
+			Always,
+			Never
+		};
+
+		// Interleaved 16-bit source audio, decoded once and shared by every target
+		struct DecodedAudio
+		{
+			uint32_t sampleRate = 0;
+			uint32_t frameCount = 0;
+			uint8_t channels = 0;
+			std::vector<int16_t> samples;
+		};
+
+		static bool Decode(const std::filesystem::path& assetPath, DecodedAudio& outAudio);
+
+		bool Cook(const std::filesystem::path& assetPath, const DecodedAudio& audio, const uuids::uuid& uuid, const std::filesystem::path& outputDir, CookTarget target, Endianness endianness, StreamMode streamMode);
 
 	private:
-		std::vector<uint8_t> CookPCM16(const std::filesystem::path& assetPath, uint32_t& outSampleRate, uint32_t& outFrameCount, uint8_t& outChannels, Endianness endianness, bool planar);
-		std::vector<uint8_t> CookDSPADPCM(const std::filesystem::path& assetPath, const uuids::uuid& uuid, uint32_t& outSampleRate, uint32_t& outFrameCount, uint8_t& outChannels);
+		std::vector<uint8_t> CookPCM16(const DecodedAudio& audio, Endianness endianness, bool planar);
+		std::vector<uint8_t> CookDSPADPCM(const DecodedAudio& audio);
 	};
 }
@@ -1,35 +1,58 @@
 #include "Cook/BinaryWriter.h"
 
+#include "Cook/ByteSwap.h"
+
 #include "Core/Vertex.h"
 
+#include <algorithm>
+#include <bit>
 #include <cstring>
 
 namespace Nightbird::Editor
 {
+	static constexpr Endianness NativeEndianness = std::endian::native == std::endian::big ? Endianness::Big : Endianness::Little;
+
 	BinaryWriter::BinaryWriter(const std::filesystem::path& path, Endianness endianness)
-		: m_File(path, std::ios::binary | std::ios::out), m_Endianness(endianness)
+		: m_File(path, std::ios::binary | std::ios::out), m_SwapBytes(endianness != NativeEndianness)
 	{
+		m_Buffer.reserve(BlockSize);
+	}
 
+	BinaryWriter::~BinaryWriter()
+	{
+		Flush();
 	}
 
-	template<typename T>
-	void BinaryWriter::WriteValue(T value)
+	bool BinaryWriter::IsSwappingBytes() const
 	{
-		uint8_t bytes[sizeof(T)];
-		std::memcpy(bytes, &value, sizeof(T));
+		return m_SwapBytes;
+	}
 
-		if (m_Endianness == Endianness::Big)
-		{
-			for (size_t i = 0; i < sizeof(T) / 2; ++i)
-				std::swap(bytes[i], bytes[sizeof(T) - 1 - i]);
-		}
+	void BinaryWriter::Flush()
+	{
+		if (m_Buffer.empty())
+			return;
+
+		m_File.write(reinterpret_cast<const char*>(m_Buffer.data()), m_Buffer.size());
+		m_Buffer.clear();
+	}
 
-		m_File.write(reinterpret_cast<const char*>(bytes), sizeof(T));
+	bool BinaryWriter::Close()
+	{
+		Flush();
+		m_File.close();
+		return !m_File.fail();
+	}
+
+	template<typename T>
+	void BinaryWriter::WriteValue(T value)
+	{
+		WriteElements(&value, sizeof(T), 1);
 	}
 
 	void BinaryWriter::WriteUInt8(uint8_t value)
 	{
-		m_File.write(reinterpret_cast<const char*>(&value), 1);
+		WriteRawBytes(&value, 1);
 	}
 
 	void BinaryWriter::WriteUInt16(uint16_t value)
@@ -44,7 +67,7 @@ namespace Nightbird::Editor
 
 	void BinaryWriter::WriteInt8(int8_t value)
 	{
-		m_File.write(reinterpret_cast<const char*>(&value), 1);
+		WriteRawBytes(reinterpret_cast<const uint8_t*>(&value), 1);
 	}
 
 	void BinaryWriter::WriteInt16(int16_t value)
@@ -64,34 +87,67 @@ namespace Nightbird::Editor
 
 	void BinaryWriter::WriteVertex(const Core::Vertex& vertex)
 	{
-		WriteFloat(vertex.position.x);
-		WriteFloat(vertex.position.y);
-		WriteFloat(vertex.position.z);
-		WriteFloat(vertex.normal.x);
-		WriteFloat(vertex.normal.y);
-		WriteFloat(vertex.normal.z);
-		WriteFloat(vertex.baseColorTexCoord.x);
-		WriteFloat(vertex.baseColorTexCoord.y);
-		WriteFloat(vertex.metallicRoughnessTexCoord.x);
-		WriteFloat(vertex.metallicRoughnessTexCoord.y);
-		WriteFloat(vertex.normalTexCoord.x);
-		WriteFloat(vertex.normalTexCoord.y);
+		WriteVertices(std::span<const Core::Vertex>(&vertex, 1));
 	}
 
-	void BinaryWriter::WriteVertices(const std::vector<Core::Vertex>& vertices)
+	void BinaryWriter::WriteVertices(std::span<const Core::Vertex> vertices)
 	{
-		for (const auto& vertex : vertices)
-			WriteVertex(vertex);
+		// Written as the plain float array the loader expects
+		static_assert(sizeof(Core::Vertex) == 12 * sizeof(float), "Vertex must be tightly packed floats");
+		WriteSpan(std::span<const float>(reinterpret_cast<const float*>(vertices.data()), vertices.size() * 12));
 	}
 
-	void BinaryWriter::WriteIndices(const std::vector<uint16_t>& indices)
+	void BinaryWriter::WriteIndices(std::span<const uint16_t> indices)
 	{
-		for (uint16_t index : indices)
-			WriteUInt16(index);
+		WriteSpan(indices);
 	}
 	
 	void BinaryWriter::WriteRawBytes(const uint8_t* data, size_t size)
 	{
-		m_File.write(reinterpret_cast<const char*>(data), size);
+		if (m_Buffer.size() + size > BlockSize)
+			Flush();
+
+		// Large blocks skip the buffer entirely
+		if (size >= BlockSize)
+		{
+			m_File.write(reinterpret_cast<const char*>(data), size);
+			return;
+		}
+
+		m_Buffer.insert(m_Buffer.end(), data, data + size);
+	}
+
+	void BinaryWriter::WriteElements(const void* data, size_t elementSize, size_t count)
+	{
+		if (!m_SwapBytes || elementSize == 1)
+		{
+			WriteRawBytes(static_cast<const uint8_t*>(data), elementSize * count);
+			return;
+		}
+
+		// Copy into the block and swap there, a block at a time
+		const uint8_t* source = static_cast<const uint8_t*>(data);
+		const size_t elementsPerBlock = BlockSize / elementSize;
+
+		while (count > 0)
+		{
+			if (m_Buffer.size() + elementSize > BlockSize)
+				Flush();
+
+			size_t batch = std::min(count, (BlockSize - m_Buffer.size()) / elementSize);
+			batch = std::min(batch, elementsPerBlock);
+
+			size_t offset = m_Buffer.size();
+			m_Buffer.resize(offset + batch * elementSize);
+			std::memcpy(m_Buffer.data() + offset, source, batch * elementSize);
+
+			if (elementSize == 2)
+				ByteSwap16(m_Buffer.data() + offset, batch);
+			else
+				ByteSwap32(m_Buffer.data() + offset, batch);
+
+			source += batch * elementSize;
+			count -= batch;
+		}
 	}
 }
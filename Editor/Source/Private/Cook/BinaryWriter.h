@@ -2,9 +2,12 @@
 
 #include "Cook/Endianness.h"
 
-#include <vector>
+#include <cstdint>
 #include <filesystem>
 #include <fstream>
+#include <span>
+#include <type_traits>
+#include <vector>
 
 namespace Nightbird::Core
 {
@@ -13,10 +16,15 @@ namespace Nightbird::Core
 
 namespace Nightbird::Editor
 {
+	// Output is collected in large blocks and written to the file when a block fills up or the writer is destroyed
 	class BinaryWriter
 	{
 	public:
 		BinaryWriter(const std::filesystem::path& path, Endianness endianness);
+		~BinaryWriter();
+
+		BinaryWriter(const BinaryWriter&) = delete;
+		BinaryWriter& operator=(const BinaryWriter&) = delete;
 
 		void WriteUInt8(uint8_t value);
 		void WriteUInt16(uint16_t value);
@@ -26,15 +34,36 @@ namespace Nightbird::Editor
 		void WriteInt32(int32_t value);
 		void WriteFloat(float value);
 		void WriteVertex(const Core::Vertex& vertex);
-		void WriteVertices(const std::vector<Core::Vertex>& vertices);
-		void WriteIndices(const std::vector<uint16_t>& indices);
+		void WriteVertices(std::span<const Core::Vertex> vertices);
+		void WriteIndices(std::span<const uint16_t> indices);
 		void WriteRawBytes(const uint8_t* data, size_t size);
 
+		// Writes the whole array at once, byte swapping in bulk when the target endianness differs
+		template<typename T>
+		void WriteSpan(std::span<const T> values)
+		{
+			static_assert(std::is_arithmetic_v<T> && (sizeof(T) == 1 || sizeof(T) == 2 || sizeof(T) == 4), "WriteSpan supports 8, 16 and 32-bit values");
+			WriteElements(values.data(), sizeof(T), values.size());
+		}
+
+		void Flush();
+		// Writes what is buffered and closes the file, false if opening or any write failed
+		bool Close();
+
+		// True when the target byte order differs from the host's
+		bool IsSwappingBytes() const;
+
 	private:
+		static constexpr size_t BlockSize = 256 * 1024;
+
 		std::ofstream m_File;
-		Endianness m_Endianness;
+		bool m_SwapBytes;
+
+		std::vector<uint8_t> m_Buffer;
 
 		template<typename T>
 		void WriteValue(T value);
+
+		void WriteElements(const void* data, size_t elementSize, size_t count);
 	};
 }
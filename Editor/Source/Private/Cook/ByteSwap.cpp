@@ -0,0 +1,59 @@
+#include "Cook/ByteSwap.h"
+
+#include <utility>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+	#define NB_BYTESWAP_SSE2 1
+	#include <emmintrin.h>
+#endif
+
+namespace Nightbird::Editor
+{
+#ifdef NB_BYTESWAP_SSE2
+	static __m128i Swap16(__m128i value)
+	{
+		return _mm_or_si128(_mm_slli_epi16(value, 8), _mm_srli_epi16(value, 8));
+	}
+#endif
+
+	void ByteSwap16(void* data, size_t count)
+	{
+		uint8_t* bytes = static_cast<uint8_t*>(data);
+		size_t i = 0;
+
+#ifdef NB_BYTESWAP_SSE2
+		for (; i + 8 <= count; i += 8)
+		{
+			__m128i* block = reinterpret_cast<__m128i*>(bytes + i * 2);
+			_mm_storeu_si128(block, Swap16(_mm_loadu_si128(block)));
+		}
+#endif
+
+		for (; i < count; ++i)
+			std::swap(bytes[i * 2], bytes[i * 2 + 1]);
+	}
+
+	void ByteSwap32(void* data, size_t count)
+	{
+		uint8_t* bytes = static_cast<uint8_t*>(data);
+		size_t i = 0;
+
+#ifdef NB_BYTESWAP_SSE2
+		// Swap the two 16-bit halves of each element, then the bytes within each half
+		for (; i + 4 <= count; i += 4)
+		{
+			__m128i* block = reinterpret_cast<__m128i*>(bytes + i * 4);
+			__m128i value = _mm_loadu_si128(block);
+			value = _mm_shufflelo_epi16(value, _MM_SHUFFLE(2, 3, 0, 1));
+			value = _mm_shufflehi_epi16(value, _MM_SHUFFLE(2, 3, 0, 1));
+			_mm_storeu_si128(block, Swap16(value));
+		}
+#endif
+
+		for (; i < count; ++i)
+		{
+			std::swap(bytes[i * 4], bytes[i * 4 + 3]);
+			std::swap(bytes[i * 4 + 1], bytes[i * 4 + 2]);
+		}
+	}
+}
@@ -0,0 +1,11 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace Nightbird::Editor
+{
+	// In-place byte order reversal of each element, data needs no particular alignment
+	void ByteSwap16(void* data, size_t count);
+	void ByteSwap32(void* data, size_t count);
+}
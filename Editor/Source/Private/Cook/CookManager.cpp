@@ -10,18 +10,188 @@
 
 #include "Import/ImportManager.h"
 #include "Import/AssetInfo.h"
+#include "Import/ContentHash.h"
 #include "Scene/TextSceneReader.h"
 #include "Scene/BinarySceneWriter.h"
 
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <cstdio>
+
 namespace Nightbird::Editor
 {
+	static uint64_t HashTexture(const Core::Texture& texture)
+	{
+		ContentHasher hasher;
+		hasher.UpdateValue(texture.GetWidth());
+		hasher.UpdateValue(texture.GetHeight());
+		hasher.UpdateValue(texture.GetFormat());
+		hasher.Update(texture.GetData().data(), texture.GetData().size());
+		return hasher.Finish();
+	}
+
+	static void HashTextureUUID(ContentHasher& hasher, const Core::Texture* texture, const std::unordered_map<const Core::Texture*, uuids::uuid>& textureUUIDs)
+	{
+		auto it = textureUUIDs.find(texture);
+		hasher.Update(it != textureUUIDs.end() ? it->second : uuids::uuid());
+	}
+
+	static uint64_t HashMaterial(const Core::Material& material, const std::unordered_map<const Core::Texture*, uuids::uuid>& textureUUIDs)
+	{
+		ContentHasher hasher;
+		hasher.UpdateValue(material.baseColorFactor);
+		hasher.UpdateValue(material.metallicFactor);
+		hasher.UpdateValue(material.roughnessFactor);
+		hasher.UpdateValue(material.transparencyEnabled);
+		hasher.UpdateValue(material.doubleSided);
+		HashTextureUUID(hasher, material.baseColorTexture.get(), textureUUIDs);
+		HashTextureUUID(hasher, material.metallicRoughnessTexture.get(), textureUUIDs);
+		HashTextureUUID(hasher, material.normalTexture.get(), textureUUIDs);
+		return hasher.Finish();
+	}
+
+	static uint64_t HashMesh(const Core::Mesh& mesh, const std::unordered_map<const Core::Material*, uuids::uuid>& materialUUIDs)
+	{
+		ContentHasher hasher;
+		hasher.UpdateValue(static_cast<uint64_t>(mesh.GetPrimitiveCount()));
+
+		for (const Core::MeshPrimitive& primitive : mesh.GetPrimitives())
+		{
+			const auto& vertices = primitive.GetVertices();
+			const auto& indices = primitive.GetIndices();
+
+			hasher.UpdateValue(static_cast<uint64_t>(vertices.size()));
+			hasher.Update(vertices.data(), vertices.size() * sizeof(Core::Vertex));
+			hasher.UpdateValue(static_cast<uint64_t>(indices.size()));
+			hasher.Update(indices.data(), indices.size() * sizeof(uint16_t));
+
+			auto it = materialUUIDs.find(primitive.GetMaterial().get());
+			hasher.Update(it != materialUUIDs.end() ? it->second : uuids::uuid());
+		}
+
+		return hasher.Finish();
+	}
+
+	// Reuses the recorded hash while the source file's size, write time and settings are unchanged
+	static bool HashSourceFile(const CookManifest& manifest, const std::string& output, const std::filesystem::path& path, CookManifest::Entry& entry)
+	{
+		std::error_code error;
+		uint64_t size = std::filesystem::file_size(path, error);
+		if (error)
+			return false;
+
+		auto time = std::filesystem::last_write_time(path, error);
+		if (error)
+			return false;
+
+		entry.sourceSize = size;
+		entry.sourceTime = static_cast<int64_t>(time.time_since_epoch().count());
+
+		const CookManifest::Entry* previous = manifest.Find(output);
+		if (previous && previous->sourceSize == entry.sourceSize && previous->sourceTime == entry.sourceTime && previous->settingsHash == entry.settingsHash)
+		{
+			entry.inputHash = previous->inputHash;
+			return true;
+		}
+
+		if (!HashFile(path, entry.inputHash))
+			return false;
+
+		if (entry.settingsHash != 0)
+		{
+			ContentHasher hasher;
+			hasher.UpdateValue(entry.inputHash);
+			hasher.UpdateValue(entry.settingsHash);
+			entry.inputHash = hasher.Finish();
+		}
+
+		return true;
+	}
+
+	static const char* GetTargetName(CookTarget target)
+	{
+		switch (target)
+		{
+		case CookTarget::Desktop:
+			return "Desktop";
+		case CookTarget::WiiU:
+			return "WiiU";
+		case CookTarget::N3DS:
+			return "3DS";
+		default:
+			return "Unknown";
+		}
+	}
+
+	class CookManager::MemoryBudget
+	{
+	public:
+		explicit MemoryBudget(size_t limit)
+			: m_Limit(limit)
+		{
+
+		}
+
+		void SetLimit(size_t limit)
+		{
+			std::lock_guard<std::mutex> lock(m_Mutex);
+			m_Limit = limit;
+		}
+
+		// A cook larger than the whole budget still runs, just on its own
+		void Acquire(size_t bytes)
+		{
+			std::unique_lock<std::mutex> lock(m_Mutex);
+			m_Released.wait(lock, [&]() { return m_InFlight == 0 || m_InFlight + bytes <= m_Limit; });
+			m_InFlight += bytes;
+		}
+
+		void Release(size_t bytes)
+		{
+			{
+				std::lock_guard<std::mutex> lock(m_Mutex);
+				m_InFlight -= bytes;
+			}
+			m_Released.notify_all();
+		}
+
+	private:
+		std::mutex m_Mutex;
+		std::condition_variable m_Released;
+		size_t m_Limit;
+		size_t m_InFlight = 0;
+	};
+
 	CookManager::CookManager(const std::filesystem::path& outputDir, ImportManager& importManager)
-		: m_RootOutputDir(outputDir), m_ImportManager(importManager)
+		: m_RootOutputDir(outputDir), m_ImportManager(importManager), m_MemoryBudget(std::make_unique<MemoryBudget>(512ull * 1024 * 1024))
 	{
 
 	}
 
+	CookManager::~CookManager() = default;
+
+	void CookManager::SetJobSystem(Core::JobSystem* jobSystem)
+	{
+		m_JobSystem = jobSystem;
+	}
+
+	void CookManager::SetMemoryBudget(size_t bytes)
+	{
+		m_MemoryBudget->SetLimit(bytes);
+	}
+
 	void CookManager::CookScene(const uuids::uuid& sceneUUID, CookTarget target)
+	{
+		CookScene(sceneUUID, std::vector<CookTarget>{ target });
+	}
+
+	void CookManager::CookScene(Core::SceneReadResult result, CookTarget target)
+	{
+		CookScene(std::move(result), std::vector<CookTarget>{ target });
+	}
+
+	void CookManager::CookScene(const uuids::uuid& sceneUUID, const std::vector<CookTarget>& targets)
 	{
 		Core::SceneReadResult result = m_ImportManager.LoadScene(sceneUUID);
 		if (!result.root)
@@ -30,10 +200,10 @@ namespace Nightbird::Editor
 			return;
 		}
 
-		CookSceneInternal(result, target);
+		CookSceneInternal(result, targets);
 	}
 
-	void CookManager::CookScene(Core::SceneReadResult result, CookTarget target)
+	void CookManager::CookScene(Core::SceneReadResult result, const std::vector<CookTarget>& targets)
 	{
 		if (!result.root)
 		{
@@ -41,43 +211,98 @@ namespace Nightbird::Editor
 			return;
 		}
 
-		CookSceneInternal(result, target);
+		CookSceneInternal(result, targets);
 	}
 
-	void CookManager::CookSceneInternal(Core::SceneReadResult& result, CookTarget target)
+	void CookManager::CookSceneInternal(Core::SceneReadResult& result, const std::vector<CookTarget>& targets)
 	{
+		auto start = std::chrono::steady_clock::now();
+
 		m_TextureUUIDs.clear();
 		m_MaterialUUIDs.clear();
 		m_MeshUUIDs.clear();
 		m_AudioPathUUIDs.clear();
+		m_SharedAudio.clear();
+		m_InputHashes.clear();
 		m_ImportedSceneRoots.clear();
 		m_CookedSceneUUIDs.clear();
+		m_Timings.clear();
 
-		m_Endianness = GetEndianness(target);
-		m_CookOutputDir = GetOutputDir(target);
-		std::filesystem::create_directories(m_CookOutputDir);
-		
+		// Collected and hashed once, the in-memory assets are shared by all targets
 		CollectAssets(result.root.get());
-		
-		CookTextures(m_CookOutputDir, target, m_Endianness);
-		CookMaterials(m_CookOutputDir, m_Endianness);
-		CookMeshes(m_CookOutputDir, m_Endianness);
-		CookAudio(m_CookOutputDir, target, m_Endianness);
 
-		for (auto& [uuid, importedRoot] : m_ImportedSceneRoots)
-			WriteBinaryScene(importedRoot.get(), uuid, m_CookOutputDir, m_Endianness);
+		for (const auto& [uuid, path] : m_AudioPathUUIDs)
+			m_SharedAudio[uuid] = std::make_shared<SharedAudio>();
+
+		std::vector<std::unique_ptr<TargetCook>> cooks;
+		for (CookTarget target : targets)
+		{
+			auto cook = std::make_unique<TargetCook>();
+			cook->target = target;
+			cook->endianness = GetEndianness(target);
+			cook->outputDir = GetOutputDir(target);
+			std::filesystem::create_directories(cook->outputDir);
+			cook->manifest.Load(cook->outputDir);
+			cooks.push_back(std::move(cook));
+		}
+
+		// Up to date checks read the manifests, so everything is scheduled before the first job can record
+		std::vector<std::vector<CookJob>> jobs(cooks.size());
+		for (size_t i = 0; i < cooks.size(); ++i)
+		{
+			ScheduleTextures(*cooks[i], jobs[i]);
+			ScheduleMaterials(*cooks[i], jobs[i]);
+			ScheduleMeshes(*cooks[i], jobs[i]);
+			ScheduleAudio(*cooks[i], jobs[i]);
+		}
+
+		// Only the scheduled cooks keep decoded audio alive from here on
+		m_SharedAudio.clear();
+
+		// Every asset cook is independent, only the pak depends on the rest of its target
+		Core::JobCounter done;
+		for (size_t i = 0; i < cooks.size(); ++i)
+		{
+			TargetCook* target = cooks[i].get();
+			for (auto& job : jobs[i])
+				RunJob([this, target, job = std::move(job)]() mutable { RunCook(*target, job); }, &target->counter);
+
+			RunJob([this, target, &result]()
+			{
+				for (auto& [uuid, importedRoot] : m_ImportedSceneRoots)
+					WriteBinaryScene(*target, importedRoot.get(), uuid);
+
+				WriteBinaryScene(*target, result.root.get(), result.uuid, result.activeCamera);
+
+				if (m_ProjectCooker.Cook(result.uuid, target->outputDir, target->endianness))
+					RecordWritten(*target, target->outputDir / "Project.nbproject");
+			}, &target->counter);
+
+			RunJob([this, target, uuid = result.uuid]() { CookPak(*target, uuid); }, &done, &target->counter);
+		}
+
+		if (m_JobSystem)
+			m_JobSystem->Wait(done);
+
+		for (auto& cook : cooks)
+		{
+			cook->manifest.Save();
+			Core::Log::Info(std::string("CookManager: ") + GetTargetName(cook->target) + ": Cooked " + std::to_string(cook->cookedCount.load()) +
+				" outputs, " + std::to_string(cook->upToDateCount.load()) + " up to date");
+		}
 
-		WriteBinaryScene(result.root.get(), result.uuid, m_CookOutputDir, m_Endianness, result.activeCamera);
+		LogTimings();
 
-		m_ProjectCooker.Cook(result.uuid, m_CookOutputDir, m_Endianness);
+		double milliseconds = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+		Core::Log::Info("CookManager: Cook finished in " + std::to_string(static_cast<uint32_t>(milliseconds)) + " ms");
 	}
 
-	void CookManager::WriteBinaryScene(Core::SceneObject* root, const uuids::uuid& sceneUUID,
-		const std::filesystem::path& outputDir, Endianness endianness, Core::Camera* activeCamera)
+	void CookManager::WriteBinaryScene(TargetCook& cook, Core::SceneObject* root, const uuids::uuid& sceneUUID, Core::Camera* activeCamera)
 	{
 		BinarySceneWriter sceneWriter;
-		auto outputPath = outputDir / (uuids::to_string(sceneUUID) + ".nbscene");
-		sceneWriter.Write(root, sceneUUID, outputPath, endianness, activeCamera);
+		auto outputPath = cook.outputDir / (uuids::to_string(sceneUUID) + ".nbscene");
+		sceneWriter.Write(root, sceneUUID, outputPath, cook.endianness, activeCamera);
+		RecordWritten(cook, outputPath);
 		Core::Log::Info("CookManager: Written binary scene: " + outputPath.string());
 	}
 
@@ -122,7 +347,8 @@ namespace Nightbird::Editor
 			const auto* mesh = meshInstance->m_Mesh.Get().get();
 			if (mesh && m_MeshUUIDs.find(mesh) == m_MeshUUIDs.end())
 			{
-				m_MeshUUIDs[mesh] = meshInstance->m_Mesh.GetUUID();
+				uuids::uuid meshUUID = meshInstance->m_Mesh.GetUUID();
+				m_MeshUUIDs[mesh] = meshUUID;
 
 				for (size_t i = 0; i < mesh->GetPrimitiveCount(); ++i)
 				{
@@ -131,18 +357,19 @@ namespace Nightbird::Editor
 
 					if (material && m_MaterialUUIDs.find(material.get()) == m_MaterialUUIDs.end())
 					{
-						m_MaterialUUIDs[material.get()] = GenerateUUID();
-
-						if (material->baseColorTexture && m_TextureUUIDs.find(material->baseColorTexture.get()) == m_TextureUUIDs.end())
-							m_TextureUUIDs[material->baseColorTexture.get()] = GenerateUUID();
-
-						if (material->metallicRoughnessTexture && m_TextureUUIDs.find(material->metallicRoughnessTexture.get()) == m_TextureUUIDs.end())
-							m_TextureUUIDs[material->metallicRoughnessTexture.get()] = GenerateUUID();
-
-						if (material->normalTexture && m_TextureUUIDs.find(material->normalTexture.get()) == m_TextureUUIDs.end())
-							m_TextureUUIDs[material->normalTexture.get()] = GenerateUUID();
+						CollectTexture(material->baseColorTexture.get());
+						CollectTexture(material->metallicRoughnessTexture.get());
+						CollectTexture(material->normalTexture.get());
+
+						// Embedded materials have no identity of their own, name them by content
+						uint64_t materialHash = HashMaterial(*material, m_TextureUUIDs);
+						uuids::uuid materialUUID = MakeContentUUID("material", materialHash);
+						m_MaterialUUIDs[material.get()] = materialUUID;
+						m_InputHashes[materialUUID] = materialHash;
 					}
 				}
+
+				m_InputHashes[meshUUID] = HashMesh(*mesh, m_MaterialUUIDs);
 			}
 		}
 		else if (auto* audioSource = Cast<Core::AudioSource>(object))
@@ -165,41 +392,233 @@ namespace Nightbird::Editor
 			CollectAssets(child.get());
 	}
 
-	void CookManager::CookTextures(const std::filesystem::path& outputDir, CookTarget target, Endianness endianness)
+	void CookManager::CollectTexture(const Core::Texture* texture)
+	{
+		if (!texture || m_TextureUUIDs.find(texture) != m_TextureUUIDs.end())
+			return;
+
+		uint64_t textureHash = HashTexture(*texture);
+		uuids::uuid textureUUID = MakeContentUUID("texture", textureHash);
+		m_TextureUUIDs[texture] = textureUUID;
+		m_InputHashes[textureUUID] = textureHash;
+	}
+
+	void CookManager::ScheduleTextures(TargetCook& cook, std::vector<CookJob>& jobs)
 	{
 		for (const auto& [texture, uuid] : m_TextureUUIDs)
-			m_TextureCooker.Cook(*texture, uuid, outputDir, target, endianness);
+		{
+			CookJob job;
+			job.output = uuids::to_string(uuid) + ".nbtexture";
+			job.entry = { m_InputHashes.at(uuid), TextureCooker::Version };
+			job.memoryEstimate = texture->GetData().size() * 2;
+			job.cook = [this, &cook, texture, uuid]() { return m_TextureCooker.Cook(*texture, uuid, cook.outputDir, cook.target, cook.endianness); };
+			Schedule(cook, std::move(job), jobs);
+		}
 	}
 
-	void CookManager::CookMaterials(const std::filesystem::path& outputDir, Endianness endianness)
+	void CookManager::ScheduleMaterials(TargetCook& cook, std::vector<CookJob>& jobs)
 	{
 		for (const auto& [material, uuid] : m_MaterialUUIDs)
-			m_MaterialCooker.Cook(*material, uuid, outputDir, endianness, m_TextureUUIDs);
+		{
+			CookJob job;
+			job.output = uuids::to_string(uuid) + ".nbmaterial";
+			job.entry = { m_InputHashes.at(uuid), MaterialCooker::Version };
+			job.cook = [this, &cook, material, uuid]() { return m_MaterialCooker.Cook(*material, uuid, cook.outputDir, cook.endianness, m_TextureUUIDs); };
+			Schedule(cook, std::move(job), jobs);
+		}
 	}
 
-	void CookManager::CookMeshes(const std::filesystem::path& outputDir, Endianness endianness)
+	void CookManager::ScheduleMeshes(TargetCook& cook, std::vector<CookJob>& jobs)
 	{
 		for (const auto& [mesh, uuid] : m_MeshUUIDs)
-			m_MeshCooker.Cook(*mesh, uuid, outputDir, endianness, m_MaterialUUIDs);
+		{
+			CookJob job;
+			job.output = uuids::to_string(uuid) + ".nbmesh";
+			job.entry = { m_InputHashes.at(uuid), MeshCooker::Version };
+			for (const Core::MeshPrimitive& primitive : mesh->GetPrimitives())
+				job.memoryEstimate += primitive.GetVertices().size() * sizeof(Core::Vertex) + primitive.GetIndices().size() * sizeof(uint16_t);
+			job.cook = [this, &cook, mesh, uuid]() { return m_MeshCooker.Cook(*mesh, uuid, cook.outputDir, cook.endianness, m_MaterialUUIDs); };
+			Schedule(cook, std::move(job), jobs);
+		}
 	}
 
-	void CookManager::CookAudio(const std::filesystem::path& outputDir, CookTarget target, Endianness endianness)
+	void CookManager::ScheduleAudio(TargetCook& cook, std::vector<CookJob>& jobs)
 	{
 		for (const auto& [uuid, path] : m_AudioPathUUIDs)
-			m_AudioCooker.Cook(path, uuid, outputDir, target, endianness);
+		{
+			CookJob job;
+			job.output = uuids::to_string(uuid) + ".nbaudio";
+			job.entry.cookerVersion = AudioCooker::Version;
+
+			// "stream" in the asset's [import] table forces streaming on or off, otherwise the cooker decides by size
+			AudioCooker::StreamMode streamMode = AudioCooker::StreamMode::Auto;
+			if (const AssetInfo* assetInfo = m_ImportManager.GetAssetInfo(uuid))
+			{
+				auto it = assetInfo->tags.find("stream");
+				if (it != assetInfo->tags.end())
+				{
+					streamMode = it->second == "true" ? AudioCooker::StreamMode::Always : AudioCooker::StreamMode::Never;
+
+					ContentHasher hasher;
+					hasher.Update(it->second);
+					job.entry.settingsHash = hasher.Finish();
+				}
+			}
+
+			if (!HashSourceFile(cook.manifest, job.output, path, job.entry))
+			{
+				Core::Log::Warning("CookManager: Failed to read audio source: " + path.string());
+				continue;
+			}
+
+			// Rough guess covering the decoded samples and the cooked copy
+			job.memoryEstimate = job.entry.sourceSize * 4;
+
+			std::shared_ptr<SharedAudio> shared = m_SharedAudio.at(uuid);
+			job.cook = [this, &cook, uuid, path, shared, streamMode]()
+			{
+				std::call_once(shared->once, [&]() { shared->decoded = AudioCooker::Decode(path, shared->audio); });
+				return shared->decoded && m_AudioCooker.Cook(path, shared->audio, uuid, cook.outputDir, cook.target, cook.endianness, streamMode);
+			};
+			Schedule(cook, std::move(job), jobs);
+		}
 	}
 
-	uuids::uuid CookManager::GenerateUUID() const
+	void CookManager::Schedule(TargetCook& cook, CookJob job, std::vector<CookJob>& jobs)
 	{
-		std::random_device randomDevice;
+		// Identical content shares a UUID and is only cooked once
+		if (!cook.scheduled.insert(job.output).second)
+			return;
+
+		if (cook.manifest.IsUpToDate(job.output, job.entry.inputHash, job.entry.cookerVersion))
+		{
+			++cook.upToDateCount;
+			return;
+		}
+
+		jobs.push_back(std::move(job));
+	}
+
+	void CookManager::RunJob(std::function<void()> function, Core::JobCounter* counter, Core::JobCounter* dependency)
+	{
+		// Without a job system everything runs in order on this thread, which already satisfies the dependencies
+		if (m_JobSystem)
+			m_JobSystem->Run(std::move(function), counter, dependency);
+		else
+			function();
+	}
+
+	void CookManager::RunCook(TargetCook& cook, CookJob& job)
+	{
+		m_MemoryBudget->Acquire(job.memoryEstimate);
+
+		auto start = std::chrono::steady_clock::now();
+		bool cooked = job.cook();
+		double milliseconds = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
 
-		auto seedData = std::array<int, std::mt19937::state_size>{};
-		std::generate(std::begin(seedData), std::end(seedData), std::ref(randomDevice));
-		std::seed_seq seq(std::begin(seedData), std::end(seedData));
-		std::mt19937 generator(seq);
-		uuids::uuid_random_generator gen{generator};
+		// Drop whatever the cook captured before handing the memory back
+		job.cook = nullptr;
+		m_MemoryBudget->Release(job.memoryEstimate);
 
-		return gen();
+		RecordCooked(cook, job.output, cooked, job.entry, milliseconds);
+	}
+
+	void CookManager::CookPak(TargetCook& cook, const uuids::uuid& mainSceneUUID)
+	{
+		std::vector<PakCooker::Entry> entries;
+		std::unordered_set<uuids::uuid> addedUUIDs;
+
+		auto addEntry = [&](const uuids::uuid& uuid, const char* extension, Core::PakEntryType type)
+		{
+			// Content addressed assets may be referenced more than once
+			if (!addedUUIDs.insert(uuid).second)
+				return;
+
+			entries.push_back({ uuid, cook.outputDir / (uuids::to_string(uuid) + extension), type });
+		};
+
+		entries.push_back({ uuids::uuid(), cook.outputDir / "Project.nbproject", Core::PakEntryType::Project });
+
+		addEntry(mainSceneUUID, ".nbscene", Core::PakEntryType::Scene);
+		for (const auto& [uuid, importedRoot] : m_ImportedSceneRoots)
+			addEntry(uuid, ".nbscene", Core::PakEntryType::Scene);
+
+		for (const auto& [mesh, uuid] : m_MeshUUIDs)
+			addEntry(uuid, ".nbmesh", Core::PakEntryType::Mesh);
+		for (const auto& [material, uuid] : m_MaterialUUIDs)
+			addEntry(uuid, ".nbmaterial", Core::PakEntryType::Material);
+		for (const auto& [texture, uuid] : m_TextureUUIDs)
+			addEntry(uuid, ".nbtexture", Core::PakEntryType::Texture);
+		for (const auto& [uuid, path] : m_AudioPathUUIDs)
+			addEntry(uuid, ".nbaudio", Core::PakEntryType::Audio);
+
+		// The pak only needs rewriting if one of its files did
+		std::sort(entries.begin(), entries.end(), [](const PakCooker::Entry& a, const PakCooker::Entry& b) { return a.uuid < b.uuid; });
+
+		ContentHasher hasher;
+		for (const auto& entry : entries)
+		{
+			const CookManifest::Entry* cooked = cook.manifest.Find(entry.path.filename().string());
+			hasher.Update(entry.uuid);
+			hasher.UpdateValue(cooked ? cooked->inputHash : 0);
+			hasher.UpdateValue(cooked ? cooked->cookerVersion : 0);
+		}
+
+		CookManifest::Entry pakEntry{ hasher.Finish(), Core::Pak::Version };
+		if (cook.manifest.IsUpToDate(Core::Pak::FileName, pakEntry.inputHash, pakEntry.cookerVersion))
+		{
+			++cook.upToDateCount;
+			return;
+		}
+
+		auto start = std::chrono::steady_clock::now();
+		bool cooked = m_PakCooker.Cook(std::move(entries), cook.outputDir, cook.endianness);
+		double milliseconds = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+		RecordCooked(cook, Core::Pak::FileName, cooked, pakEntry, milliseconds);
+	}
+
+	void CookManager::RecordCooked(TargetCook& cook, const std::string& output, bool cooked, const CookManifest::Entry& entry, double milliseconds)
+	{
+		// A failed re-cook can leave the previous output behind. Removing it keeps it out of the pak,
+		// and IsUpToDate fails for a missing file, so the cook is retried next time.
+		if (!cooked)
+		{
+			std::error_code error;
+			std::filesystem::remove(cook.outputDir / output, error);
+			return;
+		}
+
+		{
+			std::lock_guard<std::mutex> lock(cook.mutex);
+			cook.manifest.Record(output, entry);
+		}
+		++cook.cookedCount;
+
+		std::lock_guard<std::mutex> lock(m_TimingMutex);
+		m_Timings.push_back({ output, cook.target, milliseconds });
+	}
+
+	void CookManager::RecordWritten(TargetCook& cook, const std::filesystem::path& path)
+	{
+		CookManifest::Entry entry;
+		if (!HashFile(path, entry.inputHash))
+			return;
+
+		std::lock_guard<std::mutex> lock(cook.mutex);
+		cook.manifest.Record(path.filename().string(), entry);
+	}
+
+	void CookManager::LogTimings()
+	{
+		std::sort(m_Timings.begin(), m_Timings.end(), [](const Timing& a, const Timing& b) { return a.milliseconds > b.milliseconds; });
+
+		for (const Timing& timing : m_Timings)
+		{
+			char milliseconds[32];
+			std::snprintf(milliseconds, sizeof(milliseconds), "%.1f ms", timing.milliseconds);
+			Core::Log::Info(std::string("CookManager: ") + GetTargetName(timing.target) + ": " + timing.output + " " + milliseconds);
+		}
 	}
 
 	Endianness CookManager::GetEndianness(CookTarget target) const
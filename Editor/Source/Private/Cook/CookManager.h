@@ -2,6 +2,7 @@
 
 #include "Core/SceneReadResult.h"
 #include "Core/SceneObject.h"
+#include "Core/JobSystem.h"
 
 #include "Cook/Target.h"
 #include "Cook/ProjectCooker.h"
@@ -9,14 +10,22 @@
 #include "Cook/MaterialCooker.h"
 #include "Cook/MeshCooker.h"
 #include "Cook/AudioCooker.h"
+#include "Cook/PakCooker.h"
+#include "Cook/CookManifest.h"
 
 #include "Scene/TextSceneWriter.h"
 
 #include <uuid.h>
 
+#include <atomic>
 #include <filesystem>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
 #include <unordered_map>
 #include <unordered_set>
+#include <vector>
 
 namespace Nightbird::Core
 {
@@ -35,46 +44,122 @@ namespace Nightbird::Editor
 	{
 	public:
 		CookManager(const std::filesystem::path& outputDir, ImportManager& importManager);
+		~CookManager();
+
+		// Asset cooks run on the job system if one is set, otherwise on the calling thread
+		void SetJobSystem(Core::JobSystem* jobSystem);
+		// Cooks wait while the estimated memory of the cooks already running would exceed this
+		void SetMemoryBudget(size_t bytes);
 
 		void CookScene(const uuids::uuid& sceneUUID, CookTarget target);
 		void CookScene(Core::SceneReadResult, CookTarget target);
 
+		// Loads and collects the scene once, then cooks it for every target in one pass
+		void CookScene(const uuids::uuid& sceneUUID, const std::vector<CookTarget>& targets);
+		void CookScene(Core::SceneReadResult, const std::vector<CookTarget>& targets);
+
 	private:
-		std::filesystem::path m_RootOutputDir;
-		std::filesystem::path m_CookOutputDir;
+		class MemoryBudget;
+
+		// State of one target's output directory during a cook
+		struct TargetCook
+		{
+			CookTarget target;
+			Endianness endianness;
+			std::filesystem::path outputDir;
+
+			CookManifest manifest;
+			// Guards the manifest while cook jobs are running
+			std::mutex mutex;
+
+			// Outputs already scheduled, content addressed assets can show up more than once
+			std::unordered_set<std::string> scheduled;
+			// Every cook of this target, the pak waits for it
+			Core::JobCounter counter;
+
+			std::atomic<uint32_t> cookedCount = 0;
+			std::atomic<uint32_t> upToDateCount = 0;
+		};
+
+		struct CookJob
+		{
+			std::string output;
+			CookManifest::Entry entry;
+			size_t memoryEstimate = 0;
+			std::function<bool()> cook;
+		};
+
+		struct Timing
+		{
+			std::string output;
+			CookTarget target;
+			double milliseconds;
+		};
+
+		// Decoded source audio shared by the targets, decoded by whichever cook needs it first
+		struct SharedAudio
+		{
+			std::once_flag once;
+			bool decoded = false;
+			AudioCooker::DecodedAudio audio;
+		};
 
-		Endianness m_Endianness = Endianness::Little;
+		std::filesystem::path m_RootOutputDir;
 
 		ImportManager& m_ImportManager;
+
+		Core::JobSystem* m_JobSystem = nullptr;
+		std::unique_ptr<MemoryBudget> m_MemoryBudget;
 		
 		ProjectCooker m_ProjectCooker;
 		TextureCooker m_TextureCooker;
 		MaterialCooker m_MaterialCooker;
 		MeshCooker m_MeshCooker;
 		AudioCooker m_AudioCooker;
+		PakCooker m_PakCooker;
 
 		std::unordered_map<const Core::Texture*, uuids::uuid> m_TextureUUIDs;
 		std::unordered_map<const Core::Material*, uuids::uuid> m_MaterialUUIDs;
 		std::unordered_map<const Core::Mesh*, uuids::uuid> m_MeshUUIDs;
 
 		std::unordered_map<uuids::uuid, std::filesystem::path> m_AudioPathUUIDs;
+		std::unordered_map<uuids::uuid, std::shared_ptr<SharedAudio>> m_SharedAudio;
+
+		// Hash of everything a cooked asset is built from, by asset UUID
+		std::unordered_map<uuids::uuid, uint64_t> m_InputHashes;
 
 		std::unordered_map<uuids::uuid, std::unique_ptr<Core::SceneObject>> m_ImportedSceneRoots;
 
 		std::unordered_set<uuids::uuid> m_CookedSceneUUIDs;
 
-		void WriteBinaryScene(Core::SceneObject* scene, const uuids::uuid& sceneUUID,
-			const std::filesystem::path& outputDir, Endianness endianness, Core::Camera* activeCamera = nullptr);
+		std::mutex m_TimingMutex;
+		std::vector<Timing> m_Timings;
+
+		void WriteBinaryScene(TargetCook& cook, Core::SceneObject* scene, const uuids::uuid& sceneUUID, Core::Camera* activeCamera = nullptr);
 
 		void CollectAssets(Core::SceneObject* object);
+		void CollectTexture(const Core::Texture* texture);
+
+		void CookSceneInternal(Core::SceneReadResult&, const std::vector<CookTarget>& targets);
+
+		void ScheduleTextures(TargetCook& cook, std::vector<CookJob>& jobs);
+		void ScheduleMaterials(TargetCook& cook, std::vector<CookJob>& jobs);
+		void ScheduleMeshes(TargetCook& cook, std::vector<CookJob>& jobs);
+		void ScheduleAudio(TargetCook& cook, std::vector<CookJob>& jobs);
+		// Adds the job unless its output is already scheduled or up to date
+		void Schedule(TargetCook& cook, CookJob job, std::vector<CookJob>& jobs);
+
+		void RunJob(std::function<void()> function, Core::JobCounter* counter, Core::JobCounter* dependency = nullptr);
+		void RunCook(TargetCook& cook, CookJob& job);
+
+		void CookPak(TargetCook& cook, const uuids::uuid& mainSceneUUID);
+
+		void RecordCooked(TargetCook& cook, const std::string& output, bool cooked, const CookManifest::Entry& entry, double milliseconds);
+		// Records an output that is always rewritten, with the hash of its contents
+		void RecordWritten(TargetCook& cook, const std::filesystem::path& path);
 
-		void CookSceneInternal(Core::SceneReadResult&, CookTarget target);
-		void CookTextures(const std::filesystem::path& outputDir, CookTarget target, Endianness endianness);
-		void CookMaterials(const std::filesystem::path& outputDir, Endianness endianness);
-		void CookMeshes(const std::filesystem::path& outputDir, Endianness endianness);
-		void CookAudio(const std::filesystem::path& outputDir, CookTarget target, Endianness endianness);
+		void LogTimings();
 
-		uuids::uuid GenerateUUID() const;
 		Endianness GetEndianness(CookTarget target) const;
 		std::filesystem::path GetOutputDir(CookTarget target) const;
 	};
@@ -0,0 +1,115 @@
+#include "Cook/CookManifest.h"
+
+#include "Import/ContentHash.h"
+
+#include "Core/Log.h"
+
+#include <toml.hpp>
+
+#include <fstream>
+
+namespace Nightbird::Editor
+{
+	void CookManifest::Load(const std::filesystem::path& outputDir)
+	{
+		m_OutputDir = outputDir;
+		m_Entries.clear();
+
+		std::filesystem::path path = outputDir / FileName;
+		if (!std::filesystem::exists(path))
+			return;
+
+		toml::parse_result result = toml::parse_file(path.string());
+		if (!result)
+		{
+			Core::Log::Warning("CookManifest: Failed to parse, cooking everything: " + path.string());
+			return;
+		}
+
+		toml::table table = result.table();
+
+		if (table["manifest"]["version"].value_or(0) != Version)
+		{
+			Core::Log::Info("CookManifest: Outdated manifest, cooking everything: " + path.string());
+			return;
+		}
+
+		toml::table* outputs = table["outputs"].as_table();
+		if (!outputs)
+			return;
+
+		for (const auto& [name, node] : *outputs)
+		{
+			const toml::table* output = node.as_table();
+			if (!output)
+				continue;
+
+			Entry entry;
+			if (!FromHashString((*output)["input_hash"].value_or(std::string{}), entry.inputHash))
+				continue;
+
+			entry.cookerVersion = static_cast<uint32_t>((*output)["cooker_version"].value_or(int64_t(0)));
+			entry.sourceSize = static_cast<uint64_t>((*output)["source_size"].value_or(int64_t(0)));
+			entry.sourceTime = (*output)["source_time"].value_or(int64_t(0));
+			FromHashString((*output)["settings_hash"].value_or(std::string{}), entry.settingsHash);
+
+			m_Entries[std::string(name.str())] = entry;
+		}
+	}
+
+	void CookManifest::Save() const
+	{
+		toml::table manifest;
+		manifest.insert("version", static_cast<int64_t>(Version));
+
+		toml::table outputs;
+		for (const auto& [name, entry] : m_Entries)
+		{
+			toml::table output;
+			output.insert("input_hash", ToHashString(entry.inputHash));
+			output.insert("cooker_version", static_cast<int64_t>(entry.cookerVersion));
+
+			if (entry.sourceSize != 0 || entry.sourceTime != 0)
+			{
+				output.insert("source_size", static_cast<int64_t>(entry.sourceSize));
+				output.insert("source_time", entry.sourceTime);
+			}
+
+			if (entry.settingsHash != 0)
+				output.insert("settings_hash", ToHashString(entry.settingsHash));
+
+			outputs.insert(name, output);
+		}
+
+		toml::table table;
+		table.insert("manifest", manifest);
+		table.insert("outputs", outputs);
+
+		std::filesystem::path path = m_OutputDir / FileName;
+		std::ofstream file(path);
+		file << table;
+		file.close();
+
+		Core::Log::Info("CookManifest: Written: " + path.string());
+	}
+
+	const CookManifest::Entry* CookManifest::Find(const std::string& output) const
+	{
+		auto it = m_Entries.find(output);
+		return it != m_Entries.end() ? &it->second : nullptr;
+	}
+
+	bool CookManifest::IsUpToDate(const std::string& output, uint64_t inputHash, uint32_t cookerVersion) const
+	{
+		const Entry* entry = Find(output);
+		if (!entry || entry->inputHash != inputHash || entry->cookerVersion != cookerVersion)
+			return false;
+
+		return std::filesystem::exists(m_OutputDir / output);
+	}
+
+	void CookManifest::Record(const std::string& output, const Entry& entry)
+	{
+		m_Entries[output] = entry;
+	}
+}
@@ -0,0 +1,44 @@
+#pragma once
+
+#include <cstdint>
+#include <filesystem>
+#include <string>
+#include <unordered_map>
+
+namespace Nightbird::Editor
+{
+	// What was cooked into an output directory and from which inputs, keyed by output file name.
+	// Lets a re-cook skip every asset whose inputs and cooker version are unchanged.
+	class CookManifest
+	{
+	public:
+		static constexpr uint32_t Version = 1;
+		static constexpr const char* FileName = "CookManifest.toml";
+
+		struct Entry
+		{
+			uint64_t inputHash = 0;
+			uint32_t cookerVersion = 0;
+			// Size and write time of the source file the hash was taken from, if there is one
+			uint64_t sourceSize = 0;
+			int64_t sourceTime = 0;
+			// Import settings that change the output, mixed into inputHash
+			uint64_t settingsHash = 0;
+		};
+
+		// Missing or outdated manifests load as empty, which cooks everything
+		void Load(const std::filesystem::path& outputDir);
+		void Save() const;
+
+		const Entry* Find(const std::string& output) const;
+
+		// True if the output file exists and was cooked from the same inputs by the same cooker version
+		bool IsUpToDate(const std::string& output, uint64_t inputHash, uint32_t cookerVersion) const;
+
+		void Record(const std::string& output, const Entry& entry);
+
+	private:
+		std::filesystem::path m_OutputDir;
+		std::unordered_map<std::string, Entry> m_Entries;
+	};
+}
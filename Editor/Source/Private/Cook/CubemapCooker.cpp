@@ -9,7 +9,7 @@
 
 namespace Nightbird::Editor
 {
-	void CubemapCooker::Cook(const Core::Cubemap& cubemap, const uuids::uuid& uuid, const std::filesystem::path& outputDir, Core::AssetManager& assetManager, CookTarget target, Endianness endianness)
+	bool CubemapCooker::Cook(const Core::Cubemap& cubemap, const uuids::uuid& uuid, const std::filesystem::path& outputDir, Core::AssetManager& assetManager, CookTarget target, Endianness endianness)
 	{
 		std::filesystem::create_directories(outputDir);
 		std::filesystem::path outputPath = outputDir / (uuids::to_string(uuid) + ".ntcubemap");
@@ -29,7 +29,7 @@ namespace Nightbird::Editor
 		if (data.empty())
 		{
 			Core::Log::Error("CubemapCooker: Failed to cook: " + outputPath.string());
-			return;
+			return false;
 		}
 
 		uint32_t faceDataSize = static_cast<uint32_t>(data.size()) / 6;
@@ -54,7 +54,14 @@ namespace Nightbird::Editor
 
 		writer.WriteRawBytes(data.data(), data.size());
 
+		if (!writer.Close())
+		{
+			Core::Log::Error("CubemapCooker: Failed to write: " + outputPath.string());
+			return false;
+		}
+
 		Core::Log::Info("CubemapCooker: Cooked cubemap: " + outputPath.string());
+		return true;
 	}
 
 	std::vector<uint8_t> CubemapCooker::CookRGBA8(const Core::Cubemap& cubemap, Core::AssetManager& assetManager)
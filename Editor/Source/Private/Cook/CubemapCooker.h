@@ -19,7 +19,7 @@ namespace Nightbird::Editor
 	class CubemapCooker
 	{
 	public:
-		void Cook(const Core::Cubemap& cubemap, const uuids::uuid& uuid, const std::filesystem::path& outputDir, Core::AssetManager& assetManager, CookTarget target, Endianness endianness);
+		bool Cook(const Core::Cubemap& cubemap, const uuids::uuid& uuid, const std::filesystem::path& outputDir, Core::AssetManager& assetManager, CookTarget target, Endianness endianness);
 
 	private:
 		std::vector<uint8_t> CookRGBA8(const Core::Cubemap& cubemap, Core::AssetManager& assetManager);
@@ -0,0 +1,530 @@
+#include "Cook/DSPADPCMEncoder.h"
+
+#include <algorithm>
+#include <array>
+#include <cfloat>
+#include <cmath>
+#include <cstdlib>
+
+// Coefficient search and frame encoding follow the reference DSPADPCM encoder, the same algorithm
+// VGAudio ports, so the output matches what the VGAudioCli cook produced.
+namespace Nightbird::Editor
+{
+	static constexpr uint32_t SamplesPerFrame = 14;
+	static constexpr uint32_t BytesPerFrame = 8;
+	static constexpr uint32_t NibblesPerFrame = 16;
+	static constexpr uint32_t HeaderSize = 0x60;
+
+	using Vector = std::array<double, 3>;
+	using Matrix = std::array<Vector, 3>;
+
+	static int16_t ClampSample(int value)
+	{
+		return static_cast<int16_t>(std::clamp(value, -32768, 32767));
+	}
+
+	static void InnerProductMerge(Vector& out, const int16_t* history)
+	{
+		for (int i = 0; i <= 2; ++i)
+		{
+			out[i] = 0.0;
+			for (int x = 0; x < 14; ++x)
+				out[i] -= history[14 + x - i] * history[14 + x];
+		}
+	}
+
+	static void OuterProductMerge(Matrix& out, const int16_t* history)
+	{
+		for (int x = 1; x <= 2; ++x)
+		{
+			for (int y = 1; y <= 2; ++y)
+			{
+				out[x][y] = 0.0;
+				for (int z = 0; z < 14; ++z)
+					out[x][y] += history[14 + z - x] * history[14 + z - y];
+			}
+		}
+	}
+
+	// LU decomposition with partial pivoting, true if the matrix is too close to singular
+	static bool AnalyzeRanges(Matrix& matrix, int (&indices)[3])
+	{
+		double reciprocals[3];
+		for (int x = 1; x <= 2; ++x)
+		{
+			double value = std::max(std::fabs(matrix[x][1]), std::fabs(matrix[x][2]));
+			if (value < DBL_EPSILON)
+				return true;
+
+			reciprocals[x] = 1.0 / value;
+		}
+
+		int maxIndex = 0;
+		for (int i = 1; i <= 2; ++i)
+		{
+			for (int x = 1; x < i; ++x)
+			{
+				double temp = matrix[x][i];
+				for (int y = 1; y < x; ++y)
+					temp -= matrix[x][y] * matrix[y][i];
+				matrix[x][i] = temp;
+			}
+
+			double value = 0.0;
+			for (int x = i; x <= 2; ++x)
+			{
+				double temp = matrix[x][i];
+				for (int y = 1; y < i; ++y)
+					temp -= matrix[x][y] * matrix[y][i];
+				matrix[x][i] = temp;
+
+				temp = std::fabs(temp) * reciprocals[x];
+				if (temp >= value)
+				{
+					value = temp;
+					maxIndex = x;
+				}
+			}
+
+			if (maxIndex != i)
+			{
+				for (int y = 1; y <= 2; ++y)
+					std::swap(matrix[maxIndex][y], matrix[i][y]);
+				reciprocals[maxIndex] = reciprocals[i];
+			}
+
+			indices[i] = maxIndex;
+
+			if (matrix[i][i] == 0.0)
+				return true;
+
+			if (i != 2)
+			{
+				double temp = 1.0 / matrix[i][i];
+				for (int x = i + 1; x <= 2; ++x)
+					matrix[x][i] *= temp;
+			}
+		}
+
+		double min = 1.0e10;
+		double max = 0.0;
+		for (int i = 1; i <= 2; ++i)
+		{
+			double temp = std::fabs(matrix[i][i]);
+			min = std::min(min, temp);
+			max = std::max(max, temp);
+		}
+
+		return min / max < 1.0e-10;
+	}
+
+	static void BidirectionalFilter(const Matrix& matrix, const int (&indices)[3], Vector& vector)
+	{
+		for (int i = 1, x = 0; i <= 2; ++i)
+		{
+			int index = indices[i];
+			double temp = vector[index];
+			vector[index] = vector[i];
+
+			if (x != 0)
+			{
+				for (int y = x; y <= i - 1; ++y)
+					temp -= vector[y] * matrix[i][y];
+			}
+			else if (temp != 0.0)
+			{
+				x = i;
+			}
+
+			vector[i] = temp;
+		}
+
+		for (int i = 2; i > 0; --i)
+		{
+			double temp = vector[i];
+			for (int y = i + 1; y <= 2; ++y)
+				temp -= vector[y] * matrix[i][y];
+			vector[i] = temp / matrix[i][i];
+		}
+
+		vector[0] = 1.0;
+	}
+
+	// True if the resulting filter would be unstable
+	static bool QuadraticMerge(Vector& vector)
+	{
+		double v2 = vector[2];
+		double temp = 1.0 - v2 * v2;
+		if (temp == 0.0)
+			return true;
+
+		double v0 = (vector[0] - v2 * v2) / temp;
+		double v1 = (vector[1] - vector[1] * v2) / temp;
+
+		vector[0] = v0;
+		vector[1] = v1;
+
+		return std::fabs(v1) > 1.0;
+	}
+
+	static void FinishRecord(Vector& in, Vector& out)
+	{
+		for (int z = 1; z <= 2; ++z)
+			in[z] = std::clamp(in[z], -0.9999999999, 0.9999999999);
+
+		out[0] = 1.0;
+		out[1] = in[2] * in[1] + in[1];
+		out[2] = in[2];
+	}
+
+	static void MatrixFilter(const Vector& source, Vector& destination)
+	{
+		Matrix matrix;
+
+		matrix[2][0] = 1.0;
+		for (int i = 1; i <= 2; ++i)
+			matrix[2][i] = -source[i];
+
+		for (int i = 2; i > 0; --i)
+		{
+			double value = 1.0 - matrix[i][i] * matrix[i][i];
+			for (int y = 1; y <= i; ++y)
+				matrix[i - 1][y] = (matrix[i][i] * matrix[i][y] + matrix[i][y]) / value;
+		}
+
+		destination[0] = 1.0;
+		for (int i = 1; i <= 2; ++i)
+		{
+			destination[i] = 0.0;
+			for (int y = 1; y <= i; ++y)
+				destination[i] += matrix[i][y] * destination[i - y];
+		}
+	}
+
+	static void MergeFinishRecord(const Vector& source, Vector& destination)
+	{
+		Vector temp = {};
+		double value = source[0];
+
+		destination[0] = 1.0;
+		for (int i = 1; i <= 2; ++i)
+		{
+			double sum = 0.0;
+			for (int y = 1; y < i; ++y)
+				sum += destination[y] * source[i - y];
+
+			destination[i] = value > 0.0 ? -(sum + source[i]) / value : 0.0;
+			temp[i] = destination[i];
+
+			for (int y = 1; y < i; ++y)
+				destination[y] += destination[i] * destination[i - y];
+
+			value *= 1.0 - destination[i] * destination[i];
+		}
+
+		FinishRecord(temp, destination);
+	}
+
+	static double ContrastVectors(const Vector& a, const Vector& b)
+	{
+		double value = (b[2] * b[1] - b[1]) / (1.0 - b[2] * b[2]);
+		double value1 = a[0] * a[0] + a[1] * a[1] + a[2] * a[2];
+		double value2 = a[0] * a[1] + a[1] * a[2];
+		double value3 = a[0] * a[2];
+		return value1 + 2.0 * value * value2 + 2.0 * (-b[1] * value - b[2]) * value3;
+	}
+
+	// Two rounds of k-means over the per-frame predictors
+	static void FilterRecords(std::array<Vector, 8>& best, int count, const std::vector<Vector>& records)
+	{
+		for (int pass = 0; pass < 2; ++pass)
+		{
+			std::array<Vector, 8> sums = {};
+			int counts[8] = {};
+
+			for (const auto& record : records)
+			{
+				int index = 0;
+				double min = 1.0e30;
+				for (int i = 0; i < count; ++i)
+				{
+					double distance = ContrastVectors(best[i], record);
+					if (distance < min)
+					{
+						min = distance;
+						index = i;
+					}
+				}
+
+				Vector filtered;
+				MatrixFilter(record, filtered);
+
+				counts[index]++;
+				for (int i = 0; i <= 2; ++i)
+					sums[index][i] += filtered[i];
+			}
+
+			for (int i = 0; i < count; ++i)
+			{
+				if (counts[i] > 0)
+				{
+					for (int y = 0; y <= 2; ++y)
+						sums[i][y] /= counts[i];
+				}
+			}
+
+			for (int i = 0; i < count; ++i)
+				MergeFinishRecord(sums[i], best[i]);
+		}
+	}
+
+	static int16_t ToCoefficient(double value)
+	{
+		double scaled = -value * 2048.0;
+		return static_cast<int16_t>(std::clamp(std::lround(scaled), -32768l, 32767l));
+	}
+
+	static void CalculateCoefficients(const int16_t* samples, uint32_t frameCount, size_t stride, int16_t (&coefficients)[8][2])
+	{
+		std::vector<Vector> records;
+		records.reserve((frameCount + SamplesPerFrame - 1) / SamplesPerFrame);
+
+		// The previous and current frame, padded with zeros past the end
+		int16_t history[2][14] = {};
+
+		for (uint32_t position = 0; position < frameCount;)
+		{
+			std::copy(history[1], history[1] + 14, history[0]);
+			for (uint32_t z = 0; z < 14; ++z, ++position)
+				history[1][z] = position < frameCount ? samples[position * stride] : 0;
+
+			Vector vector;
+			InnerProductMerge(vector, history[0]);
+			if (std::fabs(vector[0]) <= 10.0)
+				continue;
+
+			Matrix matrix;
+			int indices[3];
+			OuterProductMerge(matrix, history[0]);
+			if (AnalyzeRanges(matrix, indices))
+				continue;
+
+			BidirectionalFilter(matrix, indices, vector);
+			if (QuadraticMerge(vector))
+				continue;
+
+			Vector record;
+			FinishRecord(vector, record);
+			records.push_back(record);
+		}
+
+		std::array<Vector, 8> best = {};
+
+		if (!records.empty())
+		{
+			Vector average = { 1.0, 0.0, 0.0 };
+			for (const auto& record : records)
+			{
+				Vector filtered;
+				MatrixFilter(record, filtered);
+				for (int y = 1; y <= 2; ++y)
+					average[y] += filtered[y];
+			}
+
+			for (int y = 1; y <= 2; ++y)
+				average[y] /= static_cast<double>(records.size());
+
+			MergeFinishRecord(average, best[0]);
+
+			// Split every predictor in two and refine, 1 -> 2 -> 4 -> 8
+			for (int count = 1; count < 8; count *= 2)
+			{
+				for (int i = 0; i < count; ++i)
+				{
+					best[count + i][0] = best[i][0];
+					best[count + i][1] = best[i][1] - 0.01;
+					best[count + i][2] = best[i][2];
+				}
+
+				FilterRecords(best, count * 2, records);
+			}
+		}
+
+		for (int i = 0; i < 8; ++i)
+		{
+			coefficients[i][0] = ToCoefficient(best[i][1]);
+			coefficients[i][1] = ToCoefficient(best[i][2]);
+		}
+	}
+
+	// pcm holds the two previously decoded samples followed by the frame, which is replaced by its
+	// decoded result so the next frame predicts from what the hardware will reconstruct
+	static void EncodeFrame(int16_t (&pcm)[16], uint32_t sampleCount, uint8_t* out, const int16_t (&coefficients)[8][2])
+	{
+		int decoded[8][16];
+		int nibbles[8][14];
+		int scales[8];
+		double errors[8];
+
+		for (int i = 0; i < 8; ++i)
+		{
+			const int coefficient1 = coefficients[i][0];
+			const int coefficient2 = coefficients[i][1];
+
+			decoded[i][0] = pcm[0];
+			decoded[i][1] = pcm[1];
+
+			// Largest residual from the unquantized prediction sets the starting scale
+			int distance = 0;
+			for (uint32_t s = 0; s < sampleCount; ++s)
+			{
+				int prediction = (pcm[s] * coefficient2 + pcm[s + 1] * coefficient1) / 2048;
+				decoded[i][s + 2] = prediction;
+
+				int residual = ClampSample(pcm[s + 2] - prediction);
+				if (std::abs(residual) > std::abs(distance))
+					distance = residual;
+			}
+
+			for (scales[i] = 0; scales[i] <= 12 && (distance > 7 || distance < -8); ++scales[i])
+				distance /= 2;
+			scales[i] = scales[i] <= 1 ? -1 : scales[i] - 2;
+
+			int overflow;
+			do
+			{
+				scales[i]++;
+				errors[i] = 0.0;
+				overflow = 0;
+
+				for (uint32_t s = 0; s < sampleCount; ++s)
+				{
+					int prediction = decoded[i][s] * coefficient2 + decoded[i][s + 1] * coefficient1;
+					int residual = (pcm[s + 2] << 11) - prediction;
+
+					double step = static_cast<double>(residual) / (1 << scales[i]) / 2048;
+					int nibble = residual > 0 ? static_cast<int>(step + 0.4999999f) : static_cast<int>(step - 0.4999999f);
+
+					if (nibble < -8)
+					{
+						overflow = std::max(overflow, -8 - nibble);
+						nibble = -8;
+					}
+					else if (nibble > 7)
+					{
+						overflow = std::max(overflow, nibble - 7);
+						nibble = 7;
+					}
+
+					nibbles[i][s] = nibble;
+
+					int sample = ClampSample((prediction + ((nibble * (1 << scales[i])) << 11) + 1024) >> 11);
+					decoded[i][s + 2] = sample;
+
+					int error = pcm[s + 2] - sample;
+					errors[i] += static_cast<double>(error) * error;
+				}
+
+				for (int x = overflow + 8; x > 256; x >>= 1)
+				{
+					if (++scales[i] >= 12)
+						scales[i] = 11;
+				}
+			} while (scales[i] < 12 && overflow > 1);
+		}
+
+		int best = static_cast<int>(std::min_element(errors, errors + 8) - errors);
+
+		for (uint32_t s = 0; s < sampleCount; ++s)
+			pcm[s + 2] = static_cast<int16_t>(decoded[best][s + 2]);
+
+		for (uint32_t s = sampleCount; s < SamplesPerFrame; ++s)
+			nibbles[best][s] = 0;
+
+		out[0] = static_cast<uint8_t>((best << 4) | (scales[best] & 0xF));
+		for (int y = 0; y < 7; ++y)
+			out[y + 1] = static_cast<uint8_t>((nibbles[best][y * 2] << 4) | (nibbles[best][y * 2 + 1] & 0xF));
+	}
+
+	static uint32_t SampleToNibble(uint32_t sample)
+	{
+		return sample / SamplesPerFrame * NibblesPerFrame + sample % SamplesPerFrame + 2;
+	}
+
+	static uint32_t GetNibbleCount(uint32_t sampleCount)
+	{
+		uint32_t remainder = sampleCount % SamplesPerFrame;
+		return sampleCount / SamplesPerFrame * NibblesPerFrame + (remainder ? remainder + 2 : 0);
+	}
+
+	static void WriteBE16(uint8_t* out, uint16_t value)
+	{
+		out[0] = static_cast<uint8_t>(value >> 8);
+		out[1] = static_cast<uint8_t>(value);
+	}
+
+	static void WriteBE32(uint8_t* out, uint32_t value)
+	{
+		WriteBE16(out, static_cast<uint16_t>(value >> 16));
+		WriteBE16(out + 2, static_cast<uint16_t>(value));
+	}
+
+	std::vector<uint8_t> EncodeDSPADPCM(const int16_t* samples, uint32_t frameCount, size_t stride, uint32_t sampleRate)
+	{
+		int16_t coefficients[8][2];
+		CalculateCoefficients(samples, frameCount, stride, coefficients);
+
+		const uint32_t adpcmFrames = (frameCount + SamplesPerFrame - 1) / SamplesPerFrame;
+		std::vector<uint8_t> result(HeaderSize + static_cast<size_t>(adpcmFrames) * BytesPerFrame, 0);
+		uint8_t* data = result.data() + HeaderSize;
+
+		int16_t pcm[16] = {};
+		for (uint32_t frame = 0; frame < adpcmFrames; ++frame)
+		{
+			uint32_t first = frame * SamplesPerFrame;
+			uint32_t sampleCount = std::min(SamplesPerFrame, frameCount - first);
+
+			for (uint32_t s = 0; s < SamplesPerFrame; ++s)
+				pcm[s + 2] = s < sampleCount ? samples[(first + s) * stride] : 0;
+
+			// The zero padded tail of the last frame is encoded as well, like the reference encoder does
+			EncodeFrame(pcm, SamplesPerFrame, data + frame * BytesPerFrame, coefficients);
+
+			pcm[0] = pcm[14];
+			pcm[1] = pcm[15];
+		}
+
+		uint8_t* header = result.data();
+		WriteBE32(header + 0x00, frameCount);
+		WriteBE32(header + 0x04, GetNibbleCount(frameCount));
+		WriteBE32(header + 0x08, sampleRate);
+
+		// Not looping by default, the loop region covers the whole clip for when playback loops it
+		WriteBE16(header + 0x0C, 0);
+		WriteBE16(header + 0x0E, 0);
+		WriteBE32(header + 0x10, SampleToNibble(0));
+		WriteBE32(header + 0x14, SampleToNibble(frameCount > 0 ? frameCount - 1 : 0));
+		WriteBE32(header + 0x18, SampleToNibble(0));
+
+		for (int i = 0; i < 8; ++i)
+		{
+			WriteBE16(header + 0x1C + i * 4, static_cast<uint16_t>(coefficients[i][0]));
+			WriteBE16(header + 0x1E + i * 4, static_cast<uint16_t>(coefficients[i][1]));
+		}
+
+		// Gain, then the initial predictor/scale and history
+		WriteBE16(header + 0x3C, 0);
+		WriteBE16(header + 0x3E, adpcmFrames > 0 ? data[0] : 0);
+		WriteBE16(header + 0x40, 0);
+		WriteBE16(header + 0x42, 0);
+
+		// Loop context stays zero for clips that don't loop, as VGAudio writes it
+		WriteBE16(header + 0x44, 0);
+		WriteBE16(header + 0x46, 0);
+		WriteBE16(header + 0x48, 0);
+
+		// The last frame only keeps the bytes holding its samples
+		result.resize(HeaderSize + (GetNibbleCount(frameCount) + 1) / 2);
+		return result;
+	}
+}
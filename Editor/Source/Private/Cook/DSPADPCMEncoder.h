@@ -0,0 +1,16 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace Nightbird::Editor
+{
+	// In-process replacement for VGAudioCli. Encodes one channel as a standard .dsp file: the
+	// 96-byte big-endian header with the channel's coefficients and loop context, followed by
+	// 8-byte frames of 14 samples each, the last one cut after its final sample. Byte for byte what
+	// VGAudio writes, and the per-channel blob AudioBuffer reads on the 3DS.
+	// samples holds frameCount samples spaced stride apart, so a channel of interleaved audio can be
+	// passed directly. Thread safe, channels and clips can be encoded in parallel.
+	std::vector<uint8_t> EncodeDSPADPCM(const int16_t* samples, uint32_t frameCount, size_t stride, uint32_t sampleRate);
+}
@@ -8,7 +8,7 @@
 
 namespace Nightbird::Editor
 {
-	void MaterialCooker::Cook(const Core::Material& material, const uuids::uuid& uuid, const std::filesystem::path& outputDir, Endianness endianness, const std::unordered_map<const Core::Texture*, uuids::uuid>& textureUUIDs)
+	bool MaterialCooker::Cook(const Core::Material& material, const uuids::uuid& uuid, const std::filesystem::path& outputDir, Endianness endianness, const std::unordered_map<const Core::Texture*, uuids::uuid>& textureUUIDs)
 	{
 		std::filesystem::create_directories(outputDir);
 
@@ -72,5 +72,13 @@ namespace Nightbird::Editor
 				writer.WriteRawBytes(reinterpret_cast<const uint8_t*>(bytes.data()), bytes.size());
 			}
 		}
+
+		if (!writer.Close())
+		{
+			Core::Log::Error("MaterialCooker: Failed to write: " + outputPath.string());
+			return false;
+		}
+
+		return true;
 	}
 }
\ No newline at end of file
@@ -17,6 +17,8 @@ namespace Nightbird::Editor
 	class MaterialCooker
 	{
 	public:
-		void Cook(const Core::Material& material, const uuids::uuid& uuid, const std::filesystem::path& outputDir, Endianness endianness, const std::unordered_map<const Core::Texture*, uuids::uuid>& textureUUIDs);
+		static constexpr uint32_t Version = 1;
+
+		bool Cook(const Core::Material& material, const uuids::uuid& uuid, const std::filesystem::path& outputDir, Endianness endianness, const std::unordered_map<const Core::Texture*, uuids::uuid>& textureUUIDs);
 	};
 }
\ No newline at end of file
@@ -9,7 +9,7 @@
 
 namespace Nightbird::Editor
 {
-	void MeshCooker::Cook(const Core::Mesh& mesh, const uuids::uuid& uuid,
+	bool MeshCooker::Cook(const Core::Mesh& mesh, const uuids::uuid& uuid,
 		const std::filesystem::path& outputDir, Endianness endianness,
 		const std::unordered_map<const Core::Material*, uuids::uuid>& materialUUIDs)
 	{
@@ -63,6 +63,13 @@ namespace Nightbird::Editor
 			}
 		}
 
+		if (!writer.Close())
+		{
+			Core::Log::Error("MeshCooker: Failed to write: " + outputPath.string());
+			return false;
+		}
+
 		Core::Log::Info("Cooked mesh: " + outputPath.string());
+		return true;
 	}
 }
\ No newline at end of file
@@ -18,7 +18,9 @@ namespace Nightbird::Editor
 	class MeshCooker
 	{
 	public:
-		void Cook(const Core::Mesh& mesh, const uuids::uuid& uuid,
+		static constexpr uint32_t Version = 1;
+
+		bool Cook(const Core::Mesh& mesh, const uuids::uuid& uuid,
 			const std::filesystem::path& outputDir, Endianness endianness,
 			const std::unordered_map<const Core::Material*, uuids::uuid>& materialUUIDs);
 	};
@@ -0,0 +1,103 @@
+#include "Cook/PakCooker.h"
+
+#include "Cook/BinaryWriter.h"
+
+#include "Core/Log.h"
+
+#include <algorithm>
+#include <fstream>
+
+namespace Nightbird::Editor
+{
+	static uint32_t AlignUp(uint32_t value)
+	{
+		return (value + Core::Pak::Alignment - 1) & ~(Core::Pak::Alignment - 1);
+	}
+
+	bool PakCooker::Cook(std::vector<Entry> entries, const std::filesystem::path& outputDir, Endianness endianness)
+	{
+		// Skip anything that failed to cook
+		entries.erase(std::remove_if(entries.begin(), entries.end(), [](const Entry& entry)
+		{
+			if (std::filesystem::exists(entry.path))
+				return false;
+
+			Core::Log::Warning("PakCooker: Missing cooked file: " + entry.path.string());
+			return true;
+		}), entries.end());
+
+		// Sorted TOC lets the runtime binary search it
+		std::sort(entries.begin(), entries.end(), [](const Entry& a, const Entry& b) { return a.uuid < b.uuid; });
+
+		auto duplicate = std::adjacent_find(entries.begin(), entries.end(), [](const Entry& a, const Entry& b) { return a.uuid == b.uuid; });
+		if (duplicate != entries.end())
+		{
+			Core::Log::Error("PakCooker: Duplicate UUID: " + uuids::to_string(duplicate->uuid));
+			return false;
+		}
+
+		std::vector<uint32_t> offsets(entries.size());
+		std::vector<uint32_t> sizes(entries.size());
+
+		uint32_t offset = AlignUp(Core::Pak::HeaderSize + static_cast<uint32_t>(entries.size()) * Core::Pak::EntrySize);
+		for (size_t i = 0; i < entries.size(); ++i)
+		{
+			offsets[i] = offset;
+			sizes[i] = static_cast<uint32_t>(std::filesystem::file_size(entries[i].path));
+			offset = AlignUp(offset + sizes[i]);
+		}
+
+		std::filesystem::path outputPath = outputDir / Core::Pak::FileName;
+		BinaryWriter writer(outputPath, endianness);
+
+		// Type signature
+		writer.WriteUInt8('N');
+		writer.WriteUInt8('P');
+		writer.WriteUInt8('A');
+		writer.WriteUInt8('K');
+
+		// Version
+		writer.WriteUInt32(Core::Pak::Version);
+
+		writer.WriteUInt32(static_cast<uint32_t>(entries.size()));
+		writer.WriteUInt32(0); // Reserved
+
+		const uint8_t padding[Core::Pak::Alignment] = {};
+
+		for (size_t i = 0; i < entries.size(); ++i)
+		{
+			auto bytes = entries[i].uuid.as_bytes();
+			writer.WriteRawBytes(reinterpret_cast<const uint8_t*>(bytes.data()), 16);
+			writer.WriteUInt32(offsets[i]);
+			writer.WriteUInt32(sizes[i]);
+			writer.WriteUInt8(static_cast<uint8_t>(entries[i].type));
+			writer.WriteUInt8(0); // Flags
+			writer.WriteRawBytes(padding, 6);
+		}
+
+		uint32_t position = Core::Pak::HeaderSize + static_cast<uint32_t>(entries.size()) * Core::Pak::EntrySize;
+		std::vector<uint8_t> data;
+
+		for (size_t i = 0; i < entries.size(); ++i)
+		{
+			writer.WriteRawBytes(padding, offsets[i] - position);
+
+			// Cooked files are already in the target's byte order, copied as is
+			data.resize(sizes[i]);
+			std::ifstream file(entries[i].path, std::ios::binary);
+			file.read(reinterpret_cast<char*>(data.data()), data.size());
+			writer.WriteRawBytes(data.data(), data.size());
+
+			position = offsets[i] + sizes[i];
+		}
+
+		if (!writer.Close())
+		{
+			Core::Log::Error("PakCooker: Failed to write: " + outputPath.string());
+			return false;
+		}
+
+		Core::Log::Info("PakCooker: Written .nbpak with " + std::to_string(entries.size()) + " entries: " + outputPath.string());
+		return true;
+	}
+}
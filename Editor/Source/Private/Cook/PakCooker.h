@@ -0,0 +1,27 @@
+#pragma once
+
+#include "Cook/Endianness.h"
+
+#include "Core/PakFile.h"
+
+#include <uuid.h>
+
+#include <filesystem>
+#include <vector>
+
+namespace Nightbird::Editor
+{
+	// Packs already cooked files into a single .nbpak, the loose files are left in place
+	class PakCooker
+	{
+	public:
+		struct Entry
+		{
+			uuids::uuid uuid;
+			std::filesystem::path path;
+			Core::PakEntryType type;
+		};
+
+		bool Cook(std::vector<Entry> entries, const std::filesystem::path& outputDir, Endianness endianness);
+	};
+}
@@ -6,7 +6,7 @@
 
 namespace Nightbird::Editor
 {
-	void ProjectCooker::Cook(const uuids::uuid& mainSceneUUID, const std::filesystem::path& outputDir, Endianness endianness)
+	bool ProjectCooker::Cook(const uuids::uuid& mainSceneUUID, const std::filesystem::path& outputDir, Endianness endianness)
 	{
 		std::filesystem::create_directories(outputDir);
 		std::filesystem::path outputPath = outputDir / "Project.nbproject";
@@ -24,6 +24,13 @@ namespace Nightbird::Editor
 		auto bytes = mainSceneUUID.as_bytes();
 		writer.WriteRawBytes(reinterpret_cast<const uint8_t*>(bytes.data()), 16);
 
+		if (!writer.Close())
+		{
+			Core::Log::Error("ProjectCooker: Failed to write: " + outputPath.string());
+			return false;
+		}
+
 		Core::Log::Info("ProjectCooker: Written .nbproject: " + outputPath.string());
+		return true;
 	}
 }
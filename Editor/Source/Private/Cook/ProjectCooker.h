@@ -11,6 +11,6 @@ namespace Nightbird::Editor
 	class ProjectCooker
 	{
 	public:
-		void Cook(const uuids::uuid& mainSceneUUID, const std::filesystem::path& outputDir, Endianness Endianness);
+		bool Cook(const uuids::uuid& mainSceneUUID, const std::filesystem::path& outputDir, Endianness Endianness);
 	};
 }
@@ -0,0 +1,497 @@
+#include "Cook/T3XEncoder.h"
+
+#include <algorithm>
+#include <climits>
+#include <cmath>
+#include <cstring>
+
+namespace Nightbird::Editor
+{
+	static constexpr uint32_t TileSize = 8;
+	static constexpr uint32_t MinSize = 8;
+	static constexpr uint32_t MaxSize = 1024;
+
+	// Fixed point scale of the sub-texture coordinates in the .t3x header
+	static constexpr uint16_t CoordinateScale = 1024;
+
+	static constexpr uint8_t CompressionNone = 0x00;
+	static constexpr uint8_t CompressionLZ11 = 0x11;
+
+	static constexpr uint32_t LZ11MaxDistance = 0x1000;
+	static constexpr uint32_t LZ11MaxLength = 0x10110;
+	static constexpr uint32_t LZ11HashBits = 15;
+	static constexpr uint32_t LZ11MaxChain = 32;
+
+	static const int s_ETC1Modifiers[8][2] = {
+		{ 2, 8 }, { 5, 17 }, { 9, 29 }, { 13, 42 }, { 18, 60 }, { 24, 80 }, { 33, 106 }, { 47, 183 }
+	};
+
+	static bool IsPow2(uint32_t value)
+	{
+		return value != 0 && (value & (value - 1)) == 0;
+	}
+
+	static uint32_t Log2(uint32_t value)
+	{
+		uint32_t result = 0;
+		while (value >>= 1)
+			++result;
+		return result;
+	}
+
+	// Rounds an 8-bit channel to the given number of bits
+	static uint32_t Quantize(uint8_t value, uint32_t bits)
+	{
+		uint32_t max = (1u << bits) - 1;
+		return (value * max + 127) / 255;
+	}
+
+	static void WriteUInt16(std::vector<uint8_t>& out, uint16_t value)
+	{
+		out.push_back(static_cast<uint8_t>(value));
+		out.push_back(static_cast<uint8_t>(value >> 8));
+	}
+
+	static void WriteUInt64(std::vector<uint8_t>& out, uint64_t value)
+	{
+		for (int i = 0; i < 8; ++i)
+			out.push_back(static_cast<uint8_t>(value >> (i * 8)));
+	}
+
+	// Morton order of the 64 texels in a tile: x in bits 0, 2, 4 and y in bits 1, 3, 5
+	static void GetMortonPosition(uint32_t index, uint32_t& x, uint32_t& y)
+	{
+		x = (index & 1) | ((index >> 1) & 2) | ((index >> 2) & 4);
+		y = ((index >> 1) & 1) | ((index >> 2) & 2) | ((index >> 3) & 4);
+	}
+
+	static void WriteTexel(std::vector<uint8_t>& out, const uint8_t* pixel, T3XFormat format)
+	{
+		switch (format)
+		{
+		case T3XFormat::RGBA8:
+			out.push_back(pixel[3]);
+			out.push_back(pixel[2]);
+			out.push_back(pixel[1]);
+			out.push_back(pixel[0]);
+			break;
+		case T3XFormat::RGB8:
+			out.push_back(pixel[2]);
+			out.push_back(pixel[1]);
+			out.push_back(pixel[0]);
+			break;
+		case T3XFormat::RGBA5551:
+			WriteUInt16(out, static_cast<uint16_t>((Quantize(pixel[0], 5) << 11) | (Quantize(pixel[1], 5) << 6) | (Quantize(pixel[2], 5) << 1) | Quantize(pixel[3], 1)));
+			break;
+		case T3XFormat::RGB565:
+			WriteUInt16(out, static_cast<uint16_t>((Quantize(pixel[0], 5) << 11) | (Quantize(pixel[1], 6) << 5) | Quantize(pixel[2], 5)));
+			break;
+		case T3XFormat::RGBA4:
+			WriteUInt16(out, static_cast<uint16_t>((Quantize(pixel[0], 4) << 12) | (Quantize(pixel[1], 4) << 8) | (Quantize(pixel[2], 4) << 4) | Quantize(pixel[3], 4)));
+			break;
+		default:
+			break;
+		}
+	}
+
+	static int Clamp255(int value)
+	{
+		return std::clamp(value, 0, 255);
+	}
+
+	// Picks the codeword table and per texel modifiers for one half of an ETC1 block.
+	// Texels are indexed x * 4 + y like the ETC1 selector bits.
+	static uint32_t FitETC1Subblock(const uint8_t (&block)[16][4], const uint32_t (&texels)[8], const int (&base)[3], uint32_t& outTable, uint8_t (&selectors)[16])
+	{
+		uint32_t bestError = UINT_MAX;
+
+		for (uint32_t table = 0; table < 8; ++table)
+		{
+			const int modifiers[4] = { s_ETC1Modifiers[table][0], s_ETC1Modifiers[table][1], -s_ETC1Modifiers[table][0], -s_ETC1Modifiers[table][1] };
+
+			uint32_t error = 0;
+			uint8_t tableSelectors[8];
+
+			for (uint32_t i = 0; i < 8 && error < bestError; ++i)
+			{
+				const uint8_t* texel = block[texels[i]];
+				uint32_t bestTexelError = UINT_MAX;
+
+				for (uint8_t selector = 0; selector < 4; ++selector)
+				{
+					uint32_t texelError = 0;
+					for (int channel = 0; channel < 3; ++channel)
+					{
+						int difference = Clamp255(base[channel] + modifiers[selector]) - texel[channel];
+						texelError += static_cast<uint32_t>(difference * difference);
+					}
+
+					if (texelError < bestTexelError)
+					{
+						bestTexelError = texelError;
+						tableSelectors[i] = selector;
+					}
+				}
+
+				error += bestTexelError;
+			}
+
+			if (error < bestError)
+			{
+				bestError = error;
+				outTable = table;
+				for (uint32_t i = 0; i < 8; ++i)
+					selectors[texels[i]] = tableSelectors[i];
+			}
+		}
+
+		return bestError;
+	}
+
+	// Tries both sub-block orientations in differential and individual mode, keeps the closest
+	static uint64_t EncodeETC1Block(const uint8_t (&block)[16][4])
+	{
+		uint64_t best = 0;
+		uint32_t bestError = UINT_MAX;
+
+		for (uint32_t flip = 0; flip < 2; ++flip)
+		{
+			// Left and right halves, or top and bottom when flipped
+			uint32_t halves[2][8];
+			uint32_t counts[2] = {};
+			for (uint32_t i = 0; i < 16; ++i)
+			{
+				uint32_t x = i / 4;
+				uint32_t y = i % 4;
+				uint32_t half = flip ? (y >= 2) : (x >= 2);
+				halves[half][counts[half]++] = i;
+			}
+
+			float averages[2][3] = {};
+			for (uint32_t half = 0; half < 2; ++half)
+			{
+				for (uint32_t i = 0; i < 8; ++i)
+				{
+					for (int channel = 0; channel < 3; ++channel)
+						averages[half][channel] += block[halves[half][i]][channel] / 8.0f;
+				}
+			}
+
+			for (uint32_t differential = 0; differential < 2; ++differential)
+			{
+				const uint32_t bits = differential ? 5 : 4;
+				const float max = static_cast<float>((1u << bits) - 1);
+
+				int colors[2][3];
+				int bases[2][3];
+				for (uint32_t half = 0; half < 2; ++half)
+				{
+					for (int channel = 0; channel < 3; ++channel)
+					{
+						colors[half][channel] = static_cast<int>(std::lround(averages[half][channel] * max / 255.0f));
+						bases[half][channel] = differential
+							? (colors[half][channel] << 3) | (colors[half][channel] >> 2)
+							: colors[half][channel] * 17;
+					}
+				}
+
+				if (differential)
+				{
+					bool fits = true;
+					for (int channel = 0; channel < 3; ++channel)
+					{
+						int delta = colors[1][channel] - colors[0][channel];
+						fits = fits && delta >= -4 && delta <= 3;
+					}
+
+					if (!fits)
+						continue;
+				}
+
+				uint32_t tables[2];
+				uint8_t selectors[16];
+				uint32_t error = FitETC1Subblock(block, halves[0], bases[0], tables[0], selectors);
+				error += FitETC1Subblock(block, halves[1], bases[1], tables[1], selectors);
+
+				if (error >= bestError)
+					continue;
+
+				uint32_t high = 0;
+				if (differential)
+				{
+					for (int channel = 0; channel < 3; ++channel)
+					{
+						uint32_t shift = 27 - channel * 8;
+						high |= static_cast<uint32_t>(colors[0][channel]) << shift;
+						high |= static_cast<uint32_t>((colors[1][channel] - colors[0][channel]) & 7) << (shift - 3);
+					}
+				}
+				else
+				{
+					for (int channel = 0; channel < 3; ++channel)
+					{
+						uint32_t shift = 28 - channel * 8;
+						high |= static_cast<uint32_t>(colors[0][channel]) << shift;
+						high |= static_cast<uint32_t>(colors[1][channel]) << (shift - 4);
+					}
+				}
+
+				high |= (tables[0] << 5) | (tables[1] << 2) | (differential << 1) | flip;
+
+				uint32_t low = 0;
+				for (uint32_t i = 0; i < 16; ++i)
+					low |= ((selectors[i] >> 1u) << (i + 16)) | ((selectors[i] & 1u) << i);
+
+				best = (static_cast<uint64_t>(high) << 32) | low;
+				bestError = error;
+			}
+		}
+
+		return best;
+	}
+
+	static void EncodeLevel(std::vector<uint8_t>& out, const uint8_t* pixels, uint32_t width, uint32_t height, T3XFormat format)
+	{
+		const bool etc = format == T3XFormat::ETC1 || format == T3XFormat::ETC1A4;
+
+		// Rows are stored bottom-up, so row y of the texture is row height - 1 - y of the image
+		auto getPixel = [&](uint32_t x, uint32_t y) { return pixels + (static_cast<size_t>(height - 1 - y) * width + x) * 4; };
+
+		for (uint32_t tileY = 0; tileY < height; tileY += TileSize)
+		{
+			for (uint32_t tileX = 0; tileX < width; tileX += TileSize)
+			{
+				if (!etc)
+				{
+					for (uint32_t index = 0; index < TileSize * TileSize; ++index)
+					{
+						uint32_t x, y;
+						GetMortonPosition(index, x, y);
+						WriteTexel(out, getPixel(tileX + x, tileY + y), format);
+					}
+					continue;
+				}
+
+				// Four 4x4 blocks per tile in Z order, each stored little-endian
+				for (uint32_t blockY = 0; blockY < TileSize; blockY += 4)
+				{
+					for (uint32_t blockX = 0; blockX < TileSize; blockX += 4)
+					{
+						uint8_t block[16][4];
+						uint64_t alpha = 0;
+
+						for (uint32_t i = 0; i < 16; ++i)
+						{
+							const uint8_t* pixel = getPixel(tileX + blockX + i / 4, tileY + blockY + i % 4);
+							std::memcpy(block[i], pixel, 4);
+							alpha |= static_cast<uint64_t>(Quantize(pixel[3], 4)) << (i * 4);
+						}
+
+						if (format == T3XFormat::ETC1A4)
+							WriteUInt64(out, alpha);
+
+						WriteUInt64(out, EncodeETC1Block(block));
+					}
+				}
+			}
+		}
+	}
+
+	static std::vector<uint8_t> Downsample(const uint8_t* pixels, uint32_t width, uint32_t height)
+	{
+		uint32_t halfWidth = width / 2;
+		uint32_t halfHeight = height / 2;
+		std::vector<uint8_t> result(static_cast<size_t>(halfWidth) * halfHeight * 4);
+
+		for (uint32_t y = 0; y < halfHeight; ++y)
+		{
+			for (uint32_t x = 0; x < halfWidth; ++x)
+			{
+				const uint8_t* topLeft = pixels + (static_cast<size_t>(y * 2) * width + x * 2) * 4;
+				const uint8_t* bottomLeft = topLeft + static_cast<size_t>(width) * 4;
+				uint8_t* target = result.data() + (static_cast<size_t>(y) * halfWidth + x) * 4;
+
+				for (int channel = 0; channel < 4; ++channel)
+					target[channel] = static_cast<uint8_t>((topLeft[channel] + topLeft[channel + 4] + bottomLeft[channel] + bottomLeft[channel + 4] + 2) / 4);
+			}
+		}
+
+		return result;
+	}
+
+	static void WriteCompressionHeader(std::vector<uint8_t>& out, uint8_t type, size_t size)
+	{
+		// Sizes that don't fit in 24 bits are stored as 0 followed by the full 32-bit size
+		bool extended = size > 0xFFFFFF;
+		uint32_t shortSize = extended ? 0 : static_cast<uint32_t>(size);
+
+		out.push_back(type);
+		out.push_back(static_cast<uint8_t>(shortSize));
+		out.push_back(static_cast<uint8_t>(shortSize >> 8));
+		out.push_back(static_cast<uint8_t>(shortSize >> 16));
+
+		if (extended)
+		{
+			for (int i = 0; i < 4; ++i)
+				out.push_back(static_cast<uint8_t>(size >> (i * 8)));
+		}
+	}
+
+	// Greedy LZ11 with hash chains, the format libctru's decompress reads
+	static void CompressLZ11(std::vector<uint8_t>& out, const std::vector<uint8_t>& input)
+	{
+		WriteCompressionHeader(out, CompressionLZ11, input.size());
+
+		const size_t size = input.size();
+		std::vector<int32_t> heads(1u << LZ11HashBits, -1);
+		std::vector<int32_t> previous(size, -1);
+
+		auto insert = [&](size_t position)
+		{
+			if (position + 2 >= size)
+				return;
+
+			uint32_t hash = ((input[position] << 16) | (input[position + 1] << 8) | input[position + 2]) * 2654435761u >> (32 - LZ11HashBits);
+			previous[position] = heads[hash];
+			heads[hash] = static_cast<int32_t>(position);
+		};
+
+		auto findMatch = [&](size_t position, uint32_t& outDistance) -> uint32_t
+		{
+			if (position + 2 >= size)
+				return 0;
+
+			uint32_t hash = ((input[position] << 16) | (input[position + 1] << 8) | input[position + 2]) * 2654435761u >> (32 - LZ11HashBits);
+			uint32_t maxLength = static_cast<uint32_t>(std::min<size_t>(LZ11MaxLength, size - position));
+			uint32_t bestLength = 0;
+
+			int32_t candidate = heads[hash];
+			for (uint32_t chain = 0; candidate >= 0 && chain < LZ11MaxChain; ++chain)
+			{
+				size_t distance = position - static_cast<size_t>(candidate);
+				if (distance > LZ11MaxDistance)
+					break;
+
+				uint32_t length = 0;
+				while (length < maxLength && input[candidate + length] == input[position + length])
+					++length;
+
+				if (length > bestLength)
+				{
+					bestLength = length;
+					outDistance = static_cast<uint32_t>(distance);
+					if (length == maxLength)
+						break;
+				}
+
+				candidate = previous[candidate];
+			}
+
+			return bestLength >= 3 ? bestLength : 0;
+		};
+
+		size_t position = 0;
+		while (position < size)
+		{
+			size_t flagsPosition = out.size();
+			out.push_back(0);
+
+			for (int bit = 7; bit >= 0 && position < size; --bit)
+			{
+				uint32_t distance = 0;
+				uint32_t length = findMatch(position, distance);
+
+				if (length == 0)
+				{
+					out.push_back(input[position]);
+					insert(position);
+					++position;
+					continue;
+				}
+
+				out[flagsPosition] |= static_cast<uint8_t>(1 << bit);
+				uint32_t displacement = distance - 1;
+
+				if (length <= 0x10)
+				{
+					out.push_back(static_cast<uint8_t>(((length - 1) << 4) | (displacement >> 8)));
+				}
+				else if (length <= 0x110)
+				{
+					uint32_t value = length - 0x11;
+					out.push_back(static_cast<uint8_t>(value >> 4));
+					out.push_back(static_cast<uint8_t>(((value & 0xF) << 4) | (displacement >> 8)));
+				}
+				else
+				{
+					uint32_t value = length - 0x111;
+					out.push_back(static_cast<uint8_t>(0x10 | (value >> 12)));
+					out.push_back(static_cast<uint8_t>(value >> 4));
+					out.push_back(static_cast<uint8_t>(((value & 0xF) << 4) | (displacement >> 8)));
+				}
+				out.push_back(static_cast<uint8_t>(displacement));
+
+				for (uint32_t i = 0; i < length; ++i)
+					insert(position + i);
+				position += length;
+			}
+		}
+	}
+
+	std::vector<uint8_t> EncodeT3X(const uint8_t* pixels, uint32_t width, uint32_t height, T3XFormat format, uint32_t mipLevels)
+	{
+		if (!IsPow2(width) || !IsPow2(height) || width < MinSize || height < MinSize || width > MaxSize || height > MaxSize)
+			return {};
+
+		// Mip levels stop at the 8x8 tile size
+		mipLevels = std::min(mipLevels, Log2(std::min(width, height) / MinSize));
+
+		std::vector<uint8_t> texels;
+		std::vector<uint8_t> level;
+		const uint8_t* levelPixels = pixels;
+		uint32_t levelWidth = width;
+		uint32_t levelHeight = height;
+
+		for (uint32_t i = 0; i <= mipLevels; ++i)
+		{
+			if (i > 0)
+			{
+				level = Downsample(levelPixels, levelWidth, levelHeight);
+				levelPixels = level.data();
+				levelWidth /= 2;
+				levelHeight /= 2;
+			}
+
+			EncodeLevel(texels, levelPixels, levelWidth, levelHeight, format);
+		}
+
+		std::vector<uint8_t> out;
+
+		// Header, one sub-texture, 2D
+		WriteUInt16(out, 1);
+		out.push_back(static_cast<uint8_t>((Log2(width) - 3) | ((Log2(height) - 3) << 3)));
+		out.push_back(static_cast<uint8_t>(format));
+		out.push_back(static_cast<uint8_t>(mipLevels));
+
+		// Sub-texture size and its left, top, right and bottom coordinates
+		WriteUInt16(out, static_cast<uint16_t>(width));
+		WriteUInt16(out, static_cast<uint16_t>(height));
+		WriteUInt16(out, 0);
+		WriteUInt16(out, CoordinateScale);
+		WriteUInt16(out, CoordinateScale);
+		WriteUInt16(out, 0);
+
+		size_t headerSize = out.size();
+		CompressLZ11(out, texels);
+
+		// Keep whichever is smaller, like tex3ds does when picking the compression automatically
+		if (out.size() - headerSize > texels.size() + 8)
+		{
+			out.resize(headerSize);
+			WriteCompressionHeader(out, CompressionNone, texels.size());
+			out.insert(out.end(), texels.begin(), texels.end());
+		}
+
+		return out;
+	}
+}
@@ -0,0 +1,26 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+namespace Nightbird::Editor
+{
+	// Values match GPU_TEXCOLOR, they are written to the .t3x header as is
+	enum class T3XFormat : uint8_t
+	{
+		RGBA8 = 0x0,
+		RGB8 = 0x1,
+		RGBA5551 = 0x2,
+		RGB565 = 0x3,
+		RGBA4 = 0x4,
+		ETC1 = 0xC,
+		ETC1A4 = 0xD
+	};
+
+	// In-process replacement for tex3ds. Produces the .t3x layout citro3d's Tex3DS_TextureImport reads:
+	// header, one sub-texture covering the whole image, then the LZ11 compressed texel data of every
+	// mip level, flipped to bottom-up rows and swizzled into Morton ordered 8x8 tiles.
+	// pixels are RGBA8 rows from the top, width and height are powers of two from 8 to 1024.
+	// Returns an empty vector if the size is not supported.
+	std::vector<uint8_t> EncodeT3X(const uint8_t* pixels, uint32_t width, uint32_t height, T3XFormat format, uint32_t mipLevels = 0);
+}
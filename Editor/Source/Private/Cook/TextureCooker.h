@@ -18,10 +18,13 @@ namespace Nightbird::Editor
 	class TextureCooker
 	{
 	public:
-		void Cook(const Core::Texture& texture, const uuids::uuid& uuid, const std::filesystem::path& outputDir, CookTarget target, Endianness endianness);
+		// Bump when the cooked output changes for the same input, forces a re-cook
+		static constexpr uint32_t Version = 2;
+
+		bool Cook(const Core::Texture& texture, const uuids::uuid& uuid, const std::filesystem::path& outputDir, CookTarget target, Endianness endianness);
 
 	private:
 		std::vector<uint8_t> CookRGBA(const Core::Texture& texture);
-		std::vector<uint8_t> CookT3X(const Core::Texture& texture, const uuids::uuid& uuid);
+		std::vector<uint8_t> CookT3X(const Core::Texture& texture);
 	};
 }
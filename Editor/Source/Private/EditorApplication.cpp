@@ -168,6 +168,9 @@ namespace Nightbird::Editor
 			}
 		);
 
+		// Project types extend the hierarchy built by InitReflection
+		TypeRegistry::BuildHierarchy();
+
 		return 0;
 	}
 
@@ -238,6 +241,7 @@ namespace Nightbird::Editor
 	void EditorApplication::InitializeCookManager()
 	{
 		m_CookManager = std::make_unique<CookManager>("Cooked", *m_ImportManager);
+		m_CookManager->SetJobSystem(&m_Engine->GetJobSystem());
 	}
 
 	void EditorApplication::RunEditorLoop()
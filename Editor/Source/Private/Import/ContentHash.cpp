@@ -0,0 +1,118 @@
+#include "Import/ContentHash.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <vector>
+
+namespace Nightbird::Editor
+{
+	static constexpr uint64_t Prime1 = 0x9E3779B185EBCA87ull;
+	static constexpr uint64_t Prime2 = 0xC2B2AE3D27D4EB4Full;
+
+	// Namespace for content UUIDs, never change it or every cooked asset gets renamed
+	static const uuids::uuid s_ContentNamespace{ { 0x4e, 0x42, 0x2d, 0x63, 0x6f, 0x6f, 0x6b, 0x2d, 0x9c, 0x41, 0x7a, 0x0e, 0x53, 0xd2, 0x18, 0x6b } };
+
+	static uint64_t Rotate(uint64_t value, int bits)
+	{
+		return (value << bits) | (value >> (64 - bits));
+	}
+
+	static uint64_t Mix(uint64_t hash, uint64_t word)
+	{
+		return Rotate(hash ^ (word * Prime2), 31) * Prime1;
+	}
+
+	void ContentHasher::Update(const void* data, size_t size)
+	{
+		const uint8_t* bytes = static_cast<const uint8_t*>(data);
+		m_Length += size;
+
+		while (size >= 8)
+		{
+			uint64_t word;
+			std::memcpy(&word, bytes, 8);
+			m_Hash = Mix(m_Hash, word);
+			bytes += 8;
+			size -= 8;
+		}
+
+		if (size > 0)
+		{
+			uint64_t word = 0;
+			std::memcpy(&word, bytes, size);
+			m_Hash = Mix(m_Hash, word ^ (static_cast<uint64_t>(size) << 56));
+		}
+	}
+
+	void ContentHasher::Update(std::string_view string)
+	{
+		UpdateValue(static_cast<uint64_t>(string.size()));
+		Update(string.data(), string.size());
+	}
+
+	void ContentHasher::Update(const uuids::uuid& uuid)
+	{
+		Update(uuid.as_bytes().data(), 16);
+	}
+
+	uint64_t ContentHasher::Finish() const
+	{
+		uint64_t hash = m_Hash ^ m_Length;
+		hash ^= hash >> 33;
+		hash *= 0xFF51AFD7ED558CCDull;
+		hash ^= hash >> 33;
+		hash *= 0xC4CEB9FE1A85EC53ull;
+		hash ^= hash >> 33;
+		return hash;
+	}
+
+	bool HashFile(const std::filesystem::path& path, uint64_t& outHash)
+	{
+		std::ifstream file(path, std::ios::binary);
+		if (!file)
+			return false;
+
+		ContentHasher hasher;
+		std::vector<char> buffer(256 * 1024);
+
+		while (file)
+		{
+			file.read(buffer.data(), buffer.size());
+			hasher.Update(buffer.data(), static_cast<size_t>(file.gcount()));
+		}
+
+		outHash = hasher.Finish();
+		return true;
+	}
+
+	std::string ToHashString(uint64_t hash)
+	{
+		char buffer[17];
+		std::snprintf(buffer, sizeof(buffer), "%016llx", static_cast<unsigned long long>(hash));
+		return buffer;
+	}
+
+	bool FromHashString(const std::string& string, uint64_t& outHash)
+	{
+		if (string.size() != 16)
+			return false;
+
+		char* end = nullptr;
+		outHash = std::strtoull(string.c_str(), &end, 16);
+		return end == string.c_str() + string.size();
+	}
+
+	uuids::uuid MakeDerivedUUID(const uuids::uuid& source, std::string_view name)
+	{
+		uuids::uuid_name_generator generator(source);
+		return generator(name);
+	}
+
+	uuids::uuid MakeContentUUID(std::string_view kind, uint64_t contentHash)
+	{
+		uuids::uuid_name_generator generator(s_ContentNamespace);
+		return generator(std::string(kind) + "/" + ToHashString(contentHash));
+	}
+}
@@ -0,0 +1,48 @@
+#pragma once
+
+#include <uuid.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+namespace Nightbird::Editor
+{
+	// Fast non-cryptographic 64-bit hash used to detect changed cook inputs.
+	// The result depends on the sequence of Update calls, not only on the bytes.
+	class ContentHasher
+	{
+	public:
+		void Update(const void* data, size_t size);
+		void Update(std::string_view string);
+		void Update(const uuids::uuid& uuid);
+
+		template<typename T>
+		void UpdateValue(const T& value)
+		{
+			static_assert(std::is_trivially_copyable_v<T>, "Only plain values can be hashed as bytes");
+			Update(&value, sizeof(T));
+		}
+
+		uint64_t Finish() const;
+
+	private:
+		uint64_t m_Hash = 0x9E3779B97F4A7C15ull;
+		uint64_t m_Length = 0;
+	};
+
+	bool HashFile(const std::filesystem::path& path, uint64_t& outHash);
+
+	std::string ToHashString(uint64_t hash);
+	bool FromHashString(const std::string& string, uint64_t& outHash);
+
+	// Name based UUID for an asset that lives inside another one, e.g. a mesh in a glTF file.
+	// Stays the same as long as the source asset's UUID and the name do.
+	uuids::uuid MakeDerivedUUID(const uuids::uuid& source, std::string_view name);
+
+	// UUID for generated content that has no source asset of its own, identical content shares it
+	uuids::uuid MakeContentUUID(std::string_view kind, uint64_t contentHash);
+}
@@ -10,6 +10,8 @@
 #include "Core/Transform.h"
 #include "Core/Log.h"
 
+#include "Import/ContentHash.h"
+
 #include <fastgltf/core.hpp>
 #include <fastgltf/tools.hpp>
 #include <glm/glm.hpp>
@@ -57,10 +59,11 @@ namespace Nightbird::Editor
 		if (gltfAsset.defaultScene.has_value())
 		{
 			const fastgltf::Scene& scene = gltfAsset.scenes[gltfAsset.defaultScene.value()];
+			std::vector<std::shared_ptr<Core::Mesh>> meshes(gltfAsset.meshes.size());
 			
 			for (size_t nodeIndex : scene.nodeIndices)
 			{
-				ProcessNode(gltfAsset, nodeIndex, result.root.get(), materials, assetManager);
+				ProcessNode(gltfAsset, nodeIndex, result.root.get(), materials, assetInfo.uuid, meshes, assetManager);
 			}
 		}
 		else
@@ -71,7 +74,8 @@ namespace Nightbird::Editor
 		return result;
 	}
 
-	void GltfSceneImporter::ProcessNode(const fastgltf::Asset& gltfAsset, size_t nodeIndex, Core::SceneObject* parent, const std::vector<std::shared_ptr<Core::Material>>& materials, Core::AssetManager* assetManager)
+	void GltfSceneImporter::ProcessNode(const fastgltf::Asset& gltfAsset, size_t nodeIndex, Core::SceneObject* parent, const std::vector<std::shared_ptr<Core::Material>>& materials,
+		const uuids::uuid& sourceUUID, std::vector<std::shared_ptr<Core::Mesh>>& meshes, Core::AssetManager* assetManager)
 	{
 		const fastgltf::Node& node = gltfAsset.nodes[nodeIndex];
 
@@ -80,12 +84,18 @@ namespace Nightbird::Editor
 
 		if (node.meshIndex.has_value())
 		{
-			auto mesh = LoadMesh(gltfAsset, gltfAsset.meshes[node.meshIndex.value()], materials);
+			// Nodes sharing a glTF mesh share the loaded mesh
+			size_t meshIndex = node.meshIndex.value();
+			if (!meshes[meshIndex])
+				meshes[meshIndex] = LoadMesh(gltfAsset, gltfAsset.meshes[meshIndex], materials);
+
+			const auto& mesh = meshes[meshIndex];
 			auto meshInstance = std::make_unique<Core::MeshInstance>();
 
 			if (assetManager && mesh)
 			{
-				uuids::uuid meshUUID = GenerateUUID();
+				// Derived from the glTF file's UUID so re-importing keeps the same mesh UUID
+				uuids::uuid meshUUID = MakeDerivedUUID(sourceUUID, "mesh/" + std::to_string(meshIndex));
 				assetManager->Insert(meshUUID, mesh);
 				meshInstance->m_Mesh.SetUUID(meshUUID);
 				std::weak_ptr<Core::Mesh> weakMesh = assetManager->Load<Core::Mesh>(meshUUID);
@@ -106,13 +116,13 @@ namespace Nightbird::Editor
 		
 		if (auto* trs = std::get_if<fastgltf::TRS>(&node.transform))
 		{
-			spatialPtr->m_Transform.position = glm::vec3(trs->translation.x(), trs->translation.y(), trs->translation.z());
-			spatialPtr->m_Transform.rotation = glm::quat(trs->rotation.w(), trs->rotation.x(), trs->rotation.y(), trs->rotation.z());
-			spatialPtr->m_Transform.scale = glm::vec3(trs->scale.x(), trs->scale.y(), trs->scale.z());
+			spatialPtr->SetPosition(glm::vec3(trs->translation.x(), trs->translation.y(), trs->translation.z()));
+			spatialPtr->SetRotation(glm::quat(trs->rotation.w(), trs->rotation.x(), trs->rotation.y(), trs->rotation.z()));
+			spatialPtr->SetScale(glm::vec3(trs->scale.x(), trs->scale.y(), trs->scale.z()));
 		}
 
 		for (size_t childIndex : node.children)
-			ProcessNode(gltfAsset, childIndex, spatialPtr, materials, assetManager);
+			ProcessNode(gltfAsset, childIndex, spatialPtr, materials, sourceUUID, meshes, assetManager);
 
 		parent->AddChild(std::move(object));
 	}
@@ -345,17 +355,4 @@ namespace Nightbird::Editor
 		
 		return decoded;
 	}
-
-	uuids::uuid GltfSceneImporter::GenerateUUID() const
-	{
-		std::random_device randomDevice;
-
-		auto seedData = std::array<int, std::mt19937::state_size>{};
-		std::generate(std::begin(seedData), std::end(seedData), std::ref(randomDevice));
-		std::seed_seq seq(std::begin(seedData), std::end(seedData));
-		std::mt19937 generator(seq);
-		uuids::uuid_random_generator gen{generator};
-
-		return gen();
-	}
-}
+}
\ No newline at end of file
@@ -29,14 +29,13 @@ namespace Nightbird::Editor
 		Core::SceneReadResult Load(const AssetInfo& assetInfo, Core::AssetManager* assetManager) override;
 
 	private:
-		void ProcessNode(const fastgltf::Asset& gltfAsset, size_t nodeIndex, Core::SceneObject* parent, const std::vector<std::shared_ptr<Core::Material>>& materials, Core::AssetManager* assetManager);
+		void ProcessNode(const fastgltf::Asset& gltfAsset, size_t nodeIndex, Core::SceneObject* parent, const std::vector<std::shared_ptr<Core::Material>>& materials,
+			const uuids::uuid& sourceUUID, std::vector<std::shared_ptr<Core::Mesh>>& meshes, Core::AssetManager* assetManager);
 
 		std::vector<std::shared_ptr<Core::Texture>> LoadTextures(const fastgltf::Asset& gltfAsset);
 		std::vector<std::shared_ptr<Core::Material>> LoadMaterials(const fastgltf::Asset& gltfAsset, const std::vector<std::shared_ptr<Core::Texture>>& textures);
 		std::shared_ptr<Core::Mesh> LoadMesh(const fastgltf::Asset& gltfAsset, const fastgltf::Mesh& gltfMesh, const std::vector<std::shared_ptr<Core::Material>>& materials);
 
 		bool DecodeImage(const fastgltf::Asset& gltfAsset, const fastgltf::Image& image, std::vector<uint8_t>& outPixels, int& outWidth, int& outHeight);
-
-		uuids::uuid GenerateUUID() const;
 	};
 }
@@ -335,6 +335,20 @@ namespace Nightbird::Editor
 		AssetInfo assetInfo;
 		assetInfo.uuid = *uuid;
 		assetInfo.importer = table["info"]["importer"].value_or(std::string{});
+
+		// Optional per-asset import settings, kept as strings like the other tags
+		if (const toml::table* import = table["import"].as_table())
+		{
+			for (const auto& [key, node] : *import)
+			{
+				if (auto value = node.value<std::string>())
+					assetInfo.tags[std::string(key.str())] = *value;
+				else if (auto value = node.value<bool>())
+					assetInfo.tags[std::string(key.str())] = *value ? "true" : "false";
+				else if (auto value = node.value<int64_t>())
+					assetInfo.tags[std::string(key.str())] = std::to_string(*value);
+			}
+		}
 		
 		std::string assetInfoPathString = assetInfoPath.string();
 		assetInfo.path = assetInfoPathString.substr(0, assetInfoPathString.size() - std::string(".assetinfo").size());
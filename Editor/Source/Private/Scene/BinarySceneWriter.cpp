@@ -18,13 +18,29 @@
 
 namespace Nightbird::Editor
 {
+	using namespace Core::SceneFormat;
+
 	void BinarySceneWriter::Write(Core::SceneObject* root, const uuids::uuid& sceneUUID,
 		const std::filesystem::path& outputPath, Endianness endianness,
 		Core::Camera* activeCamera)
 	{
-		m_NodeUUIDs.clear();
+		m_Strings.clear();
+		m_StringIndices.clear();
+		m_Types.clear();
+		m_TypeIndices.clear();
+		m_Nodes.clear();
+
+		uint32_t sceneNameIndex = AddString(root->GetName());
 
-		AssignNodeUUIDs(root, true);
+		for (const auto& child : root->GetChildren())
+			CollectNode(child.get(), InvalidIndex);
+
+		uint32_t activeCameraIndex = InvalidIndex;
+		for (uint32_t i = 0; i < static_cast<uint32_t>(m_Nodes.size()); ++i)
+		{
+			if (activeCamera && m_Nodes[i].object == activeCamera)
+				activeCameraIndex = i;
+		}
 
 		std::filesystem::create_directories(outputPath.parent_path());
 		BinaryWriter writer(outputPath, endianness);
@@ -36,230 +52,179 @@ namespace Nightbird::Editor
 		writer.WriteUInt8('E');
 
 		// Version
-		writer.WriteUInt32(1);
+		writer.WriteUInt32(Version);
+
+		// String table
+		writer.WriteUInt32(static_cast<uint32_t>(m_Strings.size()));
+		for (const std::string& string : m_Strings)
+		{
+			writer.WriteUInt32(static_cast<uint32_t>(string.size()));
+			writer.WriteRawBytes(reinterpret_cast<const uint8_t*>(string.data()), string.size());
+		}
 
 		// Scene name
-		std::string name = root->GetName();
-		writer.WriteUInt32(static_cast<uint32_t>(name.size()));
-		writer.WriteRawBytes(reinterpret_cast<const uint8_t*>(name.data()), name.size());
+		writer.WriteUInt32(sceneNameIndex);
 
 		// Scene UUID
 		auto sceneUUIDBytes = sceneUUID.as_bytes();
 		writer.WriteRawBytes(reinterpret_cast<const uint8_t*>(sceneUUIDBytes.data()), 16);
 
-		// Active camera UUID
-		if (activeCamera && m_NodeUUIDs.count(activeCamera))
+		// Active camera node index
+		writer.WriteUInt32(activeCameraIndex);
+
+		// Type table
+		writer.WriteUInt32(static_cast<uint32_t>(m_Types.size()));
+		for (const TypeEntry& type : m_Types)
 		{
-			auto bytes = m_NodeUUIDs[activeCamera].as_bytes();
-			writer.WriteRawBytes(reinterpret_cast<const uint8_t*>(bytes.data()), 16);
+			writer.WriteUInt32(type.nameIndex);
+			writer.WriteUInt16(static_cast<uint16_t>(type.layout->GetFlatFields().size()));
+			for (const FlatField& field : type.layout->GetFlatFields())
+			{
+				writer.WriteUInt32(field.pathHash);
+				writer.WriteUInt8(static_cast<uint8_t>(field.kind));
+			}
 		}
-		else
+
+		// Node table
+		writer.WriteUInt32(static_cast<uint32_t>(m_Nodes.size()));
+		for (const NodeEntry& node : m_Nodes)
 		{
-			auto nullBytes = uuids::uuid{}.as_bytes();
-			writer.WriteRawBytes(reinterpret_cast<const uint8_t*>(nullBytes.data()), 16);
+			writer.WriteUInt32(node.typeIndex);
+			writer.WriteUInt32(node.parentIndex);
+
+			if (node.object->HasSourceScene())
+			{
+				writer.WriteUInt8(HasSourceScene);
+				auto uuidBytes = node.object->GetSourceSceneUUID().value().as_bytes();
+				writer.WriteRawBytes(reinterpret_cast<const uint8_t*>(uuidBytes.data()), 16);
+			}
+			else
+			{
+				writer.WriteUInt8(0);
+			}
 		}
 
-		// Node count (minus root)
-		writer.WriteUInt32(static_cast<uint32_t>(m_NodeUUIDs.size() - 1));
+		// Field sections
+		std::vector<uint8_t> blob;
+		for (const TypeEntry& type : m_Types)
+		{
+			// Statically reflected types pack with generated code unless bytes need swapping
+			const TypeOps* ops = type.type->ops;
+			if (ops && !writer.IsSwappingBytes())
+			{
+				blob.resize(type.layout->GetPackedSize());
+				for (uint32_t node : type.nodes)
+				{
+					ops->pack(m_Nodes[node].object, blob.data(), &BinarySceneWriter::GetStringIndex, this);
+					writer.WriteRawBytes(blob.data(), blob.size());
+				}
+				continue;
+			}
 
-		for (const auto& child : root->GetChildren())
-			WriteNode(child.get(), uuids::uuid{}, writer);
+			for (uint32_t node : type.nodes)
+				WriteFields(static_cast<void*>(m_Nodes[node].object), type, writer);
+		}
 
 		Core::Log::Info("BinarySceneWriter: Written binary scene: " + outputPath.string());
 	}
 
-	void BinarySceneWriter::AssignNodeUUIDs(Core::SceneObject* object, bool isRoot)
+	void BinarySceneWriter::CollectNode(Core::SceneObject* object, uint32_t parentIndex)
 	{
 		if (!object)
 			return;
 
-		m_NodeUUIDs[object] = GenerateUUID();
-
-		if (!isRoot && object->HasSourceScene())
-			return;
-
-		for (const auto& child : object->GetChildren())
-			AssignNodeUUIDs(child.get());
-	}
-
-	void BinarySceneWriter::WriteNode(Core::SceneObject* object, const uuids::uuid& parentUUID, BinaryWriter& writer)
-	{
-		if (!object)
-			return;
+		uint32_t index = static_cast<uint32_t>(m_Nodes.size());
+		uint32_t typeIndex = AddType(object->GetTypeInfo());
 
-		// Node UUID
-		auto nodeUUIDBytes = m_NodeUUIDs[object].as_bytes();
-		writer.WriteRawBytes(reinterpret_cast<const uint8_t*>(nodeUUIDBytes.data()), 16);
+		m_Nodes.push_back({ object, typeIndex, parentIndex });
+		m_Types[typeIndex].nodes.push_back(index);
 
-		// Parent UUID
-		auto parentUUIDBytes = parentUUID.as_bytes();
-		writer.WriteRawBytes(reinterpret_cast<const uint8_t*>(parentUUIDBytes.data()), 16);
-		
-		if (object->HasSourceScene())
-		{
-			// Has Scene UUID (true)
-			writer.WriteUInt8(1);
-			// Scene UUID
-			auto uuidBytes = object->GetSourceSceneUUID().value().as_bytes();
-			writer.WriteRawBytes(reinterpret_cast<const uint8_t*>(uuidBytes.data()), 16);
-		}
-		else
+		for (const FlatField& field : m_Types[typeIndex].layout->GetFlatFields())
 		{
-			// Has Scene UUID (false)
-			writer.WriteUInt8(0);
+			if (field.kind == FieldKind::String)
+				AddString(*reinterpret_cast<const std::string*>(reinterpret_cast<const uint8_t*>(object) + field.offset));
 		}
 
-		// Type name
-		const char* typeName = object->GetTypeInfo()->name;
-		uint16_t typeNameLength = static_cast<uint16_t>(std::strlen(typeName));
-		writer.WriteUInt16(typeNameLength);
-		writer.WriteRawBytes(reinterpret_cast<const uint8_t*>(typeName), typeNameLength);
-
-		// Field count
-		uint16_t fieldCount = 0;
-		for (const TypeInfo* type = object->GetTypeInfo(); type; type = type->parent)
-			fieldCount += static_cast<uint16_t>(type->fieldCount);
-		writer.WriteUInt16(fieldCount);
-
-		// Fields
-		WriteFields(static_cast<void*>(object), object->GetTypeInfo(), writer);
-
 		// Do not serialize children of scene instance
 		if (object->HasSourceScene())
 			return;
 
 		for (const auto& child : object->GetChildren())
-			WriteNode(child.get(), m_NodeUUIDs[object], writer);
+			CollectNode(child.get(), index);
 	}
 
-	void BinarySceneWriter::WriteFields(void* object, const TypeInfo* type, BinaryWriter& writer)
+	uint32_t BinarySceneWriter::AddType(const TypeInfo* type)
 	{
-		if (!object || !type)
-			return;
+		auto it = m_TypeIndices.find(type);
+		if (it != m_TypeIndices.end())
+			return it->second;
+
+		uint32_t index = static_cast<uint32_t>(m_Types.size());
+		TypeEntry& entry = m_Types.emplace_back();
+		entry.type = type;
+		entry.nameIndex = AddString(type->name);
+		entry.layout = type->layout;
+
+		m_TypeIndices[type] = index;
+		return index;
+	}
 
-		if (type->parent)
-			WriteFields(object, type->parent, writer);
+	uint32_t BinarySceneWriter::AddString(const std::string& string)
+	{
+		auto [it, inserted] = m_StringIndices.try_emplace(string, static_cast<uint32_t>(m_Strings.size()));
+		if (inserted)
+			m_Strings.push_back(string);
+		return it->second;
+	}
 
-		if (!type->HasFields())
-			return;
+	uint32_t BinarySceneWriter::GetStringIndex(void* context, std::string_view string)
+	{
+		return static_cast<BinarySceneWriter*>(context)->m_StringIndices.at(std::string(string));
+	}
 
-		for (const FieldInfo* field = type->Begin(); field != type->End(); ++field)
+	void BinarySceneWriter::WriteFields(void* object, const TypeEntry& type, BinaryWriter& writer)
+	{
+		uint8_t* base = static_cast<uint8_t*>(object);
+
+		for (const FlatField& field : type.layout->GetFlatFields())
 		{
-			writer.WriteUInt32(field->nameHash);
+			uint8_t* fieldPtr = base + field.offset;
 
-			switch (field->kind)
+			switch (field.kind)
 			{
 			case FieldKind::Bool:
-			{
-				writer.WriteUInt16(sizeof(uint8_t));
-				writer.WriteUInt8(*field->GetPtrAs<bool>(object) ? 1 : 0);
+				writer.WriteUInt8(*reinterpret_cast<bool*>(fieldPtr) ? 1 : 0);
 				break;
-			}
 			case FieldKind::Int32:
-			{
-				writer.WriteUInt16(sizeof(int32_t));
-				writer.WriteInt32(*field->GetPtrAs<int32_t>(object));
+				writer.WriteInt32(*reinterpret_cast<int32_t*>(fieldPtr));
 				break;
-			}
 			case FieldKind::UInt32:
-			{
-				writer.WriteUInt16(sizeof(uint32_t));
-				writer.WriteUInt32(*field->GetPtrAs<uint32_t>(object));
+				writer.WriteUInt32(*reinterpret_cast<uint32_t*>(fieldPtr));
 				break;
-			}
 			case FieldKind::Float:
-			{
-				writer.WriteUInt16(sizeof(float));
-				writer.WriteUInt32(*field->GetPtrAs<uint32_t>(object));
+				writer.WriteFloat(*reinterpret_cast<float*>(fieldPtr));
 				break;
-			}
 			case FieldKind::String:
-			{
-				const std::string& string = *field->GetPtrAs<std::string>(object);
-				uint32_t length = static_cast<uint32_t>(string.size());
-				writer.WriteUInt16(static_cast<uint16_t>(sizeof(uint32_t) + length));
-				writer.WriteUInt32(length);
-				writer.WriteRawBytes(reinterpret_cast<const uint8_t*>(string.data()), length);
+				writer.WriteUInt32(m_StringIndices.at(*reinterpret_cast<std::string*>(fieldPtr)));
 				break;
-			}
 			case FieldKind::Vector2:
-			{
-				writer.WriteUInt16(sizeof(float) * 2);
-				auto* vec = field->GetPtrAs<glm::vec2>(object);
-				writer.WriteFloat(vec->x);
-				writer.WriteFloat(vec->y);
-				break;
-			}
 			case FieldKind::Vector3:
-			{
-				writer.WriteUInt16(sizeof(float) * 3);
-				auto* vec = field->GetPtrAs<glm::vec3>(object);
-				writer.WriteFloat(vec->x);
-				writer.WriteFloat(vec->y);
-				writer.WriteFloat(vec->z);
-				break;
-			}
 			case FieldKind::Vector4:
-			{
-				writer.WriteUInt16(sizeof(float) * 4);
-				auto* vec = field->GetPtrAs<glm::vec4>(object);
-				writer.WriteFloat(vec->x);
-				writer.WriteFloat(vec->y);
-				writer.WriteFloat(vec->z);
-				writer.WriteFloat(vec->w);
-				break;
-			}
 			case FieldKind::Quat:
-			{
-				writer.WriteUInt16(sizeof(float) * 4);
-				auto* quat = field->GetPtrAs<glm::quat>(object);
-				writer.WriteFloat(quat->x);
-				writer.WriteFloat(quat->y);
-				writer.WriteFloat(quat->z);
-				writer.WriteFloat(quat->w);
+				// Components in memory order, the reader copies them back as is
+				writer.WriteSpan(std::span<const float>(reinterpret_cast<const float*>(fieldPtr), GetPackedSize(field.kind) / sizeof(float)));
 				break;
-			}
 			case FieldKind::UUID:
-			{
-				writer.WriteUInt16(16);
-				auto bytes = field->GetPtrAs<uuids::uuid>(object)->as_bytes();
-				writer.WriteRawBytes(reinterpret_cast<const uint8_t*>(bytes.data()), 16);
-				break;
-			}
 			case FieldKind::AssetRef:
 			{
-				writer.WriteUInt16(16);
-				auto bytes = field->GetPtrAs<uuids::uuid>(object)->as_bytes();
+				auto bytes = reinterpret_cast<uuids::uuid*>(fieldPtr)->as_bytes();
 				writer.WriteRawBytes(reinterpret_cast<const uint8_t*>(bytes.data()), 16);
 				break;
 			}
-			case FieldKind::Object:
-			{
-				writer.WriteUInt16(0);
-				if (field->type)
-					WriteFields(field->GetPtr(object), field->type, writer);
-				break;
-			}
-			case FieldKind::Unknown:
-				Core::Log::Info("BinarySceneWriter: Unknown FieldKind");
-				break;
 			default:
-				Core::Log::Info("BinarySceneWriter: Unhandled FieldKind: " + std::to_string(static_cast<uint8_t>(field->kind)));
+				Core::Log::Info("BinarySceneWriter: Unhandled FieldKind: " + std::to_string(static_cast<uint8_t>(field.kind)));
 				break;
 			}
 		}
 	}
-	
-	uuids::uuid BinarySceneWriter::GenerateUUID() const
-	{
-		std::random_device randomDevice;
-
-		auto seedData = std::array<int, std::mt19937::state_size>{};
-		std::generate(std::begin(seedData), std::end(seedData), std::ref(randomDevice));
-		std::seed_seq seq(std::begin(seedData), std::end(seedData));
-		std::mt19937 generator(seq);
-		uuids::uuid_random_generator gen{generator};
-
-		return gen();
-	}
 }
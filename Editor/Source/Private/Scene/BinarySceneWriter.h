@@ -1,11 +1,15 @@
 #pragma once
 
 #include "Core/TypeInfo.h"
+#include "Core/SceneFormat.h"
+#include "Core/FieldLayout.h"
 #include "Cook/Endianness.h"
 
 #include <uuid.h>
 
 #include <filesystem>
+#include <string>
+#include <string_view>
 #include <unordered_map>
 #include <vector>
 
@@ -27,12 +31,35 @@ namespace Nightbird::Editor
 			Core::Camera* activeCamera = nullptr);
 
 	private:
-		std::unordered_map<const Core::SceneObject*, uuids::uuid> m_NodeUUIDs;
+		struct TypeEntry
+		{
+			const TypeInfo* type = nullptr;
+			uint32_t nameIndex = 0;
+			const FieldLayout* layout = nullptr;
+			std::vector<uint32_t> nodes;
+		};
 
-		void AssignNodeUUIDs(Core::SceneObject* object, bool isRoot = false);
-		void WriteNode(Core::SceneObject* object, const uuids::uuid& parentUUID, BinaryWriter& writer);
-		void WriteFields(void* object, const TypeInfo* type, BinaryWriter& writer);
-		
-		uuids::uuid GenerateUUID() const;
+		struct NodeEntry
+		{
+			Core::SceneObject* object = nullptr;
+			uint32_t typeIndex = 0;
+			uint32_t parentIndex = Core::SceneFormat::InvalidIndex;
+		};
+
+		std::vector<std::string> m_Strings;
+		std::unordered_map<std::string, uint32_t> m_StringIndices;
+
+		std::vector<TypeEntry> m_Types;
+		std::unordered_map<const TypeInfo*, uint32_t> m_TypeIndices;
+
+		std::vector<NodeEntry> m_Nodes;
+
+		void CollectNode(Core::SceneObject* object, uint32_t parentIndex);
+		uint32_t AddType(const TypeInfo* type);
+		uint32_t AddString(const std::string& string);
+
+		void WriteFields(void* object, const TypeEntry& type, BinaryWriter& writer);
+
+		static uint32_t GetStringIndex(void* context, std::string_view string);
 	};
 }
@@ -2,6 +2,7 @@
 
 #include "Import/AssetInfo.h"
 
+#include "Core/FieldLayout.h"
 #include "Core/SceneObject.h"
 #include "Core/SpatialObject.h"
 #include "Core/MeshInstance.h"
@@ -139,16 +140,11 @@ namespace Nightbird::Editor
 
 	void TextSceneReader::ReadFields(void* object, const TypeInfo* type, const toml::table& table)
 	{
-		if (!object || !type)
+		if (!object || !type || !type->layout)
 			return;
 
-		if (type->parent)
-			ReadFields(object, type->parent, table);
-
-		if (!type->HasFields())
-			return;
-
-		for (const FieldInfo* field = type->Begin(); field != type->End(); ++field)
+		// Inherited fields are part of the layout, so parents aren't visited separately
+		for (const FieldInfo* field : type->layout->GetFields())
 		{
 			switch (field->kind)
 			{
@@ -78,6 +78,11 @@ namespace Nightbird::Editor
 		if (ImGui::Button("Cook"))
 			m_Context.GetCookManager().CookScene(m_SelectedSceneUUID, s_PlatformTargets[m_SelectedPlatform]);
 
+		ImGui::SameLine();
+
+		if (ImGui::Button("Cook All Platforms"))
+			m_Context.GetCookManager().CookScene(m_SelectedSceneUUID, std::vector<CookTarget>(std::begin(s_PlatformTargets), std::end(s_PlatformTargets)));
+
 		if(!canCook)
 			ImGui::EndDisabled();
 	}
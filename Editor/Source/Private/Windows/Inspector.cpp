@@ -7,6 +7,7 @@
 #include "Core/Engine.h"
 #include "Core/AssetManager.h"
 #include "Core/SceneObject.h"
+#include "Core/SpatialObject.h"
 #include "Core/Cubemap.h"
 #include "Core/AudioAsset.h"
 #include "Core/Log.h"
@@ -53,7 +54,11 @@ namespace Nightbird::Editor
 		ImGui::Separator();
 		ImGui::Dummy(ImVec2(0.0f, 1.0f));
 
-		DrawFields(object, type);
+		if (DrawFields(object, type))
+		{
+			if (auto* spatial = Cast<Core::SpatialObject>(object))
+				spatial->MarkTransformDirty();
+		}
 
 		if (object->HasSourceScene())
 		{
@@ -65,16 +70,18 @@ namespace Nightbird::Editor
 		}
 	}
 
-	void Inspector::DrawFields(void* object, const TypeInfo* type)
+	bool Inspector::DrawFields(void* object, const TypeInfo* type)
 	{
 		if (!object || !type)
-			return;
+			return false;
+
+		bool modified = false;
 
 		if (type->parent)
-			DrawFields(object, type->parent);
+			modified |= DrawFields(object, type->parent);
 
 		if (!type->HasFields())
-			return;
+			return modified;
 
 		for (const FieldInfo* field = type->Begin(); field != type->End(); ++field)
 		{
@@ -85,25 +92,25 @@ namespace Nightbird::Editor
 				case FieldKind::Bool:
 				{
 					bool* value = field->GetPtrAs<bool>(object);
-					ImGui::Checkbox(field->name, value);
+					modified |= ImGui::Checkbox(field->name, value);
 					break;
 				}
 				case FieldKind::Int32:
 				{
 					int32_t* value = field->GetPtrAs<int32_t>(object);
-					ImGui::DragInt(field->name, value);
+					modified |= ImGui::DragInt(field->name, value);
 					break;
 				}
 				case FieldKind::UInt32:
 				{
 					uint32_t* value = field->GetPtrAs<uint32_t>(object);
-					ImGui::DragScalar(field->name, ImGuiDataType_U32, value);
+					modified |= ImGui::DragScalar(field->name, ImGuiDataType_U32, value);
 					break;
 				}
 				case FieldKind::Float:
 				{
 					float* value = field->GetPtrAs<float>(object);
-					ImGui::DragFloat(field->name, value, 0.01f);
+					modified |= ImGui::DragFloat(field->name, value, 0.01f);
 					break;
 				}
 				case FieldKind::String:
@@ -112,31 +119,34 @@ namespace Nightbird::Editor
 					char buffer[256];
 					std::strncpy(buffer, value->c_str(), sizeof(buffer));
 					if (ImGui::InputText(field->name, buffer, sizeof(buffer)))
+					{
 						*value = buffer;
+						modified = true;
+					}
 					break;
 				}
 				case FieldKind::Vector2:
 				{
 					glm::vec2* value = field->GetPtrAs<glm::vec2>(object);
-					ImGui::DragFloat2(field->name, glm::value_ptr(*value), 0.01f);
+					modified |= ImGui::DragFloat2(field->name, glm::value_ptr(*value), 0.01f);
 					break;
 				}
 				case FieldKind::Vector3:
 				{
 					glm::vec3* value = field->GetPtrAs<glm::vec3>(object);
-					ImGui::DragFloat3(field->name, glm::value_ptr(*value), 0.01f);
+					modified |= ImGui::DragFloat3(field->name, glm::value_ptr(*value), 0.01f);
 					break;
 				}
 				case FieldKind::Vector4:
 				{
 					glm::vec4* value = field->GetPtrAs<glm::vec4>(object);
-					ImGui::DragFloat4(field->name, glm::value_ptr(*value), 0.01f);
+					modified |= ImGui::DragFloat4(field->name, glm::value_ptr(*value), 0.01f);
 					break;
 				}
 				case FieldKind::Quat:
 				{
 					glm::quat* value = field->GetPtrAs<glm::quat>(object);
-					ImGui::DragFloat4(field->name, glm::value_ptr(*value), 0.01f);
+					modified |= ImGui::DragFloat4(field->name, glm::value_ptr(*value), 0.01f);
 					break;
 				}
 				case FieldKind::UUID:
@@ -158,6 +168,7 @@ namespace Nightbird::Editor
 						{
 							const uuids::uuid* droppedUUID = static_cast<const uuids::uuid*>(payload->Data);
 							*uuid = *droppedUUID;
+							modified = true;
 						}
 						ImGui::EndDragDropTarget();
 					}
@@ -173,7 +184,7 @@ namespace Nightbird::Editor
 						if (ImGui::TreeNodeEx(field->name, ImGuiTreeNodeFlags_DefaultOpen))
 						{
 							void* fieldObject = field->GetPtr(object);
-							DrawFields(fieldObject, field->type);
+							modified |= DrawFields(fieldObject, field->type);
 							ImGui::TreePop();
 						}
 					}
@@ -193,6 +204,8 @@ namespace Nightbird::Editor
 
 			ImGui::PopID();
 		}
+
+		return modified;
 	}
 
 	bool Inspector::DrawAsset(const std::filesystem::path& path)
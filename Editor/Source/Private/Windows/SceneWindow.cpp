@@ -118,7 +118,7 @@ namespace Nightbird::Editor
 			if (inputSystem.IsDown(Input::Digital::Key_Q) || inputSystem.IsDown(Input::Digital::Pad_B))
 				movementDir -= up;
 
-			m_Camera->m_Transform.position += movementDir * m_MovementSpeed * m_Context.GetEngine().GetDeltaTime();
+			m_Camera->SetPosition(m_Camera->m_Transform.position + movementDir * m_MovementSpeed * m_Context.GetEngine().GetDeltaTime());
 
 			ImVec2 mousePos = ImGui::GetMousePos();
 			float deltaX = m_LastX - mousePos.x;
@@ -133,7 +133,7 @@ namespace Nightbird::Editor
 			glm::quat pitchQuat = glm::angleAxis(pitchDelta, right);
 			glm::quat yawQuat = glm::angleAxis(yawDelta, glm::vec3(0.0f, 1.0f, 0.0f));
 
-			m_Camera->m_Transform.rotation = glm::normalize(yawQuat * pitchQuat * m_Camera->m_Transform.rotation);
+			m_Camera->SetRotation(glm::normalize(yawQuat * pitchQuat * m_Camera->m_Transform.rotation));
 		}
 
 		ImVec2 size = ImGui::GetContentRegionAvail();
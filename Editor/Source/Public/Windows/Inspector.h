@@ -20,7 +20,7 @@ namespace Nightbird::Editor
 
 	private:
 		void DrawSceneObject(Core::SceneObject* object);
-		void DrawFields(void* object, const TypeInfo* type);
+		bool DrawFields(void* object, const TypeInfo* type);
 
 		bool DrawAsset(const std::filesystem::path& path);
 
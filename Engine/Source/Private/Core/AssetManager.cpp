@@ -0,0 +1,371 @@
+#include "Core/AssetManager.h"
+
+#include "Core/SceneTemplate.h"
+#include "Core/SceneObject.h"
+#include "Core/Mesh.h"
+#include "Core/Material.h"
+#include "Core/Texture.h"
+#include "Core/Cubemap.h"
+#include "Core/AudioAsset.h"
+#include "Core/Log.h"
+
+namespace Nightbird::Core
+{
+	static void ResolveAssetsRecursive(SceneObject* object, AssetManager& assetManager)
+	{
+		object->ResolveAssets(assetManager);
+
+		for (auto& child : object->GetChildren())
+			ResolveAssetsRecursive(child.get(), assetManager);
+	}
+
+	// CPU side bytes of the asset's own data. Shared sub-assets such as a mesh's materials are cached and counted separately.
+	static size_t GetAssetMemorySize(AssetType type, const void* asset)
+	{
+		switch (type)
+		{
+		case AssetType::Mesh:
+		{
+			size_t size = sizeof(Mesh);
+			for (const auto& primitive : static_cast<const Mesh*>(asset)->GetPrimitives())
+				size += primitive.GetVertices().size() * sizeof(Vertex) + primitive.GetIndices().size() * sizeof(uint16_t);
+			return size;
+		}
+		case AssetType::Material:
+			return sizeof(Material);
+		case AssetType::Texture:
+			return sizeof(Texture) + static_cast<const Texture*>(asset)->GetData().size();
+		case AssetType::Cubemap:
+			return sizeof(Cubemap) + static_cast<const Cubemap*>(asset)->GetData().size();
+		case AssetType::Audio:
+		{
+			const AudioAsset* audio = static_cast<const AudioAsset*>(asset);
+			size_t size = sizeof(AudioAsset);
+			for (uint8_t channel = 0; channel < audio->GetChannels(); ++channel)
+				size += audio->GetChannelData(channel).size();
+			return size;
+		}
+		default:
+			return 0;
+		}
+	}
+
+	void AssetManager::Unload(const uuids::uuid& uuid)
+	{
+		std::lock_guard<std::mutex> lock(m_CacheMutex);
+
+		auto it = m_Cache.find(uuid);
+		if (it == m_Cache.end())
+			return;
+
+		if (it->second.asset.use_count() > 1)
+			Log::Info("AssetManager: Unloaded " + uuids::to_string(uuid) + " is still referenced and stays in memory until released");
+
+		RemoveFromCache(uuid);
+	}
+
+	void AssetManager::UnloadAll()
+	{
+		std::lock_guard<std::mutex> lock(m_CacheMutex);
+
+		size_t referenced = 0;
+		for (const auto& [uuid, entry] : m_Cache)
+		{
+			if (entry.asset.use_count() > 1)
+				++referenced;
+		}
+
+		if (referenced > 0)
+			Log::Info("AssetManager: " + std::to_string(referenced) + " unloaded assets are still referenced and stay in memory until released");
+
+		m_Cache.clear();
+		m_LruList.clear();
+		m_MemoryUsage = 0;
+		for (size_t& usage : m_TypeMemoryUsage)
+			usage = 0;
+	}
+
+	void AssetManager::Update()
+	{
+		ProcessAsyncLoads();
+
+		std::lock_guard<std::mutex> lock(m_CacheMutex);
+		++m_Frame;
+
+		if (m_MemoryBudget != 0 && m_MemoryUsage > m_MemoryBudget)
+			Evict(m_MemoryBudget, true);
+	}
+
+	void AssetManager::SetMemoryBudget(size_t bytes)
+	{
+		std::lock_guard<std::mutex> lock(m_CacheMutex);
+		m_MemoryBudget = bytes;
+		m_OverBudgetWarned = false;
+
+		if (m_MemoryBudget != 0 && m_MemoryUsage > m_MemoryBudget)
+			Evict(m_MemoryBudget, true);
+	}
+
+	size_t AssetManager::GetMemoryBudget() const
+	{
+		std::lock_guard<std::mutex> lock(m_CacheMutex);
+		return m_MemoryBudget;
+	}
+
+	size_t AssetManager::GetMemoryUsage() const
+	{
+		std::lock_guard<std::mutex> lock(m_CacheMutex);
+		return m_MemoryUsage;
+	}
+
+	size_t AssetManager::GetMemoryUsage(AssetType type) const
+	{
+		std::lock_guard<std::mutex> lock(m_CacheMutex);
+		return m_TypeMemoryUsage[static_cast<size_t>(type)];
+	}
+
+	size_t AssetManager::CollectUnused()
+	{
+		std::lock_guard<std::mutex> lock(m_CacheMutex);
+		size_t freed = Evict(0, false);
+
+		if (freed > 0)
+			Log::Info("AssetManager: Collected " + std::to_string(freed / 1024) + " KB of unused assets");
+
+		return freed;
+	}
+
+	const std::shared_ptr<void>& AssetManager::AddToCache(const uuids::uuid& uuid, std::shared_ptr<void> asset, AssetType type)
+	{
+		auto [it, inserted] = m_Cache.try_emplace(uuid);
+		CacheEntry& entry = it->second;
+
+		if (!inserted)
+		{
+			Touch(entry);
+			return entry.asset;
+		}
+
+		entry.size = GetAssetMemorySize(type, asset.get());
+		entry.asset = std::move(asset);
+		entry.type = type;
+		entry.lastUsedFrame = m_Frame;
+		entry.lruPosition = m_LruList.insert(m_LruList.begin(), uuid);
+
+		m_MemoryUsage += entry.size;
+		m_TypeMemoryUsage[static_cast<size_t>(type)] += entry.size;
+
+		// Evicting here rather than only once per frame keeps the peak down while a scene loads
+		if (m_MemoryBudget != 0 && m_MemoryUsage > m_MemoryBudget)
+			Evict(m_MemoryBudget, true);
+
+		return entry.asset;
+	}
+
+	void AssetManager::RemoveFromCache(const uuids::uuid& uuid)
+	{
+		auto it = m_Cache.find(uuid);
+		if (it == m_Cache.end())
+			return;
+
+		CacheEntry& entry = it->second;
+		m_MemoryUsage -= entry.size;
+		m_TypeMemoryUsage[static_cast<size_t>(entry.type)] -= entry.size;
+		m_LruList.erase(entry.lruPosition);
+		m_Cache.erase(it);
+	}
+
+	void AssetManager::Touch(CacheEntry& entry)
+	{
+		entry.lastUsedFrame = m_Frame;
+		m_LruList.splice(m_LruList.begin(), m_LruList, entry.lruPosition);
+	}
+
+	size_t AssetManager::Evict(size_t targetUsage, bool keepRecent)
+	{
+		size_t freed = 0;
+
+		// Releasing a mesh can leave its materials, and their textures, unreferenced, so repeat until nothing changes
+		bool evicted = true;
+		while (evicted && m_MemoryUsage > targetUsage)
+		{
+			evicted = false;
+
+			for (auto it = m_LruList.end(); it != m_LruList.begin() && m_MemoryUsage > targetUsage;)
+			{
+				--it;
+				CacheEntry& entry = m_Cache.at(*it);
+
+				// Still referenced by the scene, another asset or an in-flight load
+				if (entry.asset.use_count() > 1)
+					continue;
+
+				// May have been handed out as a weak_ptr that isn't locked yet. Update advances the
+				// frame before evicting, so the previous frame is kept as well.
+				if (keepRecent && entry.lastUsedFrame + 1 >= m_Frame)
+					continue;
+
+				freed += entry.size;
+				evicted = true;
+
+				const uuids::uuid uuid = *it;
+				it = std::next(it);
+				RemoveFromCache(uuid);
+			}
+		}
+
+		if (m_MemoryBudget != 0 && m_MemoryUsage > m_MemoryBudget)
+		{
+			if (!m_OverBudgetWarned)
+				Log::Warning("AssetManager: " + std::to_string(m_MemoryUsage / 1024) + " KB of assets in use exceeds the budget of " + std::to_string(m_MemoryBudget / 1024) + " KB");
+
+			m_OverBudgetWarned = true;
+		}
+		else
+		{
+			m_OverBudgetWarned = false;
+		}
+
+		return freed;
+	}
+
+	SceneReadResult AssetManager::InstantiateScene(const uuids::uuid& uuid)
+	{
+		std::shared_ptr<SceneTemplate> sceneTemplate = LoadShared<SceneTemplate>(uuid);
+		if (!sceneTemplate)
+		{
+			Log::Error("AssetManager: Failed to load scene template: " + uuids::to_string(uuid));
+			return {};
+		}
+
+		SceneReadResult result = sceneTemplate->Instantiate();
+		if (result.root)
+			ResolveAssetsRecursive(result.root.get(), *this);
+
+		return result;
+	}
+
+	AssetLoadHandle AssetManager::LoadAsync(const TypeInfo* type, const uuids::uuid& uuid)
+	{
+		if (type == &Mesh::s_TypeInfo)
+			return LoadAsync<Mesh>(uuid);
+		if (type == &Cubemap::s_TypeInfo)
+			return LoadAsync<Cubemap>(uuid);
+		if (type == &AudioAsset::s_TypeInfo)
+			return LoadAsync<AudioAsset>(uuid);
+
+		Log::Warning("AssetManager: LoadAsync: Unsupported asset type: " + std::string(type ? type->name : "null"));
+		return {};
+	}
+
+	void AssetManager::ProcessAsyncLoads()
+	{
+		std::vector<std::shared_ptr<AssetLoadState>> completed;
+		{
+			std::lock_guard<std::mutex> lock(m_AsyncMutex);
+			completed.swap(m_CompletedLoads);
+
+			// Once removed no more callbacks can be added to these states
+			for (const auto& state : completed)
+				m_AsyncLoads.erase(state->uuid);
+		}
+
+		for (const auto& state : completed)
+		{
+			state->done = true;
+
+			for (const auto& callback : state->callbacks)
+				callback(state->asset);
+
+			state->callbacks.clear();
+		}
+	}
+
+	void AssetManager::WaitForAsyncLoads()
+	{
+		// Callbacks may start further loads
+		while (HasPendingAsyncLoads())
+		{
+			if (m_JobSystem)
+				m_JobSystem->Wait(m_AsyncCounter);
+
+			ProcessAsyncLoads();
+		}
+	}
+
+	bool AssetManager::HasPendingAsyncLoads()
+	{
+		std::lock_guard<std::mutex> lock(m_AsyncMutex);
+		return !m_AsyncLoads.empty();
+	}
+
+	void AssetManager::SetJobSystem(JobSystem* jobSystem)
+	{
+		m_JobSystem = jobSystem;
+	}
+
+	AssetLoadHandle AssetManager::StartAsyncLoad(const uuids::uuid& uuid, AssetLoadState::Callback callback, std::function<std::shared_ptr<void>()> load)
+	{
+		std::shared_ptr<AssetLoadState> state;
+		bool start = false;
+		{
+			std::lock_guard<std::mutex> lock(m_AsyncMutex);
+
+			// Requests for an asset that is already in flight share its state
+			auto& entry = m_AsyncLoads[uuid];
+			if (!entry)
+			{
+				entry = std::make_shared<AssetLoadState>();
+				entry->uuid = uuid;
+				start = true;
+			}
+
+			state = entry;
+			if (callback)
+				state->callbacks.push_back(std::move(callback));
+		}
+
+		if (start)
+		{
+			auto job = [this, state, load = std::move(load)]()
+			{
+				state->asset = load();
+
+				std::lock_guard<std::mutex> lock(m_AsyncMutex);
+				m_CompletedLoads.push_back(state);
+			};
+
+			if (m_JobSystem)
+				m_JobSystem->Run(std::move(job), &m_AsyncCounter);
+			else
+				job();
+		}
+
+		return AssetLoadHandle(state);
+	}
+
+	void AssetManager::RunParallel(uint32_t count, const std::function<void(uint32_t index)>& function)
+	{
+		if (!m_JobSystem)
+		{
+			for (uint32_t i = 0; i < count; ++i)
+				function(i);
+			return;
+		}
+
+		m_JobSystem->ParallelFor(count, 1, [&function](uint32_t begin, uint32_t end)
+		{
+			for (uint32_t i = begin; i < end; ++i)
+				function(i);
+		});
+	}
+
+	std::shared_ptr<SceneTemplate> AssetManager::LoadSceneTemplate(const uuids::uuid& uuid)
+	{
+		SceneReadResult scene = LoadScene(uuid);
+		if (!scene.root)
+			return nullptr;
+
+		return std::make_shared<SceneTemplate>(std::move(scene));
+	}
+}
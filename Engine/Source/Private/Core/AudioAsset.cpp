@@ -6,7 +6,22 @@ NB_REFLECT_NO_FIELDS(Nightbird::Core::AudioAsset, NB_NO_PARENT, NB_NO_FACTORY)
 
 namespace Nightbird::Core
 {
+	static std::vector<AssetBuffer<uint8_t>> ToBuffers(std::vector<std::vector<uint8_t>> channelData)
+	{
+		std::vector<AssetBuffer<uint8_t>> buffers;
+		buffers.reserve(channelData.size());
+		for (auto& data : channelData)
+			buffers.emplace_back(std::move(data));
+		return buffers;
+	}
+
 	AudioAsset::AudioAsset(uint32_t sampleRate, uint32_t frameCount, uint8_t channels, AudioEncoding encoding, std::vector<std::vector<uint8_t>> channelData)
+		: AudioAsset(sampleRate, frameCount, channels, encoding, ToBuffers(std::move(channelData)))
+	{
+
+	}
+
+	AudioAsset::AudioAsset(uint32_t sampleRate, uint32_t frameCount, uint8_t channels, AudioEncoding encoding, std::vector<AssetBuffer<uint8_t>> channelData)
 		: m_SampleRate(sampleRate), m_FrameCount(frameCount), m_Channels(channels), m_Encoding(encoding), m_ChannelData(std::move(channelData))
 	{
 		if (m_ChannelData.size() < m_Channels)
@@ -20,6 +35,12 @@ namespace Nightbird::Core
 		}
 	}
 
+	AudioAsset::AudioAsset(uint32_t sampleRate, uint32_t frameCount, uint8_t channels, AudioStreamSource streamSource)
+		: m_SampleRate(sampleRate), m_FrameCount(frameCount), m_Channels(channels), m_Encoding(AudioEncoding::PCM16), m_Streamed(true), m_StreamSource(std::move(streamSource))
+	{
+
+	}
+
 	uint32_t AudioAsset::GetSampleRate() const
 	{
 		return m_SampleRate;
@@ -40,8 +61,18 @@ namespace Nightbird::Core
 		return m_Encoding;
 	}
 
-	const std::vector<uint8_t>& AudioAsset::GetChannelData(uint8_t channel) const
+	const AssetBuffer<uint8_t>& AudioAsset::GetChannelData(uint8_t channel) const
 	{
 		return m_ChannelData[channel];
 	}
+
+	bool AudioAsset::IsStreamed() const
+	{
+		return m_Streamed;
+	}
+
+	const AudioStreamSource& AudioAsset::GetStreamSource() const
+	{
+		return m_StreamSource;
+	}
 }
@@ -7,22 +7,14 @@
 
 namespace Nightbird::Core
 {
-	std::shared_ptr<AudioAsset> AudioLoader::Load(const std::string& cookedDir, const uuids::uuid& uuid)
+	std::shared_ptr<AudioAsset> AudioLoader::Load(BinaryReader& reader, const uuids::uuid& uuid, const AudioStreamSource& file)
 	{
-		std::string path = cookedDir + "/" + uuids::to_string(uuid) + ".nbaudio";
-		BinaryReader reader(path);
-		if (!reader.IsValid())
-		{
-			Log::Error("AudioLoader: Failed to open: " + path);
-			return nullptr;
-		}
-
 		// Validate type
 		uint8_t type[4] = {};
 		reader.ReadRawBytes(type, 4);
 		if (type[0] != 'A' || type[1] != 'D' || type[2] != 'I' || type[3] != 'O')
 		{
-			Log::Error("AudioLoader: Invalid type signature in: " + path);
+			Log::Error("AudioLoader: Invalid type signature in: " + uuids::to_string(uuid));
 			return nullptr;
 		}
 
@@ -34,38 +26,62 @@ namespace Nightbird::Core
 			return nullptr;
 		}
 
-		// Encoding, channels, padding
+		// Encoding, channels, flags
 		AudioEncoding encoding = static_cast<AudioEncoding>(reader.ReadUInt8());
 		uint8_t channels = reader.ReadUInt8();
 		bool planar = reader.ReadUInt8() != 0;
-		reader.ReadUInt8(); // Padding
+		uint8_t flags = reader.ReadUInt8();
 
 		// Sample rate, frame count
 		uint32_t sampleRate = reader.ReadUInt32();
 		uint32_t frameCount = reader.ReadUInt32();
 
+		// Streamed clips only remember where their interleaved samples are, the data isn't touched here
+		if (flags & AudioFlags::Streamed)
+		{
+			if (encoding != AudioEncoding::PCM16 || planar)
+			{
+				Log::Error("AudioLoader: Only interleaved PCM16 can be streamed: " + uuids::to_string(uuid));
+				return nullptr;
+			}
+
+			AudioStreamSource source;
+			source.path = file.path;
+			source.offset = file.offset + reader.GetPosition();
+			source.size = static_cast<uint64_t>(channels) * frameCount * sizeof(int16_t);
+
+			if (!reader.ReadBytes(source.size))
+			{
+				Log::Error("AudioLoader: Truncated data in: " + uuids::to_string(uuid));
+				return nullptr;
+			}
+
+			return std::make_shared<AudioAsset>(sampleRate, frameCount, channels, std::move(source));
+		}
+
 		switch (encoding)
 		{
 		case AudioEncoding::PCM16:
 		{
 			size_t totalSamples = static_cast<size_t>(channels) * frameCount;
-			std::vector<uint16_t> rawData(totalSamples);
-			reader.ReadRawBytes(reinterpret_cast<uint8_t*>(rawData.data()), totalSamples * sizeof(int16_t));
-
-			std::vector<std::vector<uint8_t>> channelData(channels);
+			std::vector<AssetBuffer<uint8_t>> channelData;
 
+			// Channels reference the file's data directly, planar data is split per channel
 			if (planar)
 			{
 				for (uint8_t channel = 0; channel < channels; ++channel)
-				{
-					channelData[channel].resize(frameCount * sizeof(int16_t));
-					std::memcpy(channelData[channel].data(), rawData.data() + channel * frameCount, frameCount * sizeof(int16_t));
-				}
+					channelData.push_back(reader.ReadBuffer<uint8_t>(frameCount * sizeof(int16_t)));
 			}
 			else
 			{
-				channelData[0].resize(totalSamples * sizeof(int16_t));
-				std::memcpy(channelData[0].data(), rawData.data(), totalSamples * sizeof(int16_t));
+				channelData.push_back(reader.ReadBuffer<uint8_t>(totalSamples * sizeof(int16_t)));
+				channelData.resize(channels);
+			}
+
+			if (!reader.IsValid())
+			{
+				Log::Error("AudioLoader: Truncated data in: " + uuids::to_string(uuid));
+				return nullptr;
 			}
 
 			return std::make_shared<AudioAsset>(sampleRate, frameCount, channels, encoding, std::move(channelData));
@@ -76,11 +92,14 @@ namespace Nightbird::Core
 			for (uint8_t channel = 0; channel < channels; ++channel)
 				channelSizes[channel] = reader.ReadUInt32();
 
-			std::vector<std::vector<uint8_t>> channelData(channels);
+			std::vector<AssetBuffer<uint8_t>> channelData;
 			for (uint8_t channel = 0; channel < channels; ++channel)
+				channelData.push_back(reader.ReadBuffer<uint8_t>(channelSizes[channel]));
+
+			if (!reader.IsValid())
 			{
-				channelData[channel].resize(channelSizes[channel]);
-				reader.ReadRawBytes(channelData[channel].data(), channelSizes[channel]);
+				Log::Error("AudioLoader: Truncated data in: " + uuids::to_string(uuid));
+				return nullptr;
 			}
 
 			return std::make_shared<AudioAsset>(sampleRate, frameCount, channels, encoding, std::move(channelData));
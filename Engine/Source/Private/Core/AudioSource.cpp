@@ -5,9 +5,9 @@
 #include "Core/Engine.h"
 #include "Core/Log.h"
 
-NB_REFLECT(Nightbird::Core::AudioSource, NB_PARENT(Nightbird::Core::SceneObject), NB_FACTORY(Nightbird::Core::AudioSource),
-	NB_FIELD(m_Audio), NB_FIELD(m_Loop), NB_FIELD(m_PlayOnStart), NB_FIELD(m_Volume)
-)
+#include <algorithm>
+
+NB_REFLECT_STATIC(Nightbird::Core::AudioSource, NB_FACTORY(Nightbird::Core::AudioSource))
 
 volatile int nb_link_AudioSource = 0;
 
@@ -24,11 +24,6 @@ namespace Nightbird::Core
 			Play();
 	}
 
-	void AudioSource::Tick(float delta)
-	{
-
-	}
-
 	void AudioSource::Play()
 	{
 		Engine* engine = GetEngine();
@@ -47,7 +42,7 @@ namespace Nightbird::Core
 		if (m_Handle != Audio::InvalidHandle)
 			Stop();
 		
-		m_Handle = engine->GetAudioProvider().Play(*m_Audio.Get(), m_Loop);
+		m_Handle = engine->GetAudioProvider().Play(*m_Audio.Get(), m_Loop, static_cast<Audio::Priority>(std::min<uint32_t>(m_Priority, 255)));
 
 		if (m_Handle == Audio::InvalidHandle)
 		{
@@ -143,4 +138,91 @@ namespace Nightbird::Core
 	{
 		m_PlayOnStart = playOnStart;
 	}
+
+	uint32_t AudioSource::GetPriority() const
+	{
+		return m_Priority;
+	}
+
+	void AudioSource::SetPriority(uint32_t priority)
+	{
+		m_Priority = priority;
+	}
+
+	bool AudioSource::IsSpatial() const
+	{
+		return m_Spatial;
+	}
+
+	void AudioSource::SetSpatial(bool spatial)
+	{
+		m_Spatial = spatial;
+
+		if (spatial || m_Handle == Audio::InvalidHandle)
+			return;
+
+		Engine* engine = GetEngine();
+		if (!engine)
+			return;
+
+		// Back to unpanned at the original pitch
+		Audio::SpatialParams params;
+		params.handle = m_Handle;
+		engine->GetAudioProvider().SetSpatialParams(&params, 1);
+	}
+
+	float AudioSource::GetMinDistance() const
+	{
+		return m_MinDistance;
+	}
+
+	void AudioSource::SetMinDistance(float minDistance)
+	{
+		m_MinDistance = minDistance;
+	}
+
+	float AudioSource::GetMaxDistance() const
+	{
+		return m_MaxDistance;
+	}
+
+	void AudioSource::SetMaxDistance(float maxDistance)
+	{
+		m_MaxDistance = maxDistance;
+	}
+
+	AudioAttenuation AudioSource::GetAttenuation() const
+	{
+		return static_cast<AudioAttenuation>(m_Attenuation);
+	}
+
+	void AudioSource::SetAttenuation(AudioAttenuation attenuation)
+	{
+		m_Attenuation = static_cast<uint32_t>(attenuation);
+	}
+
+	float AudioSource::GetRolloff() const
+	{
+		return m_Rolloff;
+	}
+
+	void AudioSource::SetRolloff(float rolloff)
+	{
+		m_Rolloff = rolloff;
+	}
+
+	float AudioSource::GetDopplerFactor() const
+	{
+		return m_DopplerFactor;
+	}
+
+	void AudioSource::SetDopplerFactor(float dopplerFactor)
+	{
+		m_DopplerFactor = dopplerFactor;
+	}
+
+	Audio::Handle AudioSource::GetHandle() const
+	{
+		return m_Handle;
+	}
 }
@@ -0,0 +1,244 @@
+#include "Core/AudioStream.h"
+
+#include "Core/Log.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+
+namespace Nightbird::Core
+{
+	// A chunk lasts at least ~85 ms even for 8 channels at 48 kHz, so this leaves plenty of headroom
+	static constexpr auto StreamInterval = std::chrono::milliseconds(10);
+
+	AudioStream::AudioStream(const AudioAsset& audio, bool loop)
+		: m_Source(audio.GetStreamSource()), m_FrameCount(audio.GetFrameCount()), m_Channels(audio.GetChannels()), m_SampleRate(audio.GetSampleRate()), m_Looping(loop)
+	{
+		m_FrameSize = std::max<uint32_t>(m_Channels, 1) * sizeof(int16_t);
+		m_ChunkFrames = static_cast<uint32_t>(ChunkSize / m_FrameSize);
+		m_RingFrames = m_ChunkFrames * static_cast<uint32_t>(ChunkCount);
+		m_Ring.resize(static_cast<size_t>(m_RingFrames) * m_Channels);
+	}
+
+	uint32_t AudioStream::GetFrameCount() const
+	{
+		return m_FrameCount;
+	}
+
+	uint8_t AudioStream::GetChannels() const
+	{
+		return m_Channels;
+	}
+
+	uint32_t AudioStream::GetSampleRate() const
+	{
+		return m_SampleRate;
+	}
+
+	bool AudioStream::IsReady() const
+	{
+		return m_Ready.load(std::memory_order_acquire);
+	}
+
+	uint32_t AudioStream::Read(int16_t* destination, uint32_t frameCount, bool& outAtEnd)
+	{
+		outAtEnd = m_FrameCount == 0 || m_Failed.load(std::memory_order_relaxed);
+		if (outAtEnd)
+			return 0;
+
+		uint64_t readIndex = m_ReadIndex.load(std::memory_order_relaxed);
+
+		// Loaded before the write index, which is always published first
+		uint64_t endIndex = m_EndIndex.load(std::memory_order_acquire);
+		uint64_t writeIndex = m_WriteIndex.load(std::memory_order_acquire);
+
+		uint32_t available = static_cast<uint32_t>(std::min<uint64_t>(writeIndex - readIndex, frameCount));
+
+		for (uint32_t copied = 0; copied < available;)
+		{
+			uint32_t position = static_cast<uint32_t>((readIndex + copied) % m_RingFrames);
+			uint32_t count = std::min(available - copied, m_RingFrames - position);
+			std::memcpy(destination + static_cast<size_t>(copied) * m_Channels, m_Ring.data() + static_cast<size_t>(position) * m_Channels, static_cast<size_t>(count) * m_FrameSize);
+			copied += count;
+		}
+
+		readIndex += available;
+		m_ReadIndex.store(readIndex, std::memory_order_release);
+
+		if (available == frameCount)
+			return frameCount;
+
+		if (readIndex >= endIndex)
+		{
+			outAtEnd = true;
+			return available;
+		}
+
+		// The streaming thread fell behind, play silence rather than stalling the mixer
+		std::memset(destination + static_cast<size_t>(available) * m_Channels, 0, static_cast<size_t>(frameCount - available) * m_FrameSize);
+		m_Underruns.fetch_add(1, std::memory_order_relaxed);
+		return frameCount;
+	}
+
+	void AudioStream::SetLooping(bool loop)
+	{
+		m_Looping.store(loop, std::memory_order_relaxed);
+	}
+
+	bool AudioStream::Fill()
+	{
+		bool filled = FillRing();
+		m_Ready.store(true, std::memory_order_release);
+		return filled;
+	}
+
+	bool AudioStream::FillRing()
+	{
+		if (m_Failed.load(std::memory_order_relaxed))
+			return false;
+
+		if (!m_File.is_open())
+		{
+			m_File.open(m_Source.path, std::ios::binary);
+			if (!m_File || !SeekFile(0))
+			{
+				Log::Error("AudioStream: Failed to open: " + m_Source.path);
+				m_Failed.store(true, std::memory_order_relaxed);
+				return false;
+			}
+		}
+
+		uint64_t writeIndex = m_WriteIndex.load(std::memory_order_relaxed);
+
+		while (m_EndIndex.load(std::memory_order_relaxed) == NoIndex)
+		{
+			uint64_t readIndex = m_ReadIndex.load(std::memory_order_acquire);
+
+			uint32_t free = m_RingFrames - static_cast<uint32_t>(writeIndex - readIndex);
+			uint32_t count = std::min(m_ChunkFrames, m_FrameCount - m_FileFrame);
+			if (count > free || count == 0)
+				break;
+
+			// The chunk may wrap around the end of the ring
+			for (uint32_t done = 0; done < count;)
+			{
+				uint32_t position = static_cast<uint32_t>((writeIndex + done) % m_RingFrames);
+				uint32_t part = std::min(count - done, m_RingFrames - position);
+				if (!m_File.read(reinterpret_cast<char*>(m_Ring.data() + static_cast<size_t>(position) * m_Channels), static_cast<std::streamsize>(part) * m_FrameSize))
+				{
+					Log::Error("AudioStream: Failed to read: " + m_Source.path);
+					m_Failed.store(true, std::memory_order_relaxed);
+					return false;
+				}
+				done += part;
+			}
+
+			writeIndex += count;
+			m_FileFrame += count;
+			m_WriteIndex.store(writeIndex, std::memory_order_release);
+
+			if (m_FileFrame < m_FrameCount)
+				continue;
+
+			if (m_Looping.load(std::memory_order_relaxed))
+			{
+				if (!SeekFile(0))
+					return false;
+			}
+			else
+			{
+				m_EndIndex.store(writeIndex, std::memory_order_release);
+			}
+		}
+
+		return true;
+	}
+
+	uint32_t AudioStream::GetUnderrunCount() const
+	{
+		return m_Underruns.load(std::memory_order_relaxed);
+	}
+
+	bool AudioStream::SeekFile(uint32_t frame)
+	{
+		m_File.clear();
+		m_File.seekg(static_cast<std::streamoff>(m_Source.offset + static_cast<uint64_t>(frame) * m_FrameSize));
+		if (!m_File)
+		{
+			Log::Error("AudioStream: Failed to seek: " + m_Source.path);
+			m_Failed.store(true, std::memory_order_relaxed);
+			return false;
+		}
+
+		m_FileFrame = frame;
+		return true;
+	}
+
+	AudioStreamer::~AudioStreamer()
+	{
+		Stop();
+	}
+
+	void AudioStreamer::Start()
+	{
+		std::lock_guard<std::mutex> lock(m_Mutex);
+		if (m_Running)
+			return;
+
+		m_Running = true;
+		m_Thread = std::thread(&AudioStreamer::Run, this);
+	}
+
+	void AudioStreamer::Stop()
+	{
+		{
+			std::lock_guard<std::mutex> lock(m_Mutex);
+			if (!m_Running)
+				return;
+
+			m_Running = false;
+		}
+
+		m_Condition.notify_all();
+		m_Thread.join();
+		m_Streams.clear();
+	}
+
+	void AudioStreamer::Add(std::shared_ptr<AudioStream> stream)
+	{
+		{
+			std::lock_guard<std::mutex> lock(m_Mutex);
+			m_Streams.push_back(std::move(stream));
+			m_Added = true;
+		}
+
+		m_Condition.notify_all();
+	}
+
+	void AudioStreamer::Remove(const AudioStream* stream)
+	{
+		std::lock_guard<std::mutex> lock(m_Mutex);
+		m_Streams.erase(std::remove_if(m_Streams.begin(), m_Streams.end(), [stream](const auto& entry) { return entry.get() == stream; }), m_Streams.end());
+	}
+
+	void AudioStreamer::Run()
+	{
+		std::vector<std::shared_ptr<AudioStream>> streams;
+
+		std::unique_lock<std::mutex> lock(m_Mutex);
+		while (m_Running)
+		{
+			// File reads happen outside the lock so adding and removing streams never waits on I/O
+			streams = m_Streams;
+			m_Added = false;
+			lock.unlock();
+
+			for (const auto& stream : streams)
+				stream->Fill();
+			streams.clear();
+
+			lock.lock();
+			m_Condition.wait_for(lock, StreamInterval, [this]() { return !m_Running || m_Added; });
+		}
+	}
+}
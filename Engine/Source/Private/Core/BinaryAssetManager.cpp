@@ -1,6 +1,8 @@
 #include "Core/BinaryAssetManager.h"
 
+#include "Core/BinaryReader.h"
 #include "Core/Scene.h"
+#include "Core/SceneTemplate.h"
 #include "Core/Mesh.h"
 #include "Core/Material.h"
 #include "Core/Texture.h"
@@ -19,26 +21,59 @@ namespace Nightbird::Core
 		m_MaterialLoader = std::make_unique<MaterialLoader>();
 		m_MeshLoader = std::make_unique<MeshLoader>();
 		m_AudioLoader = std::make_unique<AudioLoader>();
+
+		m_Pak.Open(m_CookedDir + "/" + Pak::FileName);
+	}
+
+	bool BinaryAssetManager::IsUsingPak() const
+	{
+		return m_Pak.IsOpen();
 	}
 
 	ProjectInfo BinaryAssetManager::LoadProject()
 	{
-		return m_ProjectLoader->Load(m_CookedDir);
+		BinaryReader reader;
+		if (const PakEntry* entry = m_Pak.IsOpen() ? m_Pak.Find(uuids::uuid()) : nullptr)
+			reader = m_Pak.OpenEntry(*entry);
+		else
+		{
+			reader = BinaryReader(m_CookedDir + "/Project.nbproject");
+		}
+
+		if (!reader.IsValid())
+		{
+			Log::Error("AssetLoader: Failed to open project in: " + m_CookedDir);
+			return {};
+		}
+
+		return m_ProjectLoader->Load(reader);
 	}
 	
 	std::shared_ptr<Mesh> BinaryAssetManager::LoadMesh(const uuids::uuid& uuid)
 	{
-		return m_MeshLoader->Load(*this, m_CookedDir, uuid);
+		BinaryReader reader = OpenAsset(uuid, ".nbmesh");
+		if (!reader.IsValid())
+			return nullptr;
+
+		return m_MeshLoader->Load(*this, reader, uuid);
 	}
 	
 	std::shared_ptr<Material> BinaryAssetManager::LoadMaterial(const uuids::uuid& uuid)
 	{
-		return m_MaterialLoader->Load(*this, m_CookedDir, uuid);
+		BinaryReader reader = OpenAsset(uuid, ".nbmaterial");
+		if (!reader.IsValid())
+			return nullptr;
+
+		return m_MaterialLoader->Load(*this, reader, uuid);
 	}
 
 	std::shared_ptr<Texture> BinaryAssetManager::LoadTexture(const uuids::uuid& uuid)
 	{
-		return m_TextureLoader->Load(m_CookedDir, uuid);
+		BinaryReader reader = OpenAsset(uuid, ".nbtexture");
+		if (!reader.IsValid())
+			return nullptr;
+
+		return m_TextureLoader->Load(reader, uuid);
 	}
 
 	std::shared_ptr<Cubemap> BinaryAssetManager::LoadCubemap(const uuids::uuid& uuid)
@@ -48,12 +83,33 @@ namespace Nightbird::Core
 
 	std::shared_ptr<AudioAsset> BinaryAssetManager::LoadAudio(const uuids::uuid& uuid)
 	{
-		return m_AudioLoader->Load(m_CookedDir, uuid);
+		BinaryReader reader = OpenAsset(uuid, ".nbaudio");
+		if (!reader.IsValid())
+			return nullptr;
+
+		// Same lookup as OpenAsset, streamed clips reopen the file to read their samples
+		AudioStreamSource file;
+		if (const PakEntry* entry = m_Pak.IsOpen() ? m_Pak.Find(uuid) : nullptr)
+		{
+			file.path = m_CookedDir + "/" + Pak::FileName;
+			file.offset = entry->offset;
+			file.size = entry->size;
+		}
+		else
+		{
+			file.path = m_CookedDir + "/" + uuids::to_string(uuid) + ".nbaudio";
+		}
+
+		return m_AudioLoader->Load(reader, uuid, file);
 	}
 
 	SceneReadResult BinaryAssetManager::LoadScene(const uuids::uuid& uuid)
 	{
-		SceneReadResult result = m_SceneReader->Read(m_CookedDir, uuid);
+		BinaryReader reader = OpenAsset(uuid, ".nbscene");
+		if (!reader.IsValid())
+			return {};
+
+		SceneReadResult result = m_SceneReader->Read(reader, uuid);
 		if (!result.root)
 		{
 			Log::Error("AssetLoader: Failed to read scene: " + uuids::to_string(uuid));
@@ -66,6 +122,23 @@ namespace Nightbird::Core
 		return result;
 	}
 
+	BinaryReader BinaryAssetManager::OpenAsset(const uuids::uuid& uuid, const char* extension)
+	{
+		if (m_Pak.IsOpen())
+		{
+			if (const PakEntry* entry = m_Pak.Find(uuid))
+				return m_Pak.OpenEntry(*entry);
+		}
+
+		std::string path = m_CookedDir + "/" + uuids::to_string(uuid) + extension;
+
+		BinaryReader reader(path);
+		if (!reader.IsValid())
+			Log::Error("AssetLoader: Failed to open: " + path);
+
+		return reader;
+	}
+
 	void BinaryAssetManager::LoadNestedScenes(SceneObject* object)
 	{
 		if (!object)
@@ -73,7 +146,12 @@ namespace Nightbird::Core
 
 		if (const auto& sceneUUID = object->GetSourceSceneUUID())
 		{
-			SceneReadResult nested = LoadScene(*sceneUUID);
+			// Every instance of the same prefab is copied from one cached template
+			std::shared_ptr<SceneTemplate> sceneTemplate = LoadShared<SceneTemplate>(*sceneUUID);
+
+			SceneReadResult nested;
+			if (sceneTemplate)
+				nested = sceneTemplate->Instantiate();
 
 			if (nested.root)
 			{
@@ -1,27 +1,73 @@
 #include "Core/BinaryReader.h"
 
+#include "Core/MappedFile.h"
 #include "Core/Vertex.h"
 
 #include <cstring>
+#include <fstream>
 
 namespace Nightbird::Core
 {
 	BinaryReader::BinaryReader(const std::string& path)
-		: m_File(path, std::ios::binary | std::ios::in)
+	{
+		if (std::shared_ptr<MappedFile> file = MappedFile::Open(path))
+		{
+			m_Data = file->GetData();
+			m_Size = file->GetSize();
+			m_Owner = std::move(file);
+			m_Valid = true;
+			return;
+		}
+
+		std::ifstream file(path, std::ios::binary | std::ios::in | std::ios::ate);
+		if (!file.is_open())
+			return;
+
+		std::streamsize size = file.tellg();
+		if (size < 0)
+			return;
+
+		auto data = std::make_shared<std::vector<uint8_t>>(static_cast<size_t>(size));
+		file.seekg(0);
+		if (!file.read(reinterpret_cast<char*>(data->data()), size))
+			return;
+
+		m_Data = data->data();
+		m_Size = data->size();
+		m_Owner = std::move(data);
+		m_Valid = true;
+	}
+
+	BinaryReader::BinaryReader(std::vector<uint8_t> data)
+	{
+		auto owned = std::make_shared<std::vector<uint8_t>>(std::move(data));
+		m_Data = owned->data();
+		m_Size = owned->size();
+		m_Owner = std::move(owned);
+		m_Valid = true;
+	}
+
+	BinaryReader::BinaryReader(std::shared_ptr<const void> owner, const uint8_t* data, size_t size)
+		: m_Owner(std::move(owner)), m_Data(data), m_Size(size), m_Valid(true)
 	{
 
 	}
 
 	bool BinaryReader::IsValid() const
 	{
-		return m_File.is_open() && m_File.good();
+		return m_Valid;
+	}
+
+	size_t BinaryReader::GetPosition() const
+	{
+		return m_Position;
 	}
 
 	template<typename T>
 	T BinaryReader::ReadValue()
 	{
 		uint8_t buffer[sizeof(T)];
-		m_File.read(reinterpret_cast<char*>(buffer), sizeof(T));
+		ReadRawBytes(buffer, sizeof(T));
 		T value;
 		std::memcpy(&value, buffer, sizeof(T));
 		return value;
@@ -30,7 +76,7 @@ namespace Nightbird::Core
 	uint8_t BinaryReader::ReadUInt8()
 	{
 		uint8_t value;
-		m_File.read(reinterpret_cast<char*>(&value), 1);
+		ReadRawBytes(&value, 1);
 		return value;
 	}
 
@@ -46,9 +92,7 @@ namespace Nightbird::Core
 
 	int8_t BinaryReader::ReadInt8()
 	{
-		int8_t value;
-		m_File.read(reinterpret_cast<char*>(&value), 1);
-		return value;
+		return static_cast<int8_t>(ReadUInt8());
 	}
 
 	int16_t BinaryReader::ReadInt16()
@@ -69,39 +113,51 @@ namespace Nightbird::Core
 	Vertex BinaryReader::ReadVertex()
 	{
 		Vertex vertex;
-		vertex.position.x = ReadFloat();
-		vertex.position.y = ReadFloat();
-		vertex.position.z = ReadFloat();
-		vertex.normal.x = ReadFloat();
-		vertex.normal.y = ReadFloat();
-		vertex.normal.z = ReadFloat();
-		vertex.baseColorTexCoord.x = ReadFloat();
-		vertex.baseColorTexCoord.y = ReadFloat();
-		vertex.metallicRoughnessTexCoord.x = ReadFloat();
-		vertex.metallicRoughnessTexCoord.y = ReadFloat();
-		vertex.normalTexCoord.x = ReadFloat();
-		vertex.normalTexCoord.y = ReadFloat();
+		ReadSpan(std::span<Vertex>(&vertex, 1));
 		return vertex;
 	}
 	
 	std::vector<Vertex> BinaryReader::ReadVertices(uint32_t count)
 	{
+		static_assert(sizeof(Vertex) == 12 * sizeof(float), "Vertex must match the cooked layout");
+
 		std::vector<Vertex> vertices(count);
-		for (auto& vertex : vertices)
-			vertex = ReadVertex();
+		ReadSpan(std::span<Vertex>(vertices));
 		return vertices;
 	}
 	
 	std::vector<uint16_t> BinaryReader::ReadIndices(uint32_t count)
 	{
 		std::vector<uint16_t> indices(count);
-		for (auto& index : indices)
-			index = ReadUInt16();
+		ReadSpan(std::span<uint16_t>(indices));
 		return indices;
 	}
 
 	void BinaryReader::ReadRawBytes(uint8_t* destination, size_t size)
 	{
-		m_File.read(reinterpret_cast<char*>(destination), size);
+		if (!m_Valid || size > m_Size - m_Position)
+		{
+			std::memset(destination, 0, size);
+			m_Position = m_Size;
+			m_Valid = false;
+			return;
+		}
+
+		std::memcpy(destination, m_Data + m_Position, size);
+		m_Position += size;
+	}
+
+	const uint8_t* BinaryReader::ReadBytes(size_t size)
+	{
+		if (!m_Valid || size > m_Size - m_Position)
+		{
+			m_Position = m_Size;
+			m_Valid = false;
+			return nullptr;
+		}
+
+		const uint8_t* data = m_Data + m_Position;
+		m_Position += size;
+		return data;
 	}
 }
@@ -10,46 +10,55 @@
 #include "Core/PointLight.h"
 #include "Core/Camera.h"
 #include "Core/AudioSource.h"
+#include "Core/SlabAllocator.h"
+#include "Core/SceneFormat.h"
+#include "Core/FieldLayout.h"
+#include "Core/TypeRegistry.h"
 #include "Core/Log.h"
 
 #include <glm/glm.hpp>
 #include <glm/gtc/quaternion.hpp>
 
+#include <cstring>
+#include <string_view>
 #include <vector>
 
 namespace Nightbird::Core
 {
-	SceneReadResult BinarySceneReader::Read(const std::string& cookedDir, const uuids::uuid& uuid)
+	SceneReadResult BinarySceneReader::Read(BinaryReader& reader, const uuids::uuid& uuid)
 	{
+		// Packs the scene's objects together in load order
+		SceneArena arena;
+		SceneArena::Scope arenaScope(arena);
+
 		SceneReadResult result;
 		result.root = std::make_unique<SceneObject>();
 
-		std::string path = cookedDir + "/" + uuids::to_string(uuid) + ".nbscene";
-
-		BinaryReader reader(path);
-		if (!reader.IsValid())
-		{
-			Core::Log::Error("BinarySceneReader: Failed to open: " + path);
-			return result;
-		}
-		
 		// Validate type
 		uint8_t signature[4] = {};
 		reader.ReadRawBytes(signature, 4);
 		if (signature[0] != 'S' || signature[1] != 'C' || signature[2] != 'N' || signature[3] != 'E')
 		{
-			Core::Log::Error("BinarySceneReader: Invalid type signature in: " + path);
+			Core::Log::Error("BinarySceneReader: Invalid type signature in: " + uuids::to_string(uuid));
 			return result;
 		}
 
-		// Check Version
 		uint32_t version = reader.ReadUInt32();
-		if (version != 1)
-		{
+		bool loaded = false;
+		if (version == 1)
+			loaded = ReadVersion1(reader, uuid, result);
+		else if (version == SceneFormat::Version)
+			loaded = ReadVersion2(reader, uuid, result);
+		else
 			Core::Log::Error("BinarySceneReader: Unsupported version: " + std::to_string(version));
-			return result;
-		}
 
+		if (loaded)
+			Core::Log::Info("BinarySceneReader: Loaded scene: " + uuids::to_string(uuid));
+		return result;
+	}
+
+	bool BinarySceneReader::ReadVersion1(BinaryReader& reader, const uuids::uuid& uuid, SceneReadResult& result)
+	{
 		// Scene name
 		uint32_t nameLength = reader.ReadUInt32();
 		std::string sceneName(nameLength, '\0');
@@ -112,13 +121,21 @@ namespace Nightbird::Core
 			{
 				object.reset(type->CreateAs<SceneObject>());
 				object->SetName(typeName);
-				ReadFields(reinterpret_cast<uint8_t*>(object.get()), type, reader);
+				if (!ReadFields(reinterpret_cast<uint8_t*>(object.get()), type, fieldCount, reader))
+				{
+					Log::Error("BinarySceneReader: Version 1 scene has fields that can no longer be read, re-cook it: " + uuids::to_string(uuid));
+					return false;
+				}
 			}
 			else
 			{
 				Log::Warning("BinarySceneReader: Unknown type " + typeName + ", defaulting to SceneObject");
 				object = std::make_unique<SceneObject>();
-				SkipFields(fieldCount, reader);
+				if (!SkipFields(fieldCount, reader))
+				{
+					Log::Error("BinarySceneReader: Version 1 scene has fields that can no longer be read, re-cook it: " + uuids::to_string(uuid));
+					return false;
+				}
 
 				Log::Info("BinarySceneReader: Available types are: ");
 				for (const auto* type : TypeRegistry::GetAll())
@@ -155,132 +172,345 @@ namespace Nightbird::Core
 				result.root->AddChild(std::move(ownedNodeMap[nodeUUID]));
 		}
 
-		Core::Log::Info("BinarySceneReader: Loaded scene: " + path);
-		return result;
+		return true;
 	}
 
-	void BinarySceneReader::ReadFields(uint8_t* object, const TypeInfo* type, BinaryReader& reader)
+	// Type of a version 2 file resolved against the registry. Uses the type's own decoder when
+	// the stored layout matches, otherwise one built from the fields that still exist.
+	struct PackedTypeLayout
 	{
-		if (!object || !type)
-			return;
+		std::string_view name;
+		const TypeInfo* type = nullptr;
+		bool remapped = false;
+		PackedDecoder remappedDecoder;
+		uint32_t blobSize = 0;
+		std::vector<uint32_t> nodes;
+	};
+
+	// Plain values are block copied by the decoder, this handles the ones that need converting
+	static void ReadPackedField(uint8_t* fieldPtr, FieldKind kind, const uint8_t* data, const std::vector<std::string_view>& strings)
+	{
+		switch (kind)
+		{
+		case FieldKind::Bool:
+			*reinterpret_cast<bool*>(fieldPtr) = data[0] != 0;
+			break;
+		case FieldKind::String:
+		{
+			uint32_t index;
+			std::memcpy(&index, data, sizeof(index));
+			*reinterpret_cast<std::string*>(fieldPtr) = index < strings.size() ? strings[index] : std::string_view();
+			break;
+		}
+		case FieldKind::UUID:
+		case FieldKind::AssetRef:
+		{
+			std::array<uint8_t, 16> bytes;
+			std::memcpy(bytes.data(), data, 16);
+			*reinterpret_cast<uuids::uuid*>(fieldPtr) = uuids::uuid(bytes);
+			break;
+		}
+		default:
+			break;
+		}
+	}
+
+	bool BinarySceneReader::ReadVersion2(BinaryReader& reader, const uuids::uuid& uuid, SceneReadResult& result)
+	{
+		// String table, views stay valid while the reader is alive
+		uint32_t stringCount = reader.ReadUInt32();
+		std::vector<std::string_view> strings;
+		for (uint32_t i = 0; i < stringCount && reader.IsValid(); ++i)
+		{
+			uint32_t length = reader.ReadUInt32();
+			const uint8_t* data = reader.ReadBytes(length);
+			strings.emplace_back(reinterpret_cast<const char*>(data), data ? length : 0);
+		}
+
+		auto getString = [&strings](uint32_t index)
+		{
+			return index < strings.size() ? strings[index] : std::string_view();
+		};
+
+		result.root->SetName(std::string(getString(reader.ReadUInt32())));
+
+		std::array<uint8_t, 16> sceneUUIDBytes;
+		reader.ReadRawBytes(sceneUUIDBytes.data(), 16);
+		result.uuid = uuids::uuid(sceneUUIDBytes);
+
+		uint32_t activeCameraIndex = reader.ReadUInt32();
+
+		// Type table, field layouts are matched once per type instead of once per node
+		uint32_t typeCount = reader.ReadUInt32();
+		std::vector<PackedTypeLayout> types;
+		std::vector<std::pair<uint32_t, FieldKind>> storedFields;
+
+		for (uint32_t i = 0; i < typeCount && reader.IsValid(); ++i)
+		{
+			PackedTypeLayout& layout = types.emplace_back();
+			layout.name = getString(reader.ReadUInt32());
+			layout.type = TypeRegistry::Find(layout.name);
+			if (layout.type && !layout.type->factory)
+				layout.type = nullptr;
+
+			if (!layout.type)
+				Log::Warning("BinarySceneReader: Unknown type " + std::string(layout.name) + ", defaulting to SceneObject");
+
+			uint16_t fieldCount = reader.ReadUInt16();
+			uint32_t fingerprint = FNVHash("");
+			storedFields.clear();
+			for (uint16_t f = 0; f < fieldCount; ++f)
+			{
+				uint32_t pathHash = reader.ReadUInt32();
+				FieldKind kind = static_cast<FieldKind>(reader.ReadUInt8());
+				storedFields.emplace_back(pathHash, kind);
+				fingerprint = HashPackedField(fingerprint, pathHash, kind);
+				layout.blobSize += GetPackedSize(kind);
+			}
+
+			if (!layout.type)
+				continue;
+
+			const FieldLayout* fieldLayout = layout.type->layout;
+			if (fieldLayout->GetFingerprint() == fingerprint && fieldLayout->GetFlatFields().size() == fieldCount)
+				continue;
+
+			// Written with an older layout, match the remaining fields by path hash and kind
+			uint32_t packedOffset = 0;
+			for (const auto& [pathHash, kind] : storedFields)
+			{
+				const FlatField* field = fieldLayout->FindFlat(pathHash);
+				if (field && field->kind == kind)
+					layout.remappedDecoder.Add({ pathHash, field->offset, packedOffset, kind });
+				else
+					Log::Warning("BinarySceneReader: No matching field found for hash " + std::to_string(pathHash) + " in " + std::string(layout.name) + ", skipping");
+
+				packedOffset += GetPackedSize(kind);
+			}
+			layout.remapped = true;
+		}
+
+		// Node table, parents always come before their children
+		uint32_t nodeCount = reader.ReadUInt32();
+		if (!reader.IsValid())
+		{
+			Log::Error("BinarySceneReader: Truncated scene: " + uuids::to_string(uuid));
+			return false;
+		}
+
+		std::vector<std::unique_ptr<SceneObject>> ownedNodes(nodeCount);
+		std::vector<SceneObject*> nodes(nodeCount);
+		std::vector<uint32_t> parents(nodeCount);
+
+		for (uint32_t i = 0; i < nodeCount; ++i)
+		{
+			uint32_t typeIndex = reader.ReadUInt32();
+			uint32_t parentIndex = reader.ReadUInt32();
+			uint8_t flags = reader.ReadUInt8();
+
+			if (typeIndex >= types.size() || !reader.IsValid())
+			{
+				Log::Error("BinarySceneReader: Invalid node table in: " + uuids::to_string(uuid));
+				return false;
+			}
+
+			PackedTypeLayout& layout = types[typeIndex];
+
+			std::unique_ptr<SceneObject> object;
+			if (layout.type)
+			{
+				object.reset(layout.type->CreateAs<SceneObject>());
+				object->SetName(std::string(layout.name));
+			}
+			else
+			{
+				object = std::make_unique<SceneObject>();
+			}
 
-		if (type->parent)
-			ReadFields(object, type->parent, reader);
+			if (flags & SceneFormat::HasSourceScene)
+			{
+				std::array<uint8_t, 16> bytes;
+				reader.ReadRawBytes(bytes.data(), 16);
+				object->SetSourceSceneUUID(uuids::uuid(bytes));
+			}
 
-		if (!type->HasFields())
-			return;
+			nodes[i] = object.get();
+			ownedNodes[i] = std::move(object);
+			parents[i] = parentIndex < i ? parentIndex : SceneFormat::InvalidIndex;
+			layout.nodes.push_back(i);
+		}
 
-		for (uint32_t i = 0; i < type->fieldCount; ++i)
+		// Field sections, one per type
+		for (const PackedTypeLayout& layout : types)
+		{
+			const uint8_t* data = reader.ReadBytes(static_cast<size_t>(layout.blobSize) * layout.nodes.size());
+			if (!data)
+			{
+				Log::Error("BinarySceneReader: Truncated field data in: " + uuids::to_string(uuid));
+				return false;
+			}
+
+			if (!layout.type)
+				continue;
+
+			// Statically reflected types unpack with code generated for their layout
+			const TypeOps* ops = layout.type->ops;
+			if (!layout.remapped && ops)
+			{
+				for (uint32_t node : layout.nodes)
+				{
+					ops->unpack(nodes[node], data, strings.data(), static_cast<uint32_t>(strings.size()));
+					data += layout.blobSize;
+				}
+				continue;
+			}
+
+			const PackedDecoder& decoder = layout.remapped ? layout.remappedDecoder : layout.type->layout->GetDecoder();
+			for (uint32_t node : layout.nodes)
+			{
+				uint8_t* object = reinterpret_cast<uint8_t*>(nodes[node]);
+
+				for (const PackedDecoder::Copy& copy : decoder.copies)
+					std::memcpy(object + copy.offset, data + copy.packedOffset, copy.size);
+
+				for (const FlatField& field : decoder.conversions)
+					ReadPackedField(object + field.offset, field.kind, data + field.packedOffset, strings);
+
+				data += layout.blobSize;
+			}
+		}
+
+		if (activeCameraIndex < nodeCount)
+			result.activeCamera = Cast<Camera>(nodes[activeCameraIndex]);
+
+		// Build scene hierarchy
+		for (uint32_t i = 0; i < nodeCount; ++i)
+		{
+			SceneObject* parent = parents[i] != SceneFormat::InvalidIndex ? nodes[parents[i]] : result.root.get();
+			parent->AddChild(std::move(ownedNodes[i]));
+		}
+
+		return true;
+	}
+
+	bool BinarySceneReader::ReadFields(uint8_t* object, const TypeInfo* type, uint32_t fieldCount, BinaryReader& reader)
+	{
+		if (!object || !type || !type->layout)
+			return false;
+
+		const FieldLayout& layout = *type->layout;
+		const std::vector<const FieldInfo*>& fields = layout.GetFields();
+		for (uint32_t i = 0; i < fieldCount; ++i)
 		{
 			uint32_t nameHash = reader.ReadUInt32();
 			uint16_t size = reader.ReadUInt16();
-			ReadField(object, type, nameHash, size, reader);
+
+			// Files written with the current layout store the fields in this order, no lookup needed
+			const FieldInfo* field = i < fields.size() && fields[i]->nameHash == nameHash ? fields[i] : layout.Find(nameHash);
+			if (!ReadField(object, field, nameHash, size, reader) || !reader.IsValid())
+				return false;
 		}
+
+		return true;
 	}
 	
-	void BinarySceneReader::ReadField(uint8_t* object, const TypeInfo* type, uint32_t nameHash, uint16_t size, BinaryReader& reader)
+	bool BinarySceneReader::ReadField(uint8_t* object, const FieldInfo* field, uint32_t nameHash, uint16_t size, BinaryReader& reader)
 	{
-		for (const TypeInfo* t = type; t!= nullptr; t = t->parent)
+		if (field)
 		{
-			for (uint16_t i = 0; i < t->fieldCount; ++i)
+			uint8_t* fieldPtr = object + field->offset;
+			
+			if (size == 0)
 			{
-				const FieldInfo& field = t->fields[i];
-				if (field.nameHash != nameHash)
-					continue;
+				// Nested fields follow inline without a count, so they have to match the current layout
+				if (field->kind == FieldKind::Object && field->type && field->type->layout)
+					return ReadFields(fieldPtr, field->type, static_cast<uint32_t>(field->type->layout->GetFields().size()), reader);
 
-				uint8_t* fieldPtr = object + field.offset;
-				
-				if (size == 0)
-				{
-					if (field.kind == FieldKind::Object && field.type)
-						ReadFields(fieldPtr, field.type, reader);
-					else
-						Log::Warning("BinarySceneReader: Size 0 for non-object field with hash: " + std::to_string(nameHash));
-					return;
-				}
+				Log::Warning("BinarySceneReader: Size 0 for non-object field with hash: " + std::to_string(nameHash));
+				return true;
+			}
 
-				switch (field.kind)
-				{
-				case FieldKind::Bool:
-					*reinterpret_cast<bool*>(fieldPtr) = reader.ReadUInt8() != 0;
-					break;
-				case FieldKind::Int32:
-					*reinterpret_cast<int32_t*>(fieldPtr) = reader.ReadInt32();
-					break;
-				case FieldKind::UInt32:
-					*reinterpret_cast<uint32_t*>(fieldPtr) = reader.ReadUInt32();
-					break;
-				case FieldKind::Float:
-					*reinterpret_cast<float*>(fieldPtr) = reader.ReadFloat();
-					break;
-				case FieldKind::String:
-				{
-					uint32_t length = reader.ReadUInt32();
-					std::string string(length, '\0');
-					reader.ReadRawBytes(reinterpret_cast<uint8_t*>(string.data()), length);
-					*reinterpret_cast<std::string*>(fieldPtr) = std::move(string);
-					break;
-				}
-				case FieldKind::Vector2:
-				{
-					auto* vec = reinterpret_cast<glm::vec2*>(fieldPtr);
-					vec->x = reader.ReadFloat();
-					vec->y = reader.ReadFloat();
-					break;
-				}
-				case FieldKind::Vector3:
-				{
-					auto* vec = reinterpret_cast<glm::vec3*>(fieldPtr);
-					vec->x = reader.ReadFloat();
-					vec->y = reader.ReadFloat();
-					vec->z = reader.ReadFloat();
-					break;
-				}
-				case FieldKind::Vector4:
-				{
-					auto* vec = reinterpret_cast<glm::vec4*>(fieldPtr);
-					vec->x = reader.ReadFloat();
-					vec->y = reader.ReadFloat();
-					vec->z = reader.ReadFloat();
-					vec->w = reader.ReadFloat();
-					break;
-				}
-				case FieldKind::Quat:
-				{
-					auto* quat = reinterpret_cast<glm::quat*>(fieldPtr);
-					quat->x = reader.ReadFloat();
-					quat->y = reader.ReadFloat();
-					quat->z = reader.ReadFloat();
-					quat->w = reader.ReadFloat();
-					break;
-				}
-				case FieldKind::UUID:
-				{
-					std::array<uint8_t, 16> bytes;
-					reader.ReadRawBytes(bytes.data(), 16);
-					*reinterpret_cast<uuids::uuid*>(fieldPtr) = uuids::uuid(bytes);
-					break;
-				}
-				case FieldKind::AssetRef:
+			switch (field->kind)
+			{
+			case FieldKind::Bool:
+				*reinterpret_cast<bool*>(fieldPtr) = reader.ReadUInt8() != 0;
+				break;
+			case FieldKind::Int32:
+				*reinterpret_cast<int32_t*>(fieldPtr) = reader.ReadInt32();
+				break;
+			case FieldKind::UInt32:
+				*reinterpret_cast<uint32_t*>(fieldPtr) = reader.ReadUInt32();
+				break;
+			case FieldKind::Float:
+				*reinterpret_cast<float*>(fieldPtr) = reader.ReadFloat();
+				break;
+			case FieldKind::String:
+			{
+				uint32_t length = reader.ReadUInt32();
+				std::string string(length, '\0');
+				reader.ReadRawBytes(reinterpret_cast<uint8_t*>(string.data()), length);
+				*reinterpret_cast<std::string*>(fieldPtr) = std::move(string);
+				break;
+			}
+			case FieldKind::Vector2:
+			{
+				auto* vec = reinterpret_cast<glm::vec2*>(fieldPtr);
+				vec->x = reader.ReadFloat();
+				vec->y = reader.ReadFloat();
+				break;
+			}
+			case FieldKind::Vector3:
+			{
+				auto* vec = reinterpret_cast<glm::vec3*>(fieldPtr);
+				vec->x = reader.ReadFloat();
+				vec->y = reader.ReadFloat();
+				vec->z = reader.ReadFloat();
+				break;
+			}
+			case FieldKind::Vector4:
+			{
+				auto* vec = reinterpret_cast<glm::vec4*>(fieldPtr);
+				vec->x = reader.ReadFloat();
+				vec->y = reader.ReadFloat();
+				vec->z = reader.ReadFloat();
+				vec->w = reader.ReadFloat();
+				break;
+			}
+			case FieldKind::Quat:
+			{
+				auto* quat = reinterpret_cast<glm::quat*>(fieldPtr);
+				quat->x = reader.ReadFloat();
+				quat->y = reader.ReadFloat();
+				quat->z = reader.ReadFloat();
+				quat->w = reader.ReadFloat();
+				break;
+			}
+			case FieldKind::UUID:
+			{
+				std::array<uint8_t, 16> bytes;
+				reader.ReadRawBytes(bytes.data(), 16);
+				*reinterpret_cast<uuids::uuid*>(fieldPtr) = uuids::uuid(bytes);
+				break;
+			}
+			case FieldKind::AssetRef:
+			{
+				std::array<uint8_t, 16> bytes;
+				reader.ReadRawBytes(bytes.data(), 16);
+				*reinterpret_cast<uuids::uuid*>(fieldPtr) = uuids::uuid(bytes);
+				break;
+			}
+			default:
+				Core::Log::Info("BinarySceneReader: Unhandled FieldKind:");
+			case FieldKind::Unknown:
+				Core::Log::Info("BinarySceneReader: Unknown FieldKind for hash: " + std::to_string(nameHash));
+				if (size > 0)
 				{
-					std::array<uint8_t, 16> bytes;
-					reader.ReadRawBytes(bytes.data(), 16);
-					*reinterpret_cast<uuids::uuid*>(fieldPtr) = uuids::uuid(bytes);
-					break;
+					std::vector<uint8_t> discard(size);
+					reader.ReadRawBytes(discard.data(), size);
 				}
-				default:
-					Core::Log::Info("BinarySceneReader: Unhandled FieldKind:");
-				case FieldKind::Unknown:
-					Core::Log::Info("BinarySceneReader: Unknown FieldKind for hash: " + std::to_string(nameHash));
-					if (size > 0)
-					{
-						std::vector<uint8_t> discard(size);
-						reader.ReadRawBytes(discard.data(), size);
-					}
-					break;
-				}
-				return;
+				break;
 			}
+			return true;
 		}
 
 		// Mo matching FieldKind found
@@ -289,14 +519,14 @@ namespace Nightbird::Core
 			Log::Warning("BinarySceneReader: No matching FieldKind found for hash: " + std::to_string(nameHash) + ", skipping " + std::to_string(size) + " bytes");
 			std::vector<uint8_t> discard(size);
 			reader.ReadRawBytes(discard.data(), size);
+			return true;
 		}
-		else
-		{
-			Log::Warning("BinarySceneReader: Unknown nested type with hash " + std::to_string(nameHash) + ", cannot skip safely");
-		}
+
+		Log::Warning("BinarySceneReader: Unknown nested type with hash " + std::to_string(nameHash) + ", cannot skip safely");
+		return false;
 	}
 
-	void BinarySceneReader::SkipFields(uint16_t fieldCount, BinaryReader& reader)
+	bool BinarySceneReader::SkipFields(uint16_t fieldCount, BinaryReader& reader)
 	{
 		for (uint16_t i = 0; i < fieldCount; ++i)
 		{
@@ -310,7 +540,10 @@ namespace Nightbird::Core
 			else
 			{
 				Log::Warning("BinarySceneReader: Cannot safely skip unknown nested Object field");
+				return false;
 			}
 		}
+
+		return reader.IsValid();
 	}
 }
@@ -2,9 +2,7 @@
 
 #include <glm/gtc/matrix_transform.hpp>
 
-NB_REFLECT(Nightbird::Core::Camera, NB_PARENT(Nightbird::Core::SpatialObject), NB_FACTORY(Nightbird::Core::Camera),
-	NB_FIELD(m_Fov)
-)
+NB_REFLECT_STATIC(Nightbird::Core::Camera, NB_FACTORY(Nightbird::Core::Camera))
 
 namespace Nightbird::Core
 {
@@ -19,6 +19,9 @@ namespace Nightbird::Core
 	Engine::Engine(Platform& platform, Renderer& renderer, AssetManager& assetManager)
 		: m_Platform(platform), m_Renderer(renderer), m_AssetManager(assetManager)
 	{
+		m_AssetManager.SetJobSystem(&m_JobSystem);
+		m_AssetManager.SetMemoryBudget(m_Platform.GetAssetMemoryBudget());
+
 		m_Scene = std::make_unique<Scene>();
 		
 		if (m_Scene)
@@ -31,6 +34,9 @@ namespace Nightbird::Core
 
 	Engine::~Engine()
 	{
+		m_AssetManager.WaitForAsyncLoads();
+		m_AssetManager.SetJobSystem(nullptr);
+
 		m_Renderer.Shutdown();
 		m_Platform.Shutdown();
 	}
@@ -50,6 +56,7 @@ namespace Nightbird::Core
 
 		m_Platform.Update();
 		m_InputSystem.Update(m_Platform.GetInputProvider());
+		m_AssetManager.Update();
 		m_Scene->Update(m_DeltaTime);
 
 		return m_DeltaTime;
@@ -96,6 +103,11 @@ namespace Nightbird::Core
 		return m_AssetManager;
 	}
 
+	JobSystem& Engine::GetJobSystem()
+	{
+		return m_JobSystem;
+	}
+
 	float Engine::GetDeltaTime() const
 	{
 		return m_DeltaTime;
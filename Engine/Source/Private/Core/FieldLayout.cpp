@@ -0,0 +1,105 @@
+#include "Core/FieldLayout.h"
+
+#include <algorithm>
+
+namespace Nightbird
+{
+	static const std::pair<uint32_t, uint32_t>* FindHash(const std::vector<std::pair<uint32_t, uint32_t>>& lookup, uint32_t hash) noexcept
+	{
+		auto it = std::lower_bound(lookup.begin(), lookup.end(), hash,
+			[](const std::pair<uint32_t, uint32_t>& entry, uint32_t value) { return entry.first < value; });
+		return it != lookup.end() && it->first == hash ? &*it : nullptr;
+	}
+
+	void PackedDecoder::Add(const FlatField& field)
+	{
+		if (!IsPlainPackedKind(field.kind))
+		{
+			conversions.push_back(field);
+			return;
+		}
+
+		uint32_t size = Nightbird::GetPackedSize(field.kind);
+		if (!copies.empty())
+		{
+			Copy& last = copies.back();
+			if (last.offset + last.size == field.offset && last.packedOffset + last.size == field.packedOffset)
+			{
+				last.size += size;
+				return;
+			}
+		}
+
+		copies.push_back({ field.offset, field.packedOffset, size });
+	}
+
+	FieldLayout::FieldLayout(const TypeInfo* type)
+	{
+		std::vector<const TypeInfo*> chain;
+		for (const TypeInfo* current = type; current; current = current->parent)
+			chain.push_back(current);
+
+		for (auto it = chain.rbegin(); it != chain.rend(); ++it)
+		{
+			for (const FieldInfo* field = (*it)->Begin(); field != (*it)->End(); ++field)
+				m_Fields.push_back(field);
+		}
+
+		Flatten(type, 0, 0);
+
+		for (const FlatField& field : m_FlatFields)
+		{
+			m_Fingerprint = HashPackedField(m_Fingerprint, field.pathHash, field.kind);
+			m_Decoder.Add(field);
+		}
+
+		for (uint32_t i = 0; i < static_cast<uint32_t>(m_Fields.size()); ++i)
+			m_FieldLookup.emplace_back(m_Fields[i]->nameHash, i);
+		for (uint32_t i = 0; i < static_cast<uint32_t>(m_FlatFields.size()); ++i)
+			m_FlatLookup.emplace_back(m_FlatFields[i].pathHash, i);
+
+		// Later fields first among equal hashes, so a subclass field hides a parent field of the same name
+		auto compare = [](const std::pair<uint32_t, uint32_t>& a, const std::pair<uint32_t, uint32_t>& b)
+		{
+			return a.first != b.first ? a.first < b.first : a.second > b.second;
+		};
+		std::sort(m_FieldLookup.begin(), m_FieldLookup.end(), compare);
+		std::sort(m_FlatLookup.begin(), m_FlatLookup.end(), compare);
+	}
+
+	const FieldInfo* FieldLayout::Find(uint32_t nameHash) const noexcept
+	{
+		const auto* entry = FindHash(m_FieldLookup, nameHash);
+		return entry ? m_Fields[entry->second] : nullptr;
+	}
+
+	const FlatField* FieldLayout::FindFlat(uint32_t pathHash) const noexcept
+	{
+		const auto* entry = FindHash(m_FlatLookup, pathHash);
+		return entry ? &m_FlatFields[entry->second] : nullptr;
+	}
+
+	void FieldLayout::Flatten(const TypeInfo* type, uint32_t baseOffset, uint32_t parentHash)
+	{
+		if (!type)
+			return;
+
+		if (type->parent)
+			Flatten(type->parent, baseOffset, parentHash);
+
+		for (const FieldInfo* field = type->Begin(); field != type->End(); ++field)
+		{
+			uint32_t pathHash = parentHash ? CombineFieldHash(parentHash, field->nameHash) : field->nameHash;
+
+			if (field->kind == FieldKind::Object)
+			{
+				Flatten(field->type, baseOffset + field->offset, pathHash);
+			}
+			else if (uint32_t size = Nightbird::GetPackedSize(field->kind))
+			{
+				m_FlatFields.push_back({ pathHash, baseOffset + field->offset, m_PackedSize, field->kind });
+				m_PackedSize += size;
+			}
+		}
+	}
+}
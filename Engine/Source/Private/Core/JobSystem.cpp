@@ -0,0 +1,225 @@
+#include "Core/JobSystem.h"
+
+#include "Core/Log.h"
+
+#include <algorithm>
+
+namespace Nightbird::Core
+{
+	static thread_local const JobSystem* t_JobSystem = nullptr;
+	static thread_local uint32_t t_QueueIndex = 0;
+
+	bool JobCounter::IsDone() const
+	{
+		return m_Pending.load(std::memory_order_acquire) == 0;
+	}
+
+	JobSystem::JobSystem(uint32_t workerCount)
+	{
+		m_Queues.reserve(workerCount + 1);
+		for (uint32_t i = 0; i < workerCount + 1; ++i)
+			m_Queues.push_back(std::make_unique<Queue>());
+
+		t_JobSystem = this;
+		t_QueueIndex = 0;
+
+		m_Workers.reserve(workerCount);
+		for (uint32_t i = 0; i < workerCount; ++i)
+			m_Workers.emplace_back(&JobSystem::WorkerLoop, this, i + 1);
+
+		Log::Info("JobSystem started with " + std::to_string(workerCount) + " workers");
+	}
+
+	JobSystem::~JobSystem()
+	{
+		{
+			std::lock_guard<std::mutex> lock(m_SleepMutex);
+			m_Running = false;
+		}
+		m_WakeCondition.notify_all();
+
+		for (auto& worker : m_Workers)
+			worker.join();
+
+		if (t_JobSystem == this)
+			t_JobSystem = nullptr;
+	}
+
+	void JobSystem::Run(JobFunction function, JobCounter* counter, JobCounter* dependency)
+	{
+		if (counter)
+			counter->m_Pending.fetch_add(1, std::memory_order_relaxed);
+
+		if (dependency)
+		{
+			std::lock_guard<std::mutex> lock(dependency->m_Mutex);
+			if (dependency->m_Pending.load(std::memory_order_acquire) > 0)
+			{
+				dependency->m_Continuations.push_back({ std::move(function), counter });
+				return;
+			}
+		}
+
+		Push({ std::move(function), counter });
+	}
+
+	void JobSystem::Wait(JobCounter& counter)
+	{
+		uint32_t queueIndex = GetCurrentQueueIndex();
+
+		while (!counter.IsDone())
+		{
+			if (!TryRunJob(queueIndex))
+				std::this_thread::yield();
+		}
+
+		// The last job may still be inside Finish, don't let the caller destroy the counter under it
+		std::lock_guard<std::mutex> lock(counter.m_Mutex);
+	}
+
+	void JobSystem::ParallelFor(uint32_t count, uint32_t batchSize, const RangeFunction& function)
+	{
+		if (count == 0)
+			return;
+
+		batchSize = std::max(batchSize, 1u);
+
+		if (m_Workers.empty() || count <= batchSize)
+		{
+			function(0, count);
+			return;
+		}
+
+		JobCounter counter;
+		for (uint32_t begin = 0; begin < count; begin += batchSize)
+		{
+			uint32_t end = std::min(begin + batchSize, count);
+			Run([&function, begin, end]() { function(begin, end); }, &counter);
+		}
+
+		Wait(counter);
+	}
+
+	uint32_t JobSystem::GetWorkerCount() const
+	{
+		return static_cast<uint32_t>(m_Workers.size());
+	}
+
+	uint32_t JobSystem::GetDefaultWorkerCount()
+	{
+		// One core is left for the main thread, which also runs jobs while waiting
+		uint32_t cores = std::thread::hardware_concurrency();
+		return cores > 1 ? cores - 1 : 0;
+	}
+
+	void JobSystem::WorkerLoop(uint32_t queueIndex)
+	{
+		t_JobSystem = this;
+		t_QueueIndex = queueIndex;
+
+		while (m_Running.load(std::memory_order_acquire))
+		{
+			if (TryRunJob(queueIndex))
+				continue;
+
+			std::unique_lock<std::mutex> lock(m_SleepMutex);
+			m_WakeCondition.wait(lock, [this]() { return m_QueuedJobs.load(std::memory_order_acquire) > 0 || !m_Running; });
+		}
+	}
+
+	void JobSystem::Push(Job job)
+	{
+		// Without workers nothing would pick the job up unless someone waits, so run it right away
+		if (m_Workers.empty())
+		{
+			Execute(job);
+			return;
+		}
+
+		Queue& queue = *m_Queues[GetCurrentQueueIndex()];
+		{
+			std::lock_guard<std::mutex> lock(queue.mutex);
+			queue.jobs.push_back(std::move(job));
+		}
+
+		m_QueuedJobs.fetch_add(1, std::memory_order_release);
+
+		{
+			std::lock_guard<std::mutex> lock(m_SleepMutex);
+		}
+		m_WakeCondition.notify_one();
+	}
+
+	bool JobSystem::TryPop(uint32_t queueIndex, Job& job)
+	{
+		Queue& queue = *m_Queues[queueIndex];
+		std::lock_guard<std::mutex> lock(queue.mutex);
+
+		if (queue.jobs.empty())
+			return false;
+
+		job = std::move(queue.jobs.back());
+		queue.jobs.pop_back();
+		m_QueuedJobs.fetch_sub(1, std::memory_order_relaxed);
+		return true;
+	}
+
+	bool JobSystem::TrySteal(uint32_t queueIndex, Job& job)
+	{
+		const uint32_t queueCount = static_cast<uint32_t>(m_Queues.size());
+
+		for (uint32_t offset = 1; offset < queueCount; ++offset)
+		{
+			Queue& queue = *m_Queues[(queueIndex + offset) % queueCount];
+			std::lock_guard<std::mutex> lock(queue.mutex);
+
+			if (queue.jobs.empty())
+				continue;
+
+			job = std::move(queue.jobs.front());
+			queue.jobs.pop_front();
+			m_QueuedJobs.fetch_sub(1, std::memory_order_relaxed);
+			return true;
+		}
+
+		return false;
+	}
+
+	bool JobSystem::TryRunJob(uint32_t queueIndex)
+	{
+		Job job;
+		if (!TryPop(queueIndex, job) && !TrySteal(queueIndex, job))
+			return false;
+
+		Execute(job);
+		return true;
+	}
+
+	void JobSystem::Execute(Job& job)
+	{
+		if (job.function)
+			job.function();
+
+		if (job.counter)
+			Finish(job.counter);
+	}
+
+	void JobSystem::Finish(JobCounter* counter)
+	{
+		std::vector<JobCounter::Continuation> continuations;
+		{
+			std::lock_guard<std::mutex> lock(counter->m_Mutex);
+			if (counter->m_Pending.fetch_sub(1, std::memory_order_acq_rel) == 1)
+				continuations.swap(counter->m_Continuations);
+		}
+
+		for (auto& continuation : continuations)
+			Push({ std::move(continuation.function), continuation.counter });
+	}
+
+	uint32_t JobSystem::GetCurrentQueueIndex() const
+	{
+		// Threads outside the pool share the main thread's queue
+		return t_JobSystem == this ? t_QueueIndex : 0;
+	}
+}
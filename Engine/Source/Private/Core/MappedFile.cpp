@@ -0,0 +1,106 @@
+#include "Core/MappedFile.h"
+
+#if defined(_WIN32)
+	#ifndef NOMINMAX
+		#define NOMINMAX
+	#endif
+	#include <Windows.h>
+#elif defined(__linux__) || defined(__APPLE__)
+	#define NB_MAPPED_FILE_POSIX 1
+	#include <fcntl.h>
+	#include <sys/mman.h>
+	#include <sys/stat.h>
+	#include <unistd.h>
+#endif
+
+namespace Nightbird::Core
+{
+	MappedFile::~MappedFile()
+	{
+#if defined(_WIN32)
+		if (m_Data)
+			UnmapViewOfFile(m_Data);
+		if (m_Mapping)
+			CloseHandle(m_Mapping);
+		if (m_File)
+			CloseHandle(m_File);
+#elif defined(NB_MAPPED_FILE_POSIX)
+		if (m_Data)
+			munmap(const_cast<uint8_t*>(m_Data), m_Size);
+#endif
+	}
+
+	std::shared_ptr<MappedFile> MappedFile::Open(const std::string& path)
+	{
+#if defined(_WIN32)
+		std::shared_ptr<MappedFile> file(new MappedFile());
+
+		file->m_File = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+		if (file->m_File == INVALID_HANDLE_VALUE)
+		{
+			file->m_File = nullptr;
+			return nullptr;
+		}
+
+		LARGE_INTEGER size;
+		if (!GetFileSizeEx(file->m_File, &size) || size.QuadPart == 0)
+			return nullptr;
+
+		file->m_Mapping = CreateFileMappingA(file->m_File, nullptr, PAGE_READONLY, 0, 0, nullptr);
+		if (!file->m_Mapping)
+			return nullptr;
+
+		file->m_Data = static_cast<const uint8_t*>(MapViewOfFile(file->m_Mapping, FILE_MAP_READ, 0, 0, 0));
+		if (!file->m_Data)
+			return nullptr;
+
+		file->m_Size = static_cast<size_t>(size.QuadPart);
+		return file;
+#elif defined(NB_MAPPED_FILE_POSIX)
+		int descriptor = open(path.c_str(), O_RDONLY);
+		if (descriptor < 0)
+			return nullptr;
+
+		struct stat info;
+		if (fstat(descriptor, &info) != 0 || info.st_size == 0)
+		{
+			close(descriptor);
+			return nullptr;
+		}
+
+		void* data = mmap(nullptr, static_cast<size_t>(info.st_size), PROT_READ, MAP_PRIVATE, descriptor, 0);
+
+		// The mapping keeps the file referenced on its own
+		close(descriptor);
+
+		if (data == MAP_FAILED)
+			return nullptr;
+
+		std::shared_ptr<MappedFile> file(new MappedFile());
+		file->m_Data = static_cast<const uint8_t*>(data);
+		file->m_Size = static_cast<size_t>(info.st_size);
+		return file;
+#else
+		return nullptr;
+#endif
+	}
+
+	bool MappedFile::IsSupported()
+	{
+#if defined(_WIN32) || defined(NB_MAPPED_FILE_POSIX)
+		return true;
+#else
+		return false;
+#endif
+	}
+
+	const uint8_t* MappedFile::GetData() const
+	{
+		return m_Data;
+	}
+
+	size_t MappedFile::GetSize() const
+	{
+		return m_Size;
+	}
+}
@@ -7,28 +7,21 @@
 #include "Core/Texture.h"
 #include "Core/Log.h"
 
+#include <algorithm>
 #include <array>
 #include <cstdint>
+#include <optional>
 
 namespace Nightbird::Core
 {
-	std::shared_ptr<Material> MaterialLoader::Load(AssetManager& assetManager, const std::string& cookedDir, const uuids::uuid& uuid)
+	std::shared_ptr<Material> MaterialLoader::Load(AssetManager& assetManager, BinaryReader& reader, const uuids::uuid& uuid)
 	{
-		std::string path = cookedDir  + "/" + uuids::to_string(uuid) + ".nbmaterial";
-
-		BinaryReader reader(path);
-		if (!reader.IsValid())
-		{
-			Log::Error("MaterialLoader: Failed to open: " + path);
-			return nullptr;
-		}
-
 		// Validate type		
 		uint8_t type[4] = {};
 		reader.ReadRawBytes(type, 4);
 		if (type[0] != 'M' || type[1] != 'A' || type[2] != 'T' || type[3] != 'L')
 		{
-			Log::Error("MaterialLoader: Invalid type signature in: " + path);
+			Log::Error("MaterialLoader: Invalid type signature in: " + uuids::to_string(uuid));
 			return nullptr;
 		}
 
@@ -51,33 +44,33 @@ namespace Nightbird::Core
 		material->transparencyEnabled = reader.ReadUInt8();
 		material->doubleSided = reader.ReadUInt8();
 
-		uint8_t hasBaseColor = reader.ReadUInt8();
-		if (hasBaseColor)
-		{
-			std::array<uint8_t, 16> uuidBytes;
-			reader.ReadRawBytes(uuidBytes.data(), 16);
-			uuids::uuid textureUUID(uuidBytes);
-			material->baseColorTexture = assetManager.Load<Texture>(textureUUID).lock();
-		}
+		// Base color, metallic roughness, normal
+		std::optional<uuids::uuid> textureUUIDs[3];
+		std::vector<uuids::uuid> uniqueTextureUUIDs;
 
-		uint8_t hasMetallicRoughness = reader.ReadUInt8();
-		if (hasMetallicRoughness)
+		for (auto& textureUUID : textureUUIDs)
 		{
-			std::array<uint8_t, 16> uuidBytes;
-			reader.ReadRawBytes(uuidBytes.data(), 16);
-			uuids::uuid textureUUID(uuidBytes);
-			material->metallicRoughnessTexture = assetManager.Load<Texture>(textureUUID).lock();
-		}
+			uint8_t hasTexture = reader.ReadUInt8();
+			if (!hasTexture)
+				continue;
 
-		uint8_t hasNormal = reader.ReadUInt8();
-		if (hasNormal)
-		{
 			std::array<uint8_t, 16> uuidBytes;
 			reader.ReadRawBytes(uuidBytes.data(), 16);
-			uuids::uuid textureUUID(uuidBytes);
-			material->normalTexture = assetManager.Load<Texture>(textureUUID).lock();
+			textureUUID = uuids::uuid(uuidBytes);
+
+			if (std::find(uniqueTextureUUIDs.begin(), uniqueTextureUUIDs.end(), *textureUUID) == uniqueTextureUUIDs.end())
+				uniqueTextureUUIDs.push_back(*textureUUID);
 		}
 
+		assetManager.LoadParallel<Texture>(uniqueTextureUUIDs);
+
+		if (textureUUIDs[0])
+			material->baseColorTexture = assetManager.LoadShared<Texture>(*textureUUIDs[0]);
+		if (textureUUIDs[1])
+			material->metallicRoughnessTexture = assetManager.LoadShared<Texture>(*textureUUIDs[1]);
+		if (textureUUIDs[2])
+			material->normalTexture = assetManager.LoadShared<Texture>(*textureUUIDs[2]);
+
 		return material;
 	}
 }
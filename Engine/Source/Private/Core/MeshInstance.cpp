@@ -1,14 +1,17 @@
 #include "Core/MeshInstance.h"
 
-NB_REFLECT(Nightbird::Core::MeshInstance, NB_PARENT(Nightbird::Core::SpatialObject), NB_FACTORY(Nightbird::Core::MeshInstance),
-	NB_FIELD(m_Mesh)
-)
+#include "Core/Scene.h"
+
+NB_REFLECT_STATIC(Nightbird::Core::MeshInstance, NB_FACTORY(Nightbird::Core::MeshInstance))
 
 namespace Nightbird::Core
 {
 	void MeshInstance::ResolveAssets(AssetManager& assetManager)
 	{
 		m_Mesh.Resolve(assetManager.Load<Mesh>(m_Mesh.GetUUID()));
+
+		if (m_Scene)
+			m_Scene->MarkRenderablesDirty();
 	}
 
 	void MeshInstance::EnterScene()
@@ -7,28 +7,24 @@
 #include "Core/MeshPrimitive.h"
 #include "Core/Log.h"
 
+#include <algorithm>
 #include <array>
 #include <cstdint>
+#include <optional>
 
 namespace Nightbird::Core
 {
-	std::shared_ptr<Mesh> MeshLoader::Load(AssetManager& assetManager, const std::string& cookedDir, const uuids::uuid& uuid)
-	{
-		std::string path = cookedDir + "/" + uuids::to_string(uuid) + ".nbmesh";
-		
-		BinaryReader reader(path);
-		if (!reader.IsValid())
-		{
-			Log::Error("MeshLoader: Failed to open: " + path);
-			return nullptr;
-		}
+	// Vertices are referenced straight from the cooked data, which is written field by field
+	static_assert(sizeof(Vertex) == 12 * sizeof(float), "Vertex must match the cooked layout");
 
+	std::shared_ptr<Mesh> MeshLoader::Load(AssetManager& assetManager, BinaryReader& reader, const uuids::uuid& uuid)
+	{
 		// Validate type		
 		uint8_t type[4] = {};
 		reader.ReadRawBytes(type, 4);
 		if (type[0] != 'M' || type[1] != 'E' || type[2] != 'S' || type[3] != 'H')
 		{
-			Log::Error("MeshLoader: Invalid type signature in: " + path);
+			Log::Error("MeshLoader: Invalid type signature in: " + uuids::to_string(uuid));
 			return nullptr;
 		}
 
@@ -42,28 +38,55 @@ namespace Nightbird::Core
 
 		uint32_t primitiveCount = reader.ReadUInt32();
 
-		std::vector<MeshPrimitive> primitives;
-		primitives.reserve(primitiveCount);
+		struct PrimitiveData
+		{
+			AssetBuffer<Vertex> vertices;
+			AssetBuffer<uint16_t> indices;
+			std::optional<uuids::uuid> materialUUID;
+		};
+
+		std::vector<PrimitiveData> primitiveData(primitiveCount);
+		std::vector<uuids::uuid> materialUUIDs;
 
 		for (uint32_t i = 0; i < primitiveCount; i++)
 		{
 			uint32_t vertexCount = reader.ReadUInt32();
-			auto vertices = reader.ReadVertices(vertexCount);
+			primitiveData[i].vertices = reader.ReadBuffer<Vertex>(vertexCount);
 
 			uint32_t indexCount = reader.ReadUInt32();
-			auto indices = reader.ReadIndices(indexCount);
+			primitiveData[i].indices = reader.ReadBuffer<uint16_t>(indexCount);
 
 			uint8_t hasMaterial = reader.ReadUInt8();
-			std::shared_ptr<Material> material;
 			if (hasMaterial)
 			{
 				std::array<uint8_t, 16> uuidBytes;
 				reader.ReadRawBytes(uuidBytes.data(), 16);
-				uuids::uuid materialUUID(uuidBytes);
-				material = assetManager.Load<Material>(materialUUID).lock();
+				primitiveData[i].materialUUID = uuids::uuid(uuidBytes);
+
+				if (std::find(materialUUIDs.begin(), materialUUIDs.end(), *primitiveData[i].materialUUID) == materialUUIDs.end())
+					materialUUIDs.push_back(*primitiveData[i].materialUUID);
 			}
+		}
+
+		if (!reader.IsValid())
+		{
+			Log::Error("MeshLoader: Truncated data in: " + uuids::to_string(uuid));
+			return nullptr;
+		}
+
+		// Materials (and their textures) load in parallel, the lookups below then hit the cache
+		assetManager.LoadParallel<Material>(materialUUIDs);
+
+		std::vector<MeshPrimitive> primitives;
+		primitives.reserve(primitiveCount);
+
+		for (auto& data : primitiveData)
+		{
+			std::shared_ptr<Material> material;
+			if (data.materialUUID)
+				material = assetManager.LoadShared<Material>(*data.materialUUID);
 
-			primitives.emplace_back(std::move(vertices), std::move(indices), material);
+			primitives.emplace_back(std::move(data.vertices), std::move(data.indices), material);
 		}
 
 		return std::make_shared<Mesh>(std::move(primitives));
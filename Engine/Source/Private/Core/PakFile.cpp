@@ -0,0 +1,129 @@
+#include "Core/PakFile.h"
+
+#include "Core/MappedFile.h"
+#include "Core/Log.h"
+
+#include <algorithm>
+#include <array>
+
+namespace Nightbird::Core
+{
+	bool PakFile::Open(const std::string& path)
+	{
+		m_File.open(path, std::ios::binary | std::ios::in);
+		if (!m_File.is_open())
+			return false;
+
+		std::vector<uint8_t> header(Pak::HeaderSize);
+		m_File.read(reinterpret_cast<char*>(header.data()), header.size());
+
+		BinaryReader headerReader(std::move(header));
+
+		uint8_t signature[4] = {};
+		headerReader.ReadRawBytes(signature, 4);
+		if (signature[0] != 'N' || signature[1] != 'P' || signature[2] != 'A' || signature[3] != 'K')
+		{
+			Log::Error("PakFile: Invalid type signature in: " + path);
+			m_File.close();
+			return false;
+		}
+
+		uint32_t version = headerReader.ReadUInt32();
+		if (version != Pak::Version)
+		{
+			Log::Error("PakFile: Unsupported version: " + std::to_string(version));
+			m_File.close();
+			return false;
+		}
+
+		uint32_t entryCount = headerReader.ReadUInt32();
+
+		// The whole TOC is read with a single call
+		std::vector<uint8_t> toc(static_cast<size_t>(entryCount) * Pak::EntrySize);
+		m_File.read(reinterpret_cast<char*>(toc.data()), toc.size());
+		if (!m_File)
+		{
+			Log::Error("PakFile: Truncated table of contents in: " + path);
+			m_File.close();
+			return false;
+		}
+
+		BinaryReader tocReader(std::move(toc));
+
+		m_Entries.resize(entryCount);
+		for (auto& entry : m_Entries)
+		{
+			std::array<uint8_t, 16> uuidBytes;
+			tocReader.ReadRawBytes(uuidBytes.data(), 16);
+			entry.uuid = uuids::uuid(uuidBytes);
+			entry.offset = tocReader.ReadUInt32();
+			entry.size = tocReader.ReadUInt32();
+			entry.type = static_cast<PakEntryType>(tocReader.ReadUInt8());
+			entry.flags = tocReader.ReadUInt8();
+
+			uint8_t padding[6];
+			tocReader.ReadRawBytes(padding, sizeof(padding));
+		}
+
+		if (!std::is_sorted(m_Entries.begin(), m_Entries.end(), [](const PakEntry& a, const PakEntry& b) { return a.uuid < b.uuid; }))
+		{
+			Log::Error("PakFile: Table of contents is not sorted in: " + path);
+			m_Entries.clear();
+			m_File.close();
+			return false;
+		}
+
+		m_Mapping = MappedFile::Open(path);
+
+		Log::Info("PakFile: Opened " + path + " with " + std::to_string(entryCount) + " entries");
+		return true;
+	}
+
+	bool PakFile::IsOpen() const
+	{
+		return m_File.is_open();
+	}
+
+	const PakEntry* PakFile::Find(const uuids::uuid& uuid) const
+	{
+		auto it = std::lower_bound(m_Entries.begin(), m_Entries.end(), uuid, [](const PakEntry& entry, const uuids::uuid& value) { return entry.uuid < value; });
+		if (it == m_Entries.end() || it->uuid != uuid)
+			return nullptr;
+
+		return &*it;
+	}
+
+	BinaryReader PakFile::OpenEntry(const PakEntry& entry)
+	{
+		if (m_Mapping)
+		{
+			if (static_cast<size_t>(entry.offset) + entry.size > m_Mapping->GetSize())
+			{
+				Log::Error("PakFile: Entry out of bounds: " + uuids::to_string(entry.uuid));
+				return {};
+			}
+
+			return BinaryReader(m_Mapping, m_Mapping->GetData() + entry.offset, entry.size);
+		}
+
+		std::vector<uint8_t> data(entry.size);
+
+		std::lock_guard<std::mutex> lock(m_FileMutex);
+		m_File.clear();
+		m_File.seekg(entry.offset);
+		m_File.read(reinterpret_cast<char*>(data.data()), data.size());
+
+		if (!m_File)
+		{
+			Log::Error("PakFile: Failed to read entry: " + uuids::to_string(entry.uuid));
+			return {};
+		}
+
+		return BinaryReader(std::move(data));
+	}
+
+	const std::vector<PakEntry>& PakFile::GetEntries() const
+	{
+		return m_Entries;
+	}
+}
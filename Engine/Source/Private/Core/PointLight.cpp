@@ -1,7 +1,3 @@
 #include "Core/PointLight.h"
 
-NB_REFLECT(Nightbird::Core::PointLight, NB_PARENT(Nightbird::Core::SpatialObject), NB_FACTORY(Nightbird::Core::PointLight),
-	NB_FIELD(m_Color),
-	NB_FIELD(m_Intensity),
-	NB_FIELD(m_Radius)
-)
+NB_REFLECT_STATIC(Nightbird::Core::PointLight, NB_FACTORY(Nightbird::Core::PointLight))
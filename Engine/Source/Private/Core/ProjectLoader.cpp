@@ -7,23 +7,14 @@
 
 namespace Nightbird::Core
 {
-	ProjectInfo ProjectLoader::Load(const std::string& cookedDir)
+	ProjectInfo ProjectLoader::Load(BinaryReader& reader)
 	{
-		std::string path = cookedDir + "/Project.nbproject";
-
-		BinaryReader reader(path);
-		if (!reader.IsValid())
-		{
-			Log::Error("ProjectLoader: Failed to open: " + path);
-			return {};
-		}
-
 		// Validate type
 		uint8_t type[4] = {};
 		reader.ReadRawBytes(type, 4);
 		if (type[0] != 'P' || type[1] != 'R' || type[2] != 'O' || type[3] != 'J')
 		{
-			Log::Error("ProjectLoader: Invalid type signature in: " + path);
+			Log::Error("ProjectLoader: Invalid type signature");
 			return {};
 		}
 
@@ -1,10 +1,15 @@
 #include "Core/Scene.h"
 
 #include "Core/Engine.h"
+#include "Core/JobSystem.h"
 #include "Core/SceneObject.h"
 #include "Core/MeshInstance.h"
+#include "Core/AudioSource.h"
 #include "Core/Log.h"
 
+#include <algorithm>
+#include <cassert>
+
 namespace Nightbird::Core
 {
 	Scene::Scene()
@@ -14,7 +19,31 @@ namespace Nightbird::Core
 	
 	void Scene::Update(float delta)
 	{
-		UpdateRecursive(m_Root.get(), delta);
+		JobSystem* jobSystem = nullptr;
+		if (m_ParallelUpdate && m_Engine && m_Engine->GetJobSystem().GetWorkerCount() > 0)
+			jobSystem = &m_Engine->GetJobSystem();
+
+		for (size_t group = 0; group < static_cast<size_t>(TickGroup::Count); ++group)
+			UpdateTickGroup(static_cast<TickGroup>(group), jobSystem, delta);
+
+		CompactTickLists();
+
+		m_TransformStore.Update();
+
+		if (m_Engine)
+			m_SpatialAudio.Update(m_ActiveCamera, delta, m_Engine->GetAudioProvider());
+
+		SyncRenderables();
+	}
+
+	bool Scene::GetParallelUpdate() const
+	{
+		return m_ParallelUpdate;
+	}
+
+	void Scene::SetParallelUpdate(bool parallelUpdate)
+	{
+		m_ParallelUpdate = parallelUpdate;
 	}
 
 	Engine* Scene::GetEngine() const
@@ -34,6 +63,11 @@ namespace Nightbird::Core
 		return m_Root.get();
 	}
 
+	TransformStore& Scene::GetTransformStore()
+	{
+		return m_TransformStore;
+	}
+
 	Camera* Scene::GetActiveCamera() const
 	{
 		return m_ActiveCamera;
@@ -46,9 +80,44 @@ namespace Nightbird::Core
 
 	void Scene::ResolveAssets(AssetManager& assetManager)
 	{
+		// Start loading everything referenced first so loads overlap, resolving then hits the cache
+		PreloadAssetsRecursive(m_Root.get(), assetManager);
+		assetManager.WaitForAsyncLoads();
+
 		ResolveAssetsRecursive(m_Root.get(), assetManager);
 	}
 
+	static void PreloadAssetFields(const uint8_t* object, const TypeInfo* type, AssetManager& assetManager)
+	{
+		for (const TypeInfo* t = type; t != nullptr; t = t->parent)
+		{
+			for (uint32_t i = 0; i < t->fieldCount; ++i)
+			{
+				const FieldInfo& field = t->fields[i];
+
+				if (field.kind == FieldKind::Object && field.type)
+				{
+					PreloadAssetFields(object + field.offset, field.type, assetManager);
+				}
+				else if (field.kind == FieldKind::AssetRef && field.type)
+				{
+					// UUID is the first member of AssetRef
+					const auto& uuid = *reinterpret_cast<const uuids::uuid*>(object + field.offset);
+					if (!uuid.is_nil())
+						assetManager.LoadAsync(field.type, uuid);
+				}
+			}
+		}
+	}
+
+	void Scene::PreloadAssetsRecursive(SceneObject* object, AssetManager& assetManager)
+	{
+		PreloadAssetFields(reinterpret_cast<const uint8_t*>(object), object->GetTypeInfo(), assetManager);
+
+		for (auto& child : object->GetChildren())
+			PreloadAssetsRecursive(child.get(), assetManager);
+	}
+
 	void Scene::ResolveAssetsRecursive(SceneObject* object, AssetManager& assetManager)
 	{
 		object->ResolveAssets(assetManager);
@@ -57,101 +126,253 @@ namespace Nightbird::Core
 			ResolveAssetsRecursive(child.get(), assetManager);
 	}
 
-	std::vector<Renderable> Scene::CollectRenderables() const
+	void Scene::AddTick(SceneObject* object)
 	{
-		std::vector<Renderable> renderables;
-		CollectRenderablesRecursive(m_Root.get(), renderables);
-		return renderables;
+		assert(!m_InParallelTick && "Scene: Tick lists can't change during parallel ticks");
+
+		auto& lists = m_TickLists[static_cast<size_t>(object->GetTickGroup())];
+		const TypeInfo* type = object->GetTypeInfo();
+
+		auto it = std::find_if(lists.begin(), lists.end(), [type](const TickList& list) { return list.type == type; });
+		if (it == lists.end())
+		{
+			lists.push_back({ type, {}, false });
+			it = lists.end() - 1;
+		}
+
+		it->objects.push_back(object);
 	}
 
-	std::vector<DirectionalLight*> Scene::CollectDirectionalLights() const
+	void Scene::RemoveTick(SceneObject* object)
 	{
-		std::vector<DirectionalLight*> directionalLights;
-		CollectDirectionalLightsRecursive(m_Root.get(), directionalLights);
-		return directionalLights;
+		assert(!m_InParallelTick && "Scene: Tick lists can't change during parallel ticks");
+
+		auto& lists = m_TickLists[static_cast<size_t>(object->GetTickGroup())];
+		const TypeInfo* type = object->GetTypeInfo();
+
+		for (TickList& list : lists)
+		{
+			if (list.type != type)
+				continue;
+
+			auto it = std::find(list.objects.begin(), list.objects.end(), object);
+			if (it != list.objects.end())
+			{
+				*it = nullptr;
+				list.hasRemoved = true;
+			}
+			return;
+		}
+	}
+
+	void Scene::UpdateTickGroup(TickGroup group, JobSystem* jobSystem, float delta)
+	{
+		auto& lists = m_TickLists[static_cast<size_t>(group)];
+
+		// Ticks may add objects, so lists are indexed rather than iterated and new entries wait for the next frame
+		for (size_t listIndex = 0; listIndex < lists.size(); ++listIndex)
+		{
+			const uint32_t count = static_cast<uint32_t>(lists[listIndex].objects.size());
+
+			if (jobSystem && lists[listIndex].type->HasFlag(TypeFlags::ThreadSafeTick))
+			{
+				std::vector<SceneObject*>& objects = lists[listIndex].objects;
+				std::atomic<bool> hasRemoved = false;
+
+				// Queries during the pass see the matrices as of its start, ticks only write their own transform slots
+				m_TransformStore.Update();
+				m_InParallelTick = true;
+				m_TransformStore.SetDeferred(true);
+
+				jobSystem->ParallelFor(count, 64, [&objects, &hasRemoved, delta](uint32_t begin, uint32_t end)
+				{
+					for (uint32_t i = begin; i < end; ++i)
+					{
+						if (objects[i] && !objects[i]->RunTick(delta))
+						{
+							objects[i] = nullptr;
+							hasRemoved = true;
+						}
+					}
+				});
+
+				m_TransformStore.SetDeferred(false);
+				m_InParallelTick = false;
+
+				if (hasRemoved)
+					lists[listIndex].hasRemoved = true;
+			}
+			else
+			{
+				for (uint32_t i = 0; i < count; ++i)
+				{
+					SceneObject* object = lists[listIndex].objects[i];
+					if (object && !object->RunTick(delta))
+					{
+						lists[listIndex].objects[i] = nullptr;
+						lists[listIndex].hasRemoved = true;
+					}
+				}
+			}
+		}
 	}
 
-	std::vector<PointLight*> Scene::CollectPointLights() const
+	void Scene::CompactTickLists()
 	{
-		std::vector<PointLight*> pointLights;
-		CollectPointLightsRecursive(m_Root.get(), pointLights);
-		return pointLights;
+		for (auto& lists : m_TickLists)
+		{
+			for (TickList& list : lists)
+			{
+				if (!list.hasRemoved)
+					continue;
+
+				std::erase(list.objects, nullptr);
+				list.hasRemoved = false;
+			}
+		}
 	}
 
-	const Skybox* Scene::FindSkybox() const
+	void Scene::RegisterObject(SceneObject* object)
 	{
-		return FindSkyboxRecursive(m_Root.get());
+		if (auto* meshInstance = Cast<MeshInstance>(object))
+		{
+			m_MeshInstances.push_back(meshInstance);
+			m_RenderablesDirty = true;
+		}
+		else if (auto* directionalLight = Cast<DirectionalLight>(object))
+		{
+			m_DirectionalLights.push_back(directionalLight);
+		}
+		else if (auto* pointLight = Cast<PointLight>(object))
+		{
+			m_PointLights.push_back(pointLight);
+		}
+		else if (auto* skybox = Cast<Skybox>(object))
+		{
+			m_Skyboxes.push_back(skybox);
+		}
+		else if (auto* audioSource = Cast<AudioSource>(object))
+		{
+			m_SpatialAudio.Add(audioSource);
+		}
 	}
 
-	void Scene::UpdateRecursive(SceneObject* object, float delta)
+	template<typename T>
+	static void SwapErase(std::vector<T*>& objects, T* object)
 	{
-		if (!object)
+		auto it = std::find(objects.begin(), objects.end(), object);
+		if (it == objects.end())
 			return;
 
-		object->Tick(delta);
-		for (const auto& child : object->GetChildren())
-			UpdateRecursive(child.get(), delta);
+		*it = objects.back();
+		objects.pop_back();
 	}
 
-	void Scene::CollectRenderablesRecursive(SceneObject* object, std::vector<Renderable>& renderables) const
+	void Scene::UnregisterObject(SceneObject* object)
 	{
-		if (!object)
-			return;
-		
 		if (auto* meshInstance = Cast<MeshInstance>(object))
 		{
-			const Mesh* mesh = meshInstance->m_Mesh.Get().get();
-			if (mesh)
-			{
-				for (size_t i = 0; i < mesh->GetPrimitiveCount(); i++)
-				{
-					Renderable renderable;
-					renderable.primitive = &mesh->GetPrimitives()[i];
-					renderable.transform = meshInstance->GetWorldMatrix();
-					renderables.push_back(renderable);
-				}
-			}
+			SwapErase(m_MeshInstances, meshInstance);
+			m_RenderablesDirty = true;
+		}
+		else if (auto* directionalLight = Cast<DirectionalLight>(object))
+		{
+			SwapErase(m_DirectionalLights, directionalLight);
+		}
+		else if (auto* pointLight = Cast<PointLight>(object))
+		{
+			SwapErase(m_PointLights, pointLight);
+		}
+		else if (auto* skybox = Cast<Skybox>(object))
+		{
+			SwapErase(m_Skyboxes, skybox);
+		}
+		else if (auto* audioSource = Cast<AudioSource>(object))
+		{
+			m_SpatialAudio.Remove(audioSource);
 		}
+	}
 
-		for (const auto& child : object->GetChildren())
-			CollectRenderablesRecursive(child.get(), renderables);
+	void Scene::MarkRenderablesDirty()
+	{
+		m_RenderablesDirty = true;
 	}
 
-	void Scene::CollectDirectionalLightsRecursive(SceneObject* object, std::vector<DirectionalLight*>& directionalLights) const
+	const std::vector<Renderable>& Scene::GetRenderables() const
 	{
-		if (!object)
-			return;
+		return m_Renderables;
+	}
 
-		if (auto* directionalLight = Cast<DirectionalLight>(object))
-			directionalLights.push_back(directionalLight);
+	const std::vector<DirectionalLight*>& Scene::GetDirectionalLights() const
+	{
+		return m_DirectionalLights;
+	}
 
-		for (const auto& child : object->GetChildren())
-			CollectDirectionalLightsRecursive(child.get(), directionalLights);
+	const std::vector<PointLight*>& Scene::GetPointLights() const
+	{
+		return m_PointLights;
 	}
-	
-	void Scene::CollectPointLightsRecursive(SceneObject* object, std::vector<PointLight*>& pointLights) const
+
+	const Skybox* Scene::GetSkybox() const
 	{
-		if (!object)
-			return;
+		return m_Skyboxes.empty() ? nullptr : m_Skyboxes.front();
+	}
 
-		if (auto* pointLight = Cast<PointLight>(object))
-			pointLights.push_back(pointLight);
+	void Scene::SyncRenderables()
+	{
+		if (m_RenderablesDirty)
+		{
+			RebuildRenderables();
+		}
+		else
+		{
+			for (TransformStore::Handle handle : m_TransformStore.GetChanged())
+			{
+				if (handle >= m_RenderableCount.size() || m_RenderableCount[handle] == 0)
+					continue;
+
+				const glm::mat4& worldMatrix = m_TransformStore.GetWorldMatrix(handle);
+
+				uint32_t first = m_RenderableFirst[handle];
+				for (uint32_t i = 0; i < m_RenderableCount[handle]; ++i)
+					m_Renderables[first + i].transform = worldMatrix;
+			}
+		}
 
-		for (const auto& child : object->GetChildren())
-			CollectPointLightsRecursive(child.get(), pointLights);
+		m_TransformStore.ClearChanged();
 	}
 
-	const Skybox* Scene::FindSkyboxRecursive(const SceneObject* object) const
+	void Scene::RebuildRenderables()
 	{
-		if (!object)
-			return nullptr;
-		if (const auto* skybox = Cast<Skybox>(object))
-			return skybox;
-		for (const auto& child : object->GetChildren())
+		m_Renderables.clear();
+		std::fill(m_RenderableCount.begin(), m_RenderableCount.end(), 0);
+
+		for (MeshInstance* meshInstance : m_MeshInstances)
 		{
-			if (const auto* skybox = FindSkyboxRecursive(child.get()))
-				return skybox;
+			const Mesh* mesh = meshInstance->m_Mesh.Get().get();
+			if (!mesh)
+				continue;
+
+			TransformStore::Handle handle = meshInstance->GetTransformHandle();
+			if (handle >= m_RenderableCount.size())
+			{
+				m_RenderableFirst.resize(handle + 1, 0);
+				m_RenderableCount.resize(handle + 1, 0);
+			}
+
+			m_RenderableFirst[handle] = static_cast<uint32_t>(m_Renderables.size());
+			m_RenderableCount[handle] = static_cast<uint32_t>(mesh->GetPrimitiveCount());
+
+			const glm::mat4& worldMatrix = meshInstance->GetWorldMatrix();
+			for (size_t i = 0; i < mesh->GetPrimitiveCount(); i++)
+			{
+				Renderable renderable;
+				renderable.primitive = &mesh->GetPrimitives()[i];
+				renderable.transform = worldMatrix;
+				m_Renderables.push_back(renderable);
+			}
 		}
-		return nullptr;
+
+		m_RenderablesDirty = false;
 	}
 }
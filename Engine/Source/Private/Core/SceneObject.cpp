@@ -2,11 +2,10 @@
 
 #include "Core/Engine.h"
 #include "Core/Scene.h"
+#include "Core/SlabAllocator.h"
 #include "Core/Log.h"
 
-NB_REFLECT(Nightbird::Core::SceneObject, NB_NO_PARENT, NB_FACTORY(Nightbird::Core::SceneObject),
-	NB_FIELD(m_Name)
-)
+NB_REFLECT_STATIC(Nightbird::Core::SceneObject, NB_FACTORY(Nightbird::Core::SceneObject))
 
 namespace Nightbird::Core
 {
@@ -16,6 +15,16 @@ namespace Nightbird::Core
 
 	}
 
+	void* SceneObject::operator new(size_t size)
+	{
+		return SlabAllocator::Allocate(size);
+	}
+
+	void SceneObject::operator delete(void* pointer, size_t size)
+	{
+		SlabAllocator::Free(pointer, size);
+	}
+
 	const std::string& SceneObject::GetName() const
 	{
 		return m_Name;
@@ -33,7 +42,35 @@ namespace Nightbird::Core
 
 	void SceneObject::SetScene(Scene* scene)
 	{
-		m_Scene = scene;
+		if (scene != m_Scene)
+		{
+			Scene* oldScene = m_Scene;
+			if (oldScene)
+			{
+				if (m_InTickList)
+				{
+					oldScene->RemoveTick(this);
+					m_InTickList = false;
+				}
+
+				oldScene->UnregisterObject(this);
+			}
+
+			m_Scene = scene;
+			OnSceneChanged(oldScene);
+
+			if (scene)
+			{
+				scene->RegisterObject(this);
+
+				if (IsTickEnabled())
+				{
+					scene->AddTick(this);
+					m_InTickList = true;
+				}
+			}
+		}
+
 		for (auto& child : m_Children)
 			child->SetScene(scene);
 	}
@@ -53,6 +90,7 @@ namespace Nightbird::Core
 			detachedChild = m_Parent->DetachChild(this);
 
 		m_Parent = newParent;
+		OnParentChanged();
 
 		if (newParent && detachedChild)
 			newParent->AddChild(std::move(detachedChild));
@@ -91,6 +129,7 @@ namespace Nightbird::Core
 				auto detatched = std::move(*it);
 				m_Children.erase(it);
 				detatched->SetParent(nullptr);
+				detatched->SetScene(nullptr);
 				return detatched;
 			}
 		}
@@ -127,6 +166,81 @@ namespace Nightbird::Core
 
 	void SceneObject::Tick(float delta)
 	{
+		// Reaching the base implementation means the type has nothing to do per frame
+		if (m_TickMode == TickMode::Auto)
+			m_TickMode = TickMode::Disabled;
+	}
+
+	bool SceneObject::IsTickEnabled() const
+	{
+		return m_TickMode != TickMode::Disabled;
+	}
+
+	void SceneObject::SetTickEnabled(bool enabled)
+	{
+		m_TickMode = enabled ? TickMode::Enabled : TickMode::Disabled;
+
+		// Disabled objects are dropped by the scene on its next tick pass
+		if (enabled && m_Scene && !m_InTickList)
+		{
+			m_Scene->AddTick(this);
+			m_InTickList = true;
+		}
+	}
+
+	TickGroup SceneObject::GetTickGroup() const
+	{
+		return m_TickGroup;
+	}
+
+	void SceneObject::SetTickGroup(TickGroup group)
+	{
+		if (group == m_TickGroup)
+			return;
+
+		if (m_InTickList)
+			m_Scene->RemoveTick(this);
+
+		m_TickGroup = group;
+
+		if (m_InTickList)
+			m_Scene->AddTick(this);
+	}
+
+	float SceneObject::GetTickInterval() const
+	{
+		return m_TickInterval;
+	}
+
+	void SceneObject::SetTickInterval(float interval)
+	{
+		m_TickInterval = interval;
+		m_TickElapsed = 0.0f;
+	}
+
+	bool SceneObject::RunTick(float delta)
+	{
+		if (m_TickMode != TickMode::Disabled)
+		{
+			if (m_TickInterval > 0.0f)
+			{
+				m_TickElapsed += delta;
+				if (m_TickElapsed < m_TickInterval)
+					return true;
+
+				delta = m_TickElapsed;
+				m_TickElapsed = 0.0f;
+			}
+
+			Tick(delta);
+		}
+
+		if (m_TickMode == TickMode::Disabled)
+		{
+			m_InTickList = false;
+			return false;
+		}
 
+		return true;
 	}
 }
@@ -0,0 +1,111 @@
+#include "Core/SceneTemplate.h"
+
+#include "Core/SceneObject.h"
+#include "Core/Camera.h"
+#include "Core/SlabAllocator.h"
+#include "Core/Log.h"
+
+#include <cstring>
+#include <string>
+
+namespace Nightbird::Core
+{
+	SceneTemplate::SceneTemplate(SceneReadResult scene)
+		: m_Scene(std::move(scene))
+	{
+
+	}
+
+	SceneTemplate::~SceneTemplate() = default;
+
+	const uuids::uuid& SceneTemplate::GetUUID() const
+	{
+		return m_Scene.uuid;
+	}
+
+	SceneReadResult SceneTemplate::Instantiate() const
+	{
+		SceneReadResult result;
+		result.uuid = m_Scene.uuid;
+
+		if (!m_Scene.root)
+			return result;
+
+		// Packs the copy together like a scene read from disk
+		SceneArena arena;
+		SceneArena::Scope arenaScope(arena);
+
+		result.root = CloneRecursive(m_Scene.root.get(), result.activeCamera);
+		return result;
+	}
+
+	std::unique_ptr<SceneObject> SceneTemplate::CloneRecursive(const SceneObject* source, Camera*& activeCamera) const
+	{
+		const TypeInfo* type = source->GetTypeInfo();
+
+		std::unique_ptr<SceneObject> object;
+		if (type->HasFactory())
+		{
+			object.reset(type->CreateAs<SceneObject>());
+		}
+		else
+		{
+			Log::Warning("SceneTemplate: Type " + std::string(type->name) + " has no factory, defaulting to SceneObject");
+			object = std::make_unique<SceneObject>();
+			type = &SceneObject::s_TypeInfo;
+		}
+
+		CopyFields(reinterpret_cast<const uint8_t*>(source), reinterpret_cast<uint8_t*>(object.get()), type);
+
+		if (const auto& sourceSceneUUID = source->GetSourceSceneUUID())
+			object->SetSourceSceneUUID(*sourceSceneUUID);
+
+		if (source == m_Scene.activeCamera)
+			activeCamera = Cast<Camera>(object.get());
+
+		for (const auto& child : source->GetChildren())
+			object->AddChild(CloneRecursive(child.get(), activeCamera));
+
+		return object;
+	}
+
+	void SceneTemplate::CopyFields(const uint8_t* source, uint8_t* destination, const TypeInfo* type)
+	{
+		if (type->ops)
+		{
+			type->ops->copy(source, destination);
+			return;
+		}
+
+		for (const TypeInfo* t = type; t != nullptr; t = t->parent)
+		{
+			for (uint32_t i = 0; i < t->fieldCount; ++i)
+			{
+				const FieldInfo& field = t->fields[i];
+				const uint8_t* sourceField = source + field.offset;
+				uint8_t* destinationField = destination + field.offset;
+
+				switch (field.kind)
+				{
+				case FieldKind::String:
+					*reinterpret_cast<std::string*>(destinationField) = *reinterpret_cast<const std::string*>(sourceField);
+					break;
+				case FieldKind::Object:
+					if (field.type)
+						CopyFields(sourceField, destinationField, field.type);
+					break;
+				case FieldKind::AssetRef:
+					// Only the UUID, which is the first member, the asset is resolved after instantiating
+					std::memcpy(destinationField, sourceField, sizeof(uuids::uuid));
+					break;
+				case FieldKind::Unknown:
+					Log::Warning("SceneTemplate: Cannot copy field " + std::string(field.name) + " of unknown kind");
+					break;
+				default:
+					std::memcpy(destinationField, sourceField, field.size);
+					break;
+				}
+			}
+		}
+	}
+}
@@ -2,9 +2,7 @@
 
 #include "Core/AssetManager.h"
 
-NB_REFLECT(Nightbird::Core::Skybox, NB_PARENT(Nightbird::Core::SceneObject), NB_FACTORY(Nightbird::Core::Skybox),
-	NB_FIELD(m_Cubemap)
-)
+NB_REFLECT_STATIC(Nightbird::Core::Skybox, NB_FACTORY(Nightbird::Core::Skybox))
 
 volatile int nb_link_Skybox = 0;
 
@@ -0,0 +1,182 @@
+#include "Core/SlabAllocator.h"
+
+#include <atomic>
+#include <mutex>
+#include <new>
+
+namespace Nightbird::Core
+{
+	static constexpr size_t ChunkSize = 64 * 1024;
+	static constexpr size_t Granularity = 16;
+	static constexpr size_t SizeClassCount = SlabAllocator::MaxSize / Granularity;
+
+	enum class SlabChunkKind : uint8_t
+	{
+		Slab,
+		Arena
+	};
+
+	// Lives at the start of every chunk, found from an object by aligning its address down
+	struct alignas(64) SlabChunk
+	{
+		SlabChunkKind kind = SlabChunkKind::Slab;
+		std::atomic<uint32_t> live = 0;
+	};
+
+	static constexpr size_t ChunkDataOffset = sizeof(SlabChunk);
+
+	struct FreeNode
+	{
+		FreeNode* next;
+	};
+
+	struct SizeClass
+	{
+		std::mutex mutex;
+		FreeNode* freeList = nullptr;
+		SlabChunk* chunk = nullptr;
+		size_t offset = ChunkSize;
+	};
+
+	static SizeClass& GetSizeClass(size_t index)
+	{
+		static SizeClass s_SizeClasses[SizeClassCount];
+		return s_SizeClasses[index];
+	}
+
+	static size_t RoundUp(size_t size)
+	{
+		return (size + Granularity - 1) & ~(Granularity - 1);
+	}
+
+	static SlabChunk* AllocateChunk(SlabChunkKind kind)
+	{
+		void* memory = ::operator new(ChunkSize, std::align_val_t(ChunkSize));
+		SlabChunk* chunk = new (memory) SlabChunk();
+		chunk->kind = kind;
+		return chunk;
+	}
+
+	static void FreeChunk(SlabChunk* chunk)
+	{
+		chunk->~SlabChunk();
+		::operator delete(chunk, std::align_val_t(ChunkSize));
+	}
+
+	static SlabChunk* GetChunk(void* pointer)
+	{
+		return reinterpret_cast<SlabChunk*>(reinterpret_cast<uintptr_t>(pointer) & ~(ChunkSize - 1));
+	}
+
+	static thread_local SceneArena* t_CurrentArena = nullptr;
+
+	void* SlabAllocator::Allocate(size_t size)
+	{
+		size = RoundUp(size == 0 ? 1 : size);
+		if (size > MaxSize)
+			return ::operator new(size);
+
+		if (t_CurrentArena)
+			return t_CurrentArena->Allocate(size);
+
+		SizeClass& sizeClass = GetSizeClass(size / Granularity - 1);
+		std::lock_guard<std::mutex> lock(sizeClass.mutex);
+
+		if (FreeNode* node = sizeClass.freeList)
+		{
+			sizeClass.freeList = node->next;
+			return node;
+		}
+
+		// Slab chunks are never released, their memory is reused through the free list
+		if (sizeClass.offset + size > ChunkSize)
+		{
+			sizeClass.chunk = AllocateChunk(SlabChunkKind::Slab);
+			sizeClass.offset = ChunkDataOffset;
+		}
+
+		void* pointer = reinterpret_cast<uint8_t*>(sizeClass.chunk) + sizeClass.offset;
+		sizeClass.offset += size;
+		return pointer;
+	}
+
+	void SlabAllocator::Free(void* pointer, size_t size)
+	{
+		if (!pointer)
+			return;
+
+		size = RoundUp(size == 0 ? 1 : size);
+		if (size > MaxSize)
+		{
+			::operator delete(pointer);
+			return;
+		}
+
+		SlabChunk* chunk = GetChunk(pointer);
+		if (chunk->kind == SlabChunkKind::Arena)
+		{
+			if (chunk->live.fetch_sub(1, std::memory_order_acq_rel) == 1)
+				FreeChunk(chunk);
+			return;
+		}
+
+		SizeClass& sizeClass = GetSizeClass(size / Granularity - 1);
+		std::lock_guard<std::mutex> lock(sizeClass.mutex);
+
+		FreeNode* node = static_cast<FreeNode*>(pointer);
+		node->next = sizeClass.freeList;
+		sizeClass.freeList = node;
+	}
+
+	SceneArena::~SceneArena()
+	{
+		Retire();
+	}
+
+	void* SceneArena::Allocate(size_t size)
+	{
+		size = RoundUp(size == 0 ? 1 : size);
+
+		if (!m_Chunk || m_Offset + size > ChunkSize)
+		{
+			Retire();
+
+			// The arena holds one reference on its current chunk until it moves on
+			m_Chunk = AllocateChunk(SlabChunkKind::Arena);
+			m_Chunk->live.store(1, std::memory_order_relaxed);
+			m_Offset = ChunkDataOffset;
+		}
+
+		void* pointer = reinterpret_cast<uint8_t*>(m_Chunk) + m_Offset;
+		m_Offset += size;
+		m_Chunk->live.fetch_add(1, std::memory_order_relaxed);
+		return pointer;
+	}
+
+	SceneArena* SceneArena::GetCurrent()
+	{
+		return t_CurrentArena;
+	}
+
+	void SceneArena::Retire()
+	{
+		if (!m_Chunk)
+			return;
+
+		if (m_Chunk->live.fetch_sub(1, std::memory_order_acq_rel) == 1)
+			FreeChunk(m_Chunk);
+
+		m_Chunk = nullptr;
+	}
+
+	SceneArena::Scope::Scope(SceneArena& arena)
+		: m_Previous(t_CurrentArena)
+	{
+		t_CurrentArena = &arena;
+	}
+
+	SceneArena::Scope::~Scope()
+	{
+		t_CurrentArena = m_Previous;
+	}
+}
@@ -0,0 +1,162 @@
+#include "Core/SpatialAudio.h"
+
+#include "Core/AudioSource.h"
+#include "Core/Camera.h"
+
+#include <glm/gtc/constants.hpp>
+
+#include <algorithm>
+#include <cmath>
+
+namespace Nightbird::Core
+{
+	// Below this a distance counts as zero, so the direction is undefined
+	static constexpr float DistanceEpsilon = 0.0001f;
+
+	void SpatialAudio::Add(AudioSource* source)
+	{
+		m_Sources.push_back(source);
+		m_PreviousPositions.push_back(glm::vec3(0.0f));
+		m_HasPrevious.push_back(0);
+	}
+
+	void SpatialAudio::Remove(AudioSource* source)
+	{
+		auto it = std::find(m_Sources.begin(), m_Sources.end(), source);
+		if (it == m_Sources.end())
+			return;
+
+		size_t index = it - m_Sources.begin();
+		m_Sources[index] = m_Sources.back();
+		m_PreviousPositions[index] = m_PreviousPositions.back();
+		m_HasPrevious[index] = m_HasPrevious.back();
+
+		m_Sources.pop_back();
+		m_PreviousPositions.pop_back();
+		m_HasPrevious.pop_back();
+	}
+
+	void SpatialAudio::Update(const Camera* listener, float delta, Audio::Provider& provider)
+	{
+		if (!listener || m_Sources.empty())
+		{
+			m_PreviousListener = nullptr;
+			return;
+		}
+
+		const glm::mat4& listenerMatrix = listener->GetWorldMatrix();
+		glm::vec3 listenerPosition = glm::vec3(listenerMatrix[3]);
+		glm::vec3 listenerRight = glm::normalize(glm::vec3(listenerMatrix[0]));
+
+		// A new listener has no history, so it starts at rest
+		glm::vec3 listenerVelocity = glm::vec3(0.0f);
+		if (listener == m_PreviousListener && delta > 0.0f)
+			listenerVelocity = (listenerPosition - m_PreviousListenerPosition) / delta;
+
+		m_PreviousListener = listener;
+		m_PreviousListenerPosition = listenerPosition;
+
+		Gather(listenerPosition, delta);
+		Compute(listenerRight, listenerVelocity);
+
+		if (!m_Params.empty())
+			provider.SetSpatialParams(m_Params.data(), m_Params.size());
+	}
+
+	void SpatialAudio::Gather(const glm::vec3& listenerPosition, float delta)
+	{
+		m_Handles.clear();
+		m_Offsets.clear();
+		m_Velocities.clear();
+		m_MinDistances.clear();
+		m_MaxDistances.clear();
+		m_Attenuations.clear();
+		m_Rolloffs.clear();
+		m_DopplerFactors.clear();
+
+		for (size_t i = 0; i < m_Sources.size(); ++i)
+		{
+			const AudioSource* source = m_Sources[i];
+			Audio::Handle handle = source->GetHandle();
+			if (!source->m_Spatial || handle == Audio::InvalidHandle)
+			{
+				m_HasPrevious[i] = 0;
+				continue;
+			}
+
+			glm::vec3 position = glm::vec3(source->GetWorldMatrix()[3]);
+
+			glm::vec3 velocity = glm::vec3(0.0f);
+			if (m_HasPrevious[i] && delta > 0.0f)
+				velocity = (position - m_PreviousPositions[i]) / delta;
+
+			m_PreviousPositions[i] = position;
+			m_HasPrevious[i] = 1;
+
+			float minDistance = std::max(source->m_MinDistance, DistanceEpsilon);
+
+			m_Handles.push_back(handle);
+			m_Offsets.push_back(position - listenerPosition);
+			m_Velocities.push_back(velocity);
+			m_MinDistances.push_back(minDistance);
+			m_MaxDistances.push_back(std::max(source->m_MaxDistance, minDistance));
+			m_Attenuations.push_back(source->m_Attenuation);
+			m_Rolloffs.push_back(std::max(source->m_Rolloff, 0.0f));
+			m_DopplerFactors.push_back(std::max(source->m_DopplerFactor, 0.0f));
+		}
+	}
+
+	void SpatialAudio::Compute(const glm::vec3& listenerRight, const glm::vec3& listenerVelocity)
+	{
+		const size_t count = m_Handles.size();
+		m_Params.resize(count);
+
+		// Doppler speeds are capped so the shift stays finite when something teleports
+		constexpr float MaxSpeed = SpeedOfSound * 0.5f;
+
+		for (size_t i = 0; i < count; ++i)
+		{
+			float distance = glm::length(m_Offsets[i]);
+			float minDistance = m_MinDistances[i];
+			float maxDistance = m_MaxDistances[i];
+			float clamped = std::clamp(distance, minDistance, maxDistance);
+
+			float gain = 1.0f;
+			switch (static_cast<AudioAttenuation>(m_Attenuations[i]))
+			{
+			case AudioAttenuation::Linear:
+				gain = maxDistance > minDistance ? 1.0f - m_Rolloffs[i] * (clamped - minDistance) / (maxDistance - minDistance) : 1.0f;
+				gain = std::max(gain, 0.0f);
+				break;
+			case AudioAttenuation::Exponential:
+				gain = std::pow(clamped / minDistance, -m_Rolloffs[i]);
+				break;
+			default:
+				gain = minDistance / (minDistance + m_Rolloffs[i] * (clamped - minDistance));
+				break;
+			}
+
+			glm::vec3 direction = distance > DistanceEpsilon ? m_Offsets[i] / distance : glm::vec3(0.0f);
+
+			// Constant power pan scaled so the centre is unity like non-spatial sources, a hard pan is +3 dB on one side.
+			// Sources inside the min distance drift to the centre instead of snapping across it.
+			float pan = glm::dot(direction, listenerRight) * std::min(distance / minDistance, 1.0f);
+			float angle = (std::clamp(pan, -1.0f, 1.0f) + 1.0f) * glm::quarter_pi<float>();
+
+			float pitch = 1.0f;
+			if (m_DopplerFactors[i] > 0.0f && distance > DistanceEpsilon)
+			{
+				// Listener moving towards the source and source moving away from the listener
+				float listenerSpeed = std::clamp(glm::dot(listenerVelocity, direction) * m_DopplerFactors[i], -MaxSpeed, MaxSpeed);
+				float sourceSpeed = std::clamp(glm::dot(m_Velocities[i], direction) * m_DopplerFactors[i], -MaxSpeed, MaxSpeed);
+				pitch = std::clamp((SpeedOfSound + listenerSpeed) / (SpeedOfSound + sourceSpeed), MinPitch, MaxPitch);
+			}
+
+			Audio::SpatialParams& params = m_Params[i];
+			params.handle = m_Handles[i];
+			params.gainLeft = gain * glm::root_two<float>() * std::cos(angle);
+			params.gainRight = gain * glm::root_two<float>() * std::sin(angle);
+			params.pitch = pitch;
+		}
+	}
+}
@@ -1,24 +1,151 @@
 #include "Core/SpatialObject.h"
 
-NB_REFLECT(Nightbird::Core::SpatialObject, NB_PARENT(Nightbird::Core::SceneObject), NB_FACTORY(Nightbird::Core::SpatialObject),
-	NB_FIELD(m_Transform)
-)
+#include "Core/Scene.h"
+
+NB_REFLECT_STATIC(Nightbird::Core::SpatialObject, NB_FACTORY(Nightbird::Core::SpatialObject))
 
 namespace Nightbird::Core
 {
-	glm::mat4 SpatialObject::GetLocalMatrix() const
+	SpatialObject::~SpatialObject()
+	{
+		if (TransformStore* store = GetTransformStore())
+			store->Release(m_TransformHandle);
+	}
+
+	const Transform& SpatialObject::GetTransform() const
 	{
-		return m_Transform.GetLocalMatrix();
+		return m_Transform;
 	}
 
-	glm::mat4 SpatialObject::GetWorldMatrix() const
+	void SpatialObject::SetTransform(const Transform& transform)
 	{
-		if (m_Parent)
+		m_Transform = transform;
+		MarkTransformDirty();
+	}
+
+	void SpatialObject::SetPosition(const glm::vec3& position)
+	{
+		m_Transform.position = position;
+		MarkTransformDirty();
+	}
+
+	void SpatialObject::SetRotation(const glm::quat& rotation)
+	{
+		m_Transform.rotation = rotation;
+		MarkTransformDirty();
+	}
+
+	void SpatialObject::SetScale(const glm::vec3& scale)
+	{
+		m_Transform.scale = scale;
+		MarkTransformDirty();
+	}
+
+	const glm::mat4& SpatialObject::GetLocalMatrix() const
+	{
+		if (TransformStore* store = GetTransformStore())
+			return store->GetLocalMatrix(m_TransformHandle);
+
+		if (m_LocalDirty)
 		{
-			if (auto* spatialParent = Cast<SpatialObject>(m_Parent))
-				return spatialParent->GetWorldMatrix() * GetLocalMatrix();
+			m_LocalMatrix = m_Transform.GetLocalMatrix();
+			m_LocalDirty = false;
 		}
 
-		return GetLocalMatrix();
+		return m_LocalMatrix;
+	}
+
+	const glm::mat4& SpatialObject::GetWorldMatrix() const
+	{
+		if (TransformStore* store = GetTransformStore())
+			return store->GetWorldMatrix(m_TransformHandle);
+
+		if (!m_WorldDirty)
+			return m_WorldMatrix;
+
+		const auto* spatialParent = Cast<SpatialObject>(m_Parent);
+		if (spatialParent)
+			m_WorldMatrix = spatialParent->GetWorldMatrix() * GetLocalMatrix();
+		else
+			m_WorldMatrix = GetLocalMatrix();
+
+		m_WorldDirty = false;
+		return m_WorldMatrix;
+	}
+
+	TransformStore::Handle SpatialObject::GetTransformHandle() const
+	{
+		return m_TransformHandle;
+	}
+
+	void SpatialObject::MarkTransformDirty()
+	{
+		if (TransformStore* store = GetTransformStore())
+		{
+			store->SetLocal(m_TransformHandle, m_Transform);
+			return;
+		}
+
+		m_LocalDirty = true;
+		MarkWorldDirty();
+	}
+
+	void SpatialObject::OnSceneChanged(Scene* oldScene)
+	{
+		if (oldScene && m_TransformHandle != TransformStore::InvalidHandle)
+			oldScene->GetTransformStore().Release(m_TransformHandle);
+
+		m_TransformHandle = TransformStore::InvalidHandle;
+		m_LocalDirty = true;
+		m_WorldDirty = true;
+
+		if (TransformStore* store = m_Scene ? &m_Scene->GetTransformStore() : nullptr)
+		{
+			// Parents enter the scene before their children, so the parent handle is already valid
+			m_TransformHandle = store->Allocate();
+			store->SetParent(m_TransformHandle, GetParentTransformHandle());
+			store->SetLocal(m_TransformHandle, m_Transform);
+		}
+	}
+
+	void SpatialObject::OnParentChanged()
+	{
+		if (TransformStore* store = GetTransformStore())
+		{
+			store->SetParent(m_TransformHandle, GetParentTransformHandle());
+			return;
+		}
+
+		MarkWorldDirty();
+	}
+
+	TransformStore* SpatialObject::GetTransformStore() const
+	{
+		if (m_Scene && m_TransformHandle != TransformStore::InvalidHandle)
+			return &m_Scene->GetTransformStore();
+		return nullptr;
+	}
+
+	TransformStore::Handle SpatialObject::GetParentTransformHandle() const
+	{
+		// Matches the lazy path: a non-spatial parent makes the local matrix the world matrix
+		const auto* spatialParent = Cast<SpatialObject>(m_Parent);
+		if (spatialParent && spatialParent->m_Scene == m_Scene)
+			return spatialParent->m_TransformHandle;
+		return TransformStore::InvalidHandle;
+	}
+
+	void SpatialObject::MarkWorldDirty()
+	{
+		// A dirty node's spatial descendants are always dirty too
+		if (m_WorldDirty)
+			return;
+
+		m_WorldDirty = true;
+		for (const auto& child : m_Children)
+		{
+			if (auto* spatialChild = Cast<SpatialObject>(child.get()))
+				spatialChild->MarkWorldDirty();
+		}
 	}
 }
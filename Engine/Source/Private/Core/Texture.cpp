@@ -2,7 +2,7 @@
 
 namespace Nightbird::Core
 {
-	Texture::Texture(uint32_t width, uint32_t height, TextureFormat format, std::vector<uint8_t> data)
+	Texture::Texture(uint32_t width, uint32_t height, TextureFormat format, AssetBuffer<uint8_t> data)
 		: m_Width(width), m_Height(height), m_Format(format), m_Data(std::move(data))
 	{
 
@@ -23,7 +23,7 @@ namespace Nightbird::Core
 		return m_Format;
 	}
 
-	const std::vector<uint8_t>& Texture::GetData() const
+	const AssetBuffer<uint8_t>& Texture::GetData() const
 	{
 		return m_Data;
 	}
@@ -9,23 +9,14 @@
 
 namespace Nightbird::Core
 {
-	std::shared_ptr<Texture> TextureLoader::Load(const std::string& cookedDir, const uuids::uuid& uuid)
+	std::shared_ptr<Texture> TextureLoader::Load(BinaryReader& reader, const uuids::uuid& uuid)
 	{
-		std::string path = cookedDir + "/" + uuids::to_string(uuid) + ".nbtexture";
-
-		BinaryReader reader(path);
-		if (!reader.IsValid())
-		{
-			Log::Error("TextureLoader: Failed to open: " + path);
-			return nullptr;
-		}
-
 		// Validate Type
 		uint8_t type[4] = {};
 		reader.ReadRawBytes(type, 4);
 		if (type[0] != 'T' || type[1] != 'E' || type[2] != 'X' || type[3] != 'T')
 		{
-			Log::Error("TextureLoader: Invalid type signature in: " + path);
+			Log::Error("TextureLoader: Invalid type signature in: " + uuids::to_string(uuid));
 			return nullptr;
 		}
 
@@ -47,9 +38,13 @@ namespace Nightbird::Core
 		// Data size
 		uint32_t dataSize = reader.ReadUInt32();
 
-		// Data
-		std::vector<uint8_t> data(dataSize);
-		reader.ReadRawBytes(data.data(), dataSize);
+		// Data, referenced in place when the file is mapped
+		AssetBuffer<uint8_t> data = reader.ReadBuffer<uint8_t>(dataSize);
+		if (!reader.IsValid())
+		{
+			Log::Error("TextureLoader: Truncated data in: " + uuids::to_string(uuid));
+			return nullptr;
+		}
 
 		return std::make_shared<Texture>(width, height, format, std::move(data));
 	}
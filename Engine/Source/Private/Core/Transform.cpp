@@ -2,11 +2,7 @@
 
 #include "Core/Log.h"
 
-NB_REFLECT(Nightbird::Core::Transform, NB_NO_PARENT, NB_FACTORY(Nightbird::Core::Transform),
-	NB_FIELD(position),
-	NB_FIELD(rotation),
-	NB_FIELD(scale)
-)
+NB_REFLECT_STATIC(Nightbird::Core::Transform, NB_FACTORY(Nightbird::Core::Transform))
 
 namespace Nightbird::Core
 {
@@ -0,0 +1,294 @@
+#include "Core/TransformStore.h"
+
+#include <algorithm>
+#include <cassert>
+#include <numeric>
+
+#if defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1)
+	#define NB_TRANSFORM_SSE 1
+	#include <xmmintrin.h>
+#endif
+
+namespace Nightbird::Core
+{
+	static glm::mat4 ComposeTRS(const glm::vec3& position, const glm::quat& rotation, const glm::vec3& scale)
+	{
+		glm::mat4 matrix = glm::mat4_cast(rotation);
+		matrix[0] *= scale.x;
+		matrix[1] *= scale.y;
+		matrix[2] *= scale.z;
+		matrix[3] = glm::vec4(position, 1.0f);
+		return matrix;
+	}
+
+	static void MultiplyMatrix(const glm::mat4& a, const glm::mat4& b, glm::mat4& out)
+	{
+#ifdef NB_TRANSFORM_SSE
+		// glm is column-major, so each output column is a linear combination of a's columns
+		const float* aData = &a[0][0];
+		const __m128 a0 = _mm_loadu_ps(aData + 0);
+		const __m128 a1 = _mm_loadu_ps(aData + 4);
+		const __m128 a2 = _mm_loadu_ps(aData + 8);
+		const __m128 a3 = _mm_loadu_ps(aData + 12);
+
+		for (int column = 0; column < 4; ++column)
+		{
+			const float* bColumn = &b[column][0];
+			__m128 result = _mm_mul_ps(a0, _mm_set1_ps(bColumn[0]));
+			result = _mm_add_ps(result, _mm_mul_ps(a1, _mm_set1_ps(bColumn[1])));
+			result = _mm_add_ps(result, _mm_mul_ps(a2, _mm_set1_ps(bColumn[2])));
+			result = _mm_add_ps(result, _mm_mul_ps(a3, _mm_set1_ps(bColumn[3])));
+			_mm_storeu_ps(&out[column][0], result);
+		}
+#else
+		out = a * b;
+#endif
+	}
+
+	TransformStore::Handle TransformStore::Allocate()
+	{
+		assert(!m_Deferred && "TransformStore: Nodes can't be added while deferred");
+
+		Handle handle;
+		if (!m_FreeHandles.empty())
+		{
+			handle = m_FreeHandles.back();
+			m_FreeHandles.pop_back();
+		}
+		else
+		{
+			handle = static_cast<Handle>(m_Indices.size());
+			m_Indices.push_back(InvalidIndex);
+		}
+
+		// Appending keeps parent-first order since a new node has no children yet
+		m_Indices[handle] = static_cast<uint32_t>(m_Handles.size());
+
+		m_Handles.push_back(handle);
+		m_ParentHandles.push_back(InvalidHandle);
+		m_Parents.push_back(InvalidIndex);
+		m_Positions.push_back(glm::vec3(0.0f));
+		m_Rotations.push_back(glm::quat(1.0f, 0.0f, 0.0f, 0.0f));
+		m_Scales.push_back(glm::vec3(1.0f));
+		m_Dirty.push_back(1);
+		m_LocalMatrices.push_back(glm::mat4(1.0f));
+		m_WorldMatrices.push_back(glm::mat4(1.0f));
+
+		m_AnyDirty = true;
+		return handle;
+	}
+
+	void TransformStore::Release(Handle handle)
+	{
+		assert(!m_Deferred && "TransformStore: Nodes can't be released while deferred");
+
+		if (handle >= m_Indices.size() || m_Indices[handle] == InvalidIndex)
+			return;
+
+		// Slot is compacted away by the next Reorder, the handle is recycled after that
+		m_Handles[m_Indices[handle]] = InvalidHandle;
+		m_Indices[handle] = InvalidIndex;
+		m_OrderDirty = true;
+	}
+
+	void TransformStore::SetParent(Handle handle, Handle parent)
+	{
+		assert(!m_Deferred && "TransformStore: Nodes can't be reparented while deferred");
+
+		uint32_t index = m_Indices[handle];
+
+		uint32_t parentIndex = InvalidIndex;
+		if (parent != InvalidHandle && parent < m_Indices.size())
+			parentIndex = m_Indices[parent];
+
+		m_ParentHandles[index] = parentIndex != InvalidIndex ? parent : InvalidHandle;
+		m_Parents[index] = parentIndex;
+		m_Dirty[index] = 1;
+		m_AnyDirty = true;
+
+		if (parentIndex != InvalidIndex && parentIndex > index)
+			m_OrderDirty = true;
+	}
+
+	void TransformStore::SetLocal(Handle handle, const Transform& transform)
+	{
+		uint32_t index = m_Indices[handle];
+
+		m_Positions[index] = transform.position;
+		m_Rotations[index] = transform.rotation;
+		m_Scales[index] = transform.scale;
+		m_Dirty[index] = 1;
+		m_AnyDirty = true;
+	}
+
+	const glm::mat4& TransformStore::GetLocalMatrix(Handle handle)
+	{
+		if (!m_Deferred && (m_AnyDirty || m_OrderDirty))
+			Update();
+
+		return m_LocalMatrices[m_Indices[handle]];
+	}
+
+	const glm::mat4& TransformStore::GetWorldMatrix(Handle handle)
+	{
+		if (!m_Deferred && (m_AnyDirty || m_OrderDirty))
+			Update();
+
+		return m_WorldMatrices[m_Indices[handle]];
+	}
+
+	void TransformStore::Update()
+	{
+		assert(!m_Deferred && "TransformStore: Update called while deferred");
+
+		if (m_OrderDirty)
+			Reorder();
+
+		if (!m_AnyDirty)
+			return;
+
+		const uint32_t count = static_cast<uint32_t>(m_Handles.size());
+		uint8_t* dirty = m_Dirty.data();
+		const uint32_t* parents = m_Parents.data();
+
+		for (uint32_t i = 0; i < count; ++i)
+		{
+			const uint32_t parent = parents[i];
+
+			// Parents are always resolved first, so their dirty flag is already final
+			if (parent != InvalidIndex)
+				dirty[i] |= dirty[parent];
+
+			if (!dirty[i])
+				continue;
+
+			m_LocalMatrices[i] = ComposeTRS(m_Positions[i], m_Rotations[i], m_Scales[i]);
+
+			if (parent != InvalidIndex)
+				MultiplyMatrix(m_WorldMatrices[parent], m_LocalMatrices[i], m_WorldMatrices[i]);
+			else
+				m_WorldMatrices[i] = m_LocalMatrices[i];
+
+			m_Changed.push_back(m_Handles[i]);
+		}
+
+		std::fill(m_Dirty.begin(), m_Dirty.end(), 0);
+		m_AnyDirty = false;
+	}
+
+	void TransformStore::SetDeferred(bool deferred)
+	{
+		m_Deferred = deferred;
+	}
+
+	bool TransformStore::IsDeferred() const
+	{
+		return m_Deferred;
+	}
+
+	const std::vector<TransformStore::Handle>& TransformStore::GetChanged() const
+	{
+		return m_Changed;
+	}
+
+	void TransformStore::ClearChanged()
+	{
+		m_Changed.clear();
+	}
+
+	size_t TransformStore::GetCount() const
+	{
+		return m_Handles.size();
+	}
+
+	void TransformStore::Reorder()
+	{
+		const uint32_t count = static_cast<uint32_t>(m_Handles.size());
+
+		// Depth of each live node, walking up until a known depth is found
+		std::vector<uint32_t> depths(count, InvalidIndex);
+		std::vector<uint32_t> chain;
+
+		for (uint32_t i = 0; i < count; ++i)
+		{
+			if (m_Handles[i] == InvalidHandle)
+				continue;
+
+			uint32_t current = i;
+			while (current != InvalidIndex && depths[current] == InvalidIndex)
+			{
+				chain.push_back(current);
+
+				Handle parentHandle = m_ParentHandles[current];
+				current = parentHandle != InvalidHandle ? m_Indices[parentHandle] : InvalidIndex;
+			}
+
+			uint32_t depth = current != InvalidIndex ? depths[current] + 1 : 0;
+			for (auto it = chain.rbegin(); it != chain.rend(); ++it)
+				depths[*it] = depth++;
+
+			chain.clear();
+		}
+
+		std::vector<uint32_t> order;
+		order.reserve(count);
+		for (uint32_t i = 0; i < count; ++i)
+		{
+			if (m_Handles[i] != InvalidHandle)
+				order.push_back(i);
+		}
+
+		std::stable_sort(order.begin(), order.end(), [&](uint32_t a, uint32_t b) { return depths[a] < depths[b]; });
+
+		auto gather = [&order](auto& values)
+		{
+			std::remove_reference_t<decltype(values)> sorted;
+			sorted.reserve(order.size());
+			for (uint32_t index : order)
+				sorted.push_back(values[index]);
+			values = std::move(sorted);
+		};
+
+		gather(m_Handles);
+		gather(m_ParentHandles);
+		gather(m_Positions);
+		gather(m_Rotations);
+		gather(m_Scales);
+		gather(m_Dirty);
+		gather(m_LocalMatrices);
+		gather(m_WorldMatrices);
+
+		// Released handles are only recycled once nothing can still reference them
+		m_FreeHandles.clear();
+		for (Handle handle = 0; handle < m_Indices.size(); ++handle)
+			m_Indices[handle] = InvalidIndex;
+
+		for (uint32_t i = 0; i < static_cast<uint32_t>(m_Handles.size()); ++i)
+			m_Indices[m_Handles[i]] = i;
+
+		for (Handle handle = 0; handle < m_Indices.size(); ++handle)
+		{
+			if (m_Indices[handle] == InvalidIndex)
+				m_FreeHandles.push_back(handle);
+		}
+
+		m_Parents.resize(m_Handles.size());
+		for (uint32_t i = 0; i < static_cast<uint32_t>(m_Handles.size()); ++i)
+		{
+			Handle parentHandle = m_ParentHandles[i];
+			uint32_t parentIndex = parentHandle != InvalidHandle ? m_Indices[parentHandle] : InvalidIndex;
+
+			// Parent was released while this node stayed alive
+			if (parentIndex == InvalidIndex && parentHandle != InvalidHandle)
+			{
+				m_ParentHandles[i] = InvalidHandle;
+				m_Dirty[i] = 1;
+				m_AnyDirty = true;
+			}
+
+			m_Parents[i] = parentIndex;
+		}
+
+		m_OrderDirty = false;
+	}
+}
@@ -1,8 +1,11 @@
 #include "Core/TypeRegistry.h"
+#include "Core/FieldLayout.h"
 
 #include <Core/Log.h>
 
+#include <memory>
 #include <unordered_map>
+#include <algorithm>
 #include <cassert>
 
 namespace Nightbird
@@ -30,6 +33,19 @@ namespace Nightbird
 		return s_Map;
 	}
 
+	// Other copies of registered types, e.g. engine types linked into a project library
+	static std::vector<TypeInfo*>& GetAliases() noexcept
+	{
+		static std::vector<TypeInfo*> s_Aliases;
+		return s_Aliases;
+	}
+
+	static std::vector<std::unique_ptr<FieldLayout>>& GetLayouts() noexcept
+	{
+		static std::vector<std::unique_ptr<FieldLayout>> s_Layouts;
+		return s_Layouts;
+	}
+
 	void TypeRegistry::InitReflection() noexcept
 	{
 		auto& list = GetReflectionApplyList();
@@ -37,6 +53,91 @@ namespace Nightbird
 		{
 			apply();
 		}
+
+		BuildHierarchy();
+	}
+
+	using ChildMap = std::unordered_map<const TypeInfo*, std::vector<TypeInfo*>>;
+
+	static void AssignHierarchyRange(TypeInfo* type, const ChildMap& children, uint32_t& next) noexcept
+	{
+		type->hierarchyBegin = next++;
+
+		auto it = children.find(type);
+		if (it != children.end())
+		{
+			for (TypeInfo* child : it->second)
+				AssignHierarchyRange(child, children, next);
+		}
+
+		type->hierarchyEnd = next;
+	}
+
+	static void BuildFieldLayout(TypeInfo* type) noexcept
+	{
+		if (!type || type->layout)
+			return;
+
+		auto& layouts = GetLayouts();
+		layouts.push_back(std::make_unique<FieldLayout>(type));
+		type->layout = layouts.back().get();
+
+		// Generated code is only trusted while it agrees with the runtime field tables
+		if (type->ops && type->ops->fingerprint != type->layout->GetFingerprint())
+		{
+			Core::Log::Error("TypeRegistry: Static field list of " + std::string(type->name) + " doesn't match its FieldInfo, using the generic path");
+			type->ops = nullptr;
+		}
+
+		// Nested object types are read on their own by the text and version 1 scene readers
+		for (const FieldInfo* field : type->layout->GetFields())
+		{
+			if (field->kind == FieldKind::Object)
+				BuildFieldLayout(const_cast<TypeInfo*>(field->type));
+		}
+	}
+
+	void TypeRegistry::BuildHierarchy() noexcept
+	{
+		auto& types = GetTypes();
+
+		// Parents that were never registered themselves still need a range
+		for (size_t i = 0; i < types.size(); ++i)
+		{
+			if (types[i]->parent && !Find(types[i]->parent->nameHash))
+				Register(const_cast<TypeInfo*>(types[i]->parent));
+		}
+
+		// Parents are resolved by hash so copies from other modules map onto the registered type
+		ChildMap children;
+		std::vector<TypeInfo*> roots;
+		for (TypeInfo* type : types)
+		{
+			const TypeInfo* parent = type->parent ? Find(type->parent->nameHash) : nullptr;
+			if (parent && parent != type)
+				children[parent].push_back(type);
+			else
+				roots.push_back(type);
+		}
+
+		// Start at 1, 0 marks an unassigned range
+		uint32_t next = 1;
+		for (TypeInfo* root : roots)
+			AssignHierarchyRange(root, children, next);
+
+		for (TypeInfo* alias : GetAliases())
+		{
+			const TypeInfo* type = Find(alias->nameHash);
+			alias->hierarchyBegin = type->hierarchyBegin;
+			alias->hierarchyEnd = type->hierarchyEnd;
+		}
+
+		// Layouts never change once built, so readers on other threads can hold on to them
+		for (TypeInfo* type : types)
+			BuildFieldLayout(type);
+
+		for (TypeInfo* alias : GetAliases())
+			alias->layout = Find(alias->nameHash)->layout;
 	}
 	
 	void TypeRegistry::Register(TypeInfo* type) noexcept
@@ -51,6 +152,9 @@ namespace Nightbird
 
 		if (!inserted)
 		{
+			if (it->second != type && std::find(GetAliases().begin(), GetAliases().end(), type) == GetAliases().end())
+				GetAliases().push_back(type);
+
 			//if (it->second != type)
 				//Core::Log::Error("TypeRegistry: Hash collision or duplicate name: " + std::string(type->name));
 			//assert(it->second == type && "TypeRegistry: Hash collision or duplicate name");
@@ -6,4 +6,8 @@ namespace Nightbird::Audio
 {
 	using Handle = uint32_t;
 	static constexpr Handle InvalidHandle = 0;
+
+	// Higher priority sounds take voices from lower ones when a provider runs out
+	using Priority = uint8_t;
+	static constexpr Priority DefaultPriority = 128;
 }
@@ -2,6 +2,8 @@
 
 #include "Audio/AudioHandle.h"
 
+#include <cstddef>
+
 namespace Nightbird::Core
 {
 	class AudioAsset;
@@ -9,6 +11,16 @@ namespace Nightbird::Core
 
 namespace Nightbird::Audio
 {
+	// Per-voice panning and pitch of a positioned sound, applied on top of the voice's volume.
+	// Gains are unity at centre and reach sqrt(2) on one side, providers without an output clamp limit them.
+	struct SpatialParams
+	{
+		Handle handle = InvalidHandle;
+		float gainLeft = 1.0f;
+		float gainRight = 1.0f;
+		float pitch = 1.0f;
+	};
+
 	class Provider
 	{
 	public:
@@ -17,13 +29,15 @@ namespace Nightbird::Audio
 		virtual void Shutdown() = 0;
 		virtual void Update() = 0;
 
-		virtual Handle Play(const Core::AudioAsset& audio, bool loop) = 0;
-		virtual void PlayOnce(const Core::AudioAsset& audio) = 0;
+		virtual Handle Play(const Core::AudioAsset& audio, bool loop, Priority priority) = 0;
+		virtual void PlayOnce(const Core::AudioAsset& audio, Priority priority) = 0;
 		virtual void Stop(Handle handle) = 0;
 		virtual void Pause(Handle handle) = 0;
 		virtual void Resume(Handle handle) = 0;
 
 		virtual void SetVolume(Handle handle, float volume) = 0;
+		// Called once a frame with every spatialized voice, stale handles are ignored
+		virtual void SetSpatialParams(const SpatialParams* params, size_t count) = 0;
 
 		virtual bool IsPlaying(Handle handle) const = 0;
 	};
@@ -0,0 +1,48 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <span>
+#include <vector>
+
+namespace Nightbird::Core
+{
+	// Immutable array of asset data that either owns its elements or views memory kept alive by
+	// an owner, e.g. a memory-mapped cooked file. Copies share the same data.
+	template<typename T>
+	class AssetBuffer
+	{
+	public:
+		AssetBuffer() = default;
+
+		AssetBuffer(std::vector<T> data)
+		{
+			auto owned = std::make_shared<const std::vector<T>>(std::move(data));
+			m_Data = owned->data();
+			m_Size = owned->size();
+			m_Owner = std::move(owned);
+		}
+
+		AssetBuffer(std::shared_ptr<const void> owner, const T* data, size_t size)
+			: m_Owner(std::move(owner)), m_Data(data), m_Size(size)
+		{
+
+		}
+
+		const T* data() const { return m_Data; }
+		size_t size() const { return m_Size; }
+		bool empty() const { return m_Size == 0; }
+
+		const T* begin() const { return m_Data; }
+		const T* end() const { return m_Data + m_Size; }
+
+		const T& operator[](size_t index) const { return m_Data[index]; }
+
+		operator std::span<const T>() const { return { m_Data, m_Size }; }
+
+	private:
+		std::shared_ptr<const void> m_Owner;
+		const T* m_Data = nullptr;
+		size_t m_Size = 0;
+	};
+}
@@ -2,9 +2,17 @@
 
 #include "Core/SceneReadResult.h"
 
+#include "Core/TypeInfo.h"
+#include "Core/JobSystem.h"
+
 #include <uuid.h>
 
+#include <functional>
+#include <list>
 #include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
 
 namespace Nightbird::Core
 {
@@ -13,41 +21,149 @@ namespace Nightbird::Core
 	class Texture;
 	class Cubemap;
 	class AudioAsset;
+	class SceneTemplate;
+
+	enum class AssetType : uint8_t
+	{
+		Mesh,
+		Material,
+		Texture,
+		Cubemap,
+		Audio,
+		Scene,
+		Count
+	};
+
+	struct AssetLoadState
+	{
+		using Callback = std::function<void(const std::shared_ptr<void>& asset)>;
+
+		uuids::uuid uuid;
+		std::atomic<bool> done = false;
+		std::shared_ptr<void> asset;
+		std::vector<Callback> callbacks;
+	};
+
+	class AssetLoadHandle
+	{
+	public:
+		AssetLoadHandle() = default;
+		explicit AssetLoadHandle(std::shared_ptr<const AssetLoadState> state) : m_State(std::move(state)) {}
+
+		bool IsValid() const { return m_State != nullptr; }
+		// True once the completion callbacks have run on the main thread
+		bool IsDone() const { return m_State && m_State->done; }
+
+	private:
+		std::shared_ptr<const AssetLoadState> m_State;
+	};
 
 	class AssetManager
 	{
 	public:
 		virtual ~AssetManager() = default;
-		
+
+		// Load may be called from any thread. Two threads loading the same asset at once
+		// can both parse it, the first one to finish is kept.
 		template<typename T>
 		std::weak_ptr<T> Load(const uuids::uuid& uuid)
 		{
-			auto it = m_Cache.find(uuid);
-			if (it != m_Cache.end())
-				return std::static_pointer_cast<T>(it->second);
+			return LoadShared<T>(uuid);
+		}
+
+		// Like Load, but the caller holds the asset from the moment it leaves the cache, so a
+		// budget eviction can't release it in between. Use this from loaders and worker threads.
+		template<typename T>
+		std::shared_ptr<T> LoadShared(const uuids::uuid& uuid)
+		{
+			{
+				std::lock_guard<std::mutex> lock(m_CacheMutex);
+				auto it = m_Cache.find(uuid);
+				if (it != m_Cache.end())
+				{
+					Touch(it->second);
+					return std::static_pointer_cast<T>(it->second.asset);
+				}
+			}
 
 			std::shared_ptr<T> asset = LoadInternal<T>(uuid);
-			if (asset)
-				m_Cache[uuid] = asset;
-			return asset;
+			if (!asset)
+				return asset;
+
+			std::lock_guard<std::mutex> lock(m_CacheMutex);
+			return std::static_pointer_cast<T>(AddToCache(uuid, asset, GetAssetType<T>()));
 		}
 
+		// Loads on the job system. onLoaded runs on the main thread from ProcessAsyncLoads.
 		template<typename T>
-		void Insert(const uuids::uuid& uuid, std::shared_ptr<T> asset)
+		AssetLoadHandle LoadAsync(const uuids::uuid& uuid, std::function<void(std::weak_ptr<T>)> onLoaded = nullptr)
 		{
-			m_Cache[uuid] = asset;
+			AssetLoadState::Callback callback;
+			if (onLoaded)
+			{
+				callback = [onLoaded = std::move(onLoaded)](const std::shared_ptr<void>& asset)
+				{
+					onLoaded(std::static_pointer_cast<T>(asset));
+				};
+			}
+
+			return StartAsyncLoad(uuid, std::move(callback), [this, uuid]() -> std::shared_ptr<void>
+			{
+				return LoadShared<T>(uuid);
+			});
 		}
 
-		void Unload(const uuids::uuid& uuid)
+		// Untyped LoadAsync for reflected asset types, e.g. from an AssetRef field's TypeInfo
+		AssetLoadHandle LoadAsync(const TypeInfo* type, const uuids::uuid& uuid);
+
+		// Loads all of them across the job system and returns once they are cached
+		template<typename T>
+		void LoadParallel(const std::vector<uuids::uuid>& uuids)
 		{
-			m_Cache.erase(uuid);
+			RunParallel(static_cast<uint32_t>(uuids.size()), [this, &uuids](uint32_t index)
+			{
+				LoadShared<T>(uuids[index]);
+			});
 		}
 
-		void UnloadAll()
+		// Main thread only
+		void ProcessAsyncLoads();
+		void WaitForAsyncLoads();
+		bool HasPendingAsyncLoads();
+
+		void SetJobSystem(JobSystem* jobSystem);
+
+		template<typename T>
+		void Insert(const uuids::uuid& uuid, std::shared_ptr<T> asset)
 		{
-			m_Cache.clear();
+			std::lock_guard<std::mutex> lock(m_CacheMutex);
+			RemoveFromCache(uuid);
+			AddToCache(uuid, asset, GetAssetType<T>());
 		}
 
+		// Drop the cache's reference, so the next Load reads the asset again. AssetRefs hold strong
+		// references, so an asset still used by objects stays in memory until they release it. Those are logged.
+		void Unload(const uuids::uuid& uuid);
+		void UnloadAll();
+
+		// Main thread, once per frame. Runs async load callbacks and trims the cache to the budget.
+		void Update();
+
+		// Assets only the cache references are evicted least recently used first once the
+		// budget is exceeded. Assets used during the current or previous frame are never evicted. 0 disables the budget.
+		void SetMemoryBudget(size_t bytes);
+		size_t GetMemoryBudget() const;
+
+		size_t GetMemoryUsage() const;
+		size_t GetMemoryUsage(AssetType type) const;
+
+		// Evicts every asset only the cache references, returns the number of bytes freed
+		size_t CollectUnused();
+
+		// Copies the scene from its cached template, e.g. to spawn a prefab at runtime.
+		// Unlike LoadScene, the returned objects already have their assets resolved.
+		SceneReadResult InstantiateScene(const uuids::uuid& uuid);
+
 	protected:
 		virtual SceneReadResult LoadScene(const uuids::uuid& uuid) = 0;
 		virtual std::shared_ptr<Mesh> LoadMesh(const uuids::uuid& uuid) = 0;
@@ -55,6 +171,7 @@ namespace Nightbird::Core
 		virtual std::shared_ptr<Texture> LoadTexture(const uuids::uuid& uuid) = 0;
 		virtual std::shared_ptr<Cubemap> LoadCubemap(const uuids::uuid& uuid) = 0;
 		virtual std::shared_ptr<AudioAsset> LoadAudio(const uuids::uuid& uuid) = 0;
+		virtual std::shared_ptr<SceneTemplate> LoadSceneTemplate(const uuids::uuid& uuid);
 
 	private:
 		template<typename T>
@@ -70,9 +187,62 @@ namespace Nightbird::Core
 				return LoadCubemap(uuid);
 			if constexpr (std::is_same_v<T, AudioAsset>)
 				return LoadAudio(uuid);
+			if constexpr (std::is_same_v<T, SceneTemplate>)
+				return LoadSceneTemplate(uuid);
 			return nullptr;
 		}
+
+		template<typename T>
+		static constexpr AssetType GetAssetType()
+		{
+			if constexpr (std::is_same_v<T, Mesh>)
+				return AssetType::Mesh;
+			else if constexpr (std::is_same_v<T, Material>)
+				return AssetType::Material;
+			else if constexpr (std::is_same_v<T, Texture>)
+				return AssetType::Texture;
+			else if constexpr (std::is_same_v<T, Cubemap>)
+				return AssetType::Cubemap;
+			else if constexpr (std::is_same_v<T, AudioAsset>)
+				return AssetType::Audio;
+			else
+				return AssetType::Scene;
+		}
+
+		struct CacheEntry
+		{
+			std::shared_ptr<void> asset;
+			AssetType type = AssetType::Mesh;
+			size_t size = 0;
+			uint64_t lastUsedFrame = 0;
+			std::list<uuids::uuid>::iterator lruPosition;
+		};
+
+		// The following expect m_CacheMutex to be held
+		const std::shared_ptr<void>& AddToCache(const uuids::uuid& uuid, std::shared_ptr<void> asset, AssetType type);
+		void RemoveFromCache(const uuids::uuid& uuid);
+		void Touch(CacheEntry& entry);
+		size_t Evict(size_t targetUsage, bool keepRecent);
 		
-		std::unordered_map<uuids::uuid, std::shared_ptr<void>> m_Cache;
+		AssetLoadHandle StartAsyncLoad(const uuids::uuid& uuid, AssetLoadState::Callback callback, std::function<std::shared_ptr<void>()> load);
+		void RunParallel(uint32_t count, const std::function<void(uint32_t index)>& function);
+
+		std::unordered_map<uuids::uuid, CacheEntry> m_Cache;
+		// Most recently used at the front
+		std::list<uuids::uuid> m_LruList;
+		mutable std::mutex m_CacheMutex;
+
+		size_t m_MemoryBudget = 0;
+		size_t m_MemoryUsage = 0;
+		size_t m_TypeMemoryUsage[static_cast<size_t>(AssetType::Count)] = {};
+		uint64_t m_Frame = 1;
+		bool m_OverBudgetWarned = false;
+
+		JobSystem* m_JobSystem = nullptr;
+		JobCounter m_AsyncCounter;
+
+		std::mutex m_AsyncMutex;
+		std::unordered_map<uuids::uuid, std::shared_ptr<AssetLoadState>> m_AsyncLoads;
+		std::vector<std::shared_ptr<AssetLoadState>> m_CompletedLoads;
 	};
 }
\ No newline at end of file
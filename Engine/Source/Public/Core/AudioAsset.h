@@ -1,7 +1,9 @@
 #pragma once
 
 #include "Core/Reflection.h"
+#include "Core/AssetBuffer.h"
 
+#include <string>
 #include <vector>
 #include <cstdint>
 
@@ -13,23 +15,47 @@ namespace Nightbird::Core
 		DSP_ADPCM = 1
 	};
 
+	// Flags byte of the .nbaudio header
+	namespace AudioFlags
+	{
+		// Samples are read from disk while playing instead of being loaded with the asset
+		constexpr uint8_t Streamed = 1 << 0;
+	}
+
+	// Where a streamed clip's interleaved PCM16 frames are stored, a loose cooked file or part of the pak
+	struct AudioStreamSource
+	{
+		std::string path;
+		uint64_t offset = 0;
+		uint64_t size = 0;
+	};
+
 	class AudioAsset
 	{
 	public:
 		NB_TYPE_BASE()
+		AudioAsset(uint32_t sampleRate, uint32_t frameCount, uint8_t channels, AudioEncoding encoding, std::vector<AssetBuffer<uint8_t>> channelData);
 		AudioAsset(uint32_t sampleRate, uint32_t frameCount, uint8_t channels, AudioEncoding encoding, std::vector<std::vector<uint8_t>> channelData);
+		// Streamed clip, holds no sample data
+		AudioAsset(uint32_t sampleRate, uint32_t frameCount, uint8_t channels, AudioStreamSource streamSource);
 
 		uint32_t GetSampleRate() const;
 		uint32_t GetFrameCount() const;
 		uint8_t GetChannels() const;
 		AudioEncoding GetEncoding() const;
-		const std::vector<uint8_t>& GetChannelData(uint8_t channel) const;
+		const AssetBuffer<uint8_t>& GetChannelData(uint8_t channel) const;
+
+		bool IsStreamed() const;
+		const AudioStreamSource& GetStreamSource() const;
 
 	private:
 		uint32_t m_SampleRate;
 		uint32_t m_FrameCount;
 		uint32_t m_Channels;
 		AudioEncoding m_Encoding;
-		std::vector<std::vector<uint8_t>> m_ChannelData;
+		std::vector<AssetBuffer<uint8_t>> m_ChannelData;
+
+		bool m_Streamed = false;
+		AudioStreamSource m_StreamSource;
 	};
 }
@@ -8,10 +8,14 @@
 namespace Nightbird::Core
 {
 	class AudioAsset;
+	class BinaryReader;
+
+	struct AudioStreamSource;
 
 	class AudioLoader
 	{
 	public:
-		std::shared_ptr<AudioAsset> Load(const std::string& cookedDir, const uuids::uuid& uuid);
+		// file is where the reader's data is stored, streamed clips keep reading their samples from it
+		std::shared_ptr<AudioAsset> Load(BinaryReader& reader, const uuids::uuid& uuid, const AudioStreamSource& file);
 	};
 }
@@ -1,6 +1,6 @@
 #pragma once
 
-#include "Core/SceneObject.h"
+#include "Core/SpatialObject.h"
 #include "Core/AssetRef.h"
 #include "Audio/AudioHandle.h"
 
@@ -8,16 +8,26 @@ namespace Nightbird::Core
 {
 	class AudioAsset;
 
-	class AudioSource : public SceneObject
+	// How a spatial source fades between its min and max distance
+	enum class AudioAttenuation : uint32_t
+	{
+		// min / (min + rolloff * (distance - min))
+		Inverse,
+		// Falls linearly to silence at the max distance, rolloff steepens it
+		Linear,
+		// (distance / min) ^ -rolloff
+		Exponential
+	};
+
+	class AudioSource : public SpatialObject
 	{
 	public:
 		NB_TYPE()
 
-		using SceneObject::SceneObject;
+		using SpatialObject::SpatialObject;
 
 		void ResolveAssets(AssetManager& assetManager) override;
 		void EnterScene() override;
-		void Tick(float delta) override;
 
 		void Play();
 		void Stop();
@@ -34,14 +44,65 @@ namespace Nightbird::Core
 
 		bool GetPlayOnStart() const;
 		void SetPlayOnStart(bool playOnStart);
+
+		uint32_t GetPriority() const;
+		void SetPriority(uint32_t priority);
+
+		bool IsSpatial() const;
+		void SetSpatial(bool spatial);
+
+		float GetMinDistance() const;
+		void SetMinDistance(float minDistance);
+
+		float GetMaxDistance() const;
+		void SetMaxDistance(float maxDistance);
+
+		AudioAttenuation GetAttenuation() const;
+		void SetAttenuation(AudioAttenuation attenuation);
+
+		float GetRolloff() const;
+		void SetRolloff(float rolloff);
+
+		float GetDopplerFactor() const;
+		void SetDopplerFactor(float dopplerFactor);
+
+		// Voice of the current sound, InvalidHandle when stopped
+		Audio::Handle GetHandle() const;
 		
 		AssetRef<AudioAsset> m_Audio;
 
 		bool m_Loop = false;
 		bool m_PlayOnStart = true;
 		float m_Volume = 1.0f;
+		// 0-255, higher priority sources keep their voice when the provider runs out
+		uint32_t m_Priority = Audio::DefaultPriority;
+
+		// Spatial sources are attenuated and panned relative to the scene's active camera
+		bool m_Spatial = false;
+		// Full volume inside the min distance, attenuation stops past the max distance
+		float m_MinDistance = 1.0f;
+		float m_MaxDistance = 50.0f;
+		// AudioAttenuation
+		uint32_t m_Attenuation = static_cast<uint32_t>(AudioAttenuation::Inverse);
+		float m_Rolloff = 1.0f;
+		// Scales the doppler pitch shift, 0 disables it
+		float m_DopplerFactor = 0.0f;
 
 	private:
 		Audio::Handle m_Handle = Audio::InvalidHandle;
 	};
 }
+
+NB_STATIC_FIELDS(Nightbird::Core::AudioSource, Nightbird::Core::SpatialObject,
+	NB_STATIC_FIELD(m_Audio),
+	NB_STATIC_FIELD(m_Loop),
+	NB_STATIC_FIELD(m_PlayOnStart),
+	NB_STATIC_FIELD(m_Volume),
+	NB_STATIC_FIELD(m_Priority),
+	NB_STATIC_FIELD(m_Spatial),
+	NB_STATIC_FIELD(m_MinDistance),
+	NB_STATIC_FIELD(m_MaxDistance),
+	NB_STATIC_FIELD(m_Attenuation),
+	NB_STATIC_FIELD(m_Rolloff),
+	NB_STATIC_FIELD(m_DopplerFactor)
+)
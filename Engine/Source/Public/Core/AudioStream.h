@@ -0,0 +1,114 @@
+#pragma once
+
+#include "Core/AudioAsset.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace Nightbird::Core
+{
+	// Plays a streamed clip through a small ring buffer. The streaming thread refills it in
+	// fixed-size chunks from the file, the audio thread consumes frames without locking.
+	// Looping clips wrap in the streaming thread, so the end joins the start seamlessly.
+	class AudioStream
+	{
+	public:
+		static constexpr size_t ChunkSize = 64 * 1024;
+		static constexpr size_t ChunkCount = 4;
+
+		AudioStream(const AudioAsset& audio, bool loop);
+
+		AudioStream(const AudioStream&) = delete;
+		AudioStream& operator=(const AudioStream&) = delete;
+
+		uint32_t GetFrameCount() const;
+		uint8_t GetChannels() const;
+		uint32_t GetSampleRate() const;
+
+		// Audio thread. True once the first chunks are in the ring, or the file failed to read
+		bool IsReady() const;
+
+		// Audio thread. Copies up to frameCount frames and returns how many. Missing data is
+		// filled with silence, fewer frames are only returned at the end of a non-looping clip
+		// or when the file failed to read.
+		uint32_t Read(int16_t* destination, uint32_t frameCount, bool& outAtEnd);
+
+		void SetLooping(bool loop);
+
+		// Streaming thread, or any thread before the stream is handed to it.
+		// Reads chunks until the ring is full, false if the file can't be read.
+		bool Fill();
+
+		uint32_t GetUnderrunCount() const;
+
+	private:
+		static constexpr uint64_t NoIndex = UINT64_MAX;
+
+		AudioStreamSource m_Source;
+		uint32_t m_FrameCount;
+		uint8_t m_Channels;
+		uint32_t m_SampleRate;
+		uint32_t m_FrameSize;
+
+		// Sizes in frames
+		uint32_t m_ChunkFrames;
+		uint32_t m_RingFrames;
+		std::vector<int16_t> m_Ring;
+
+		// Frames ever written and read, positions in the ring are these modulo m_RingFrames
+		std::atomic<uint64_t> m_WriteIndex = 0;
+		std::atomic<uint64_t> m_ReadIndex = 0;
+		// Write index at which a non-looping clip ends
+		std::atomic<uint64_t> m_EndIndex = NoIndex;
+
+		std::atomic<bool> m_Looping;
+
+		std::atomic<uint32_t> m_Underruns = 0;
+
+		std::atomic<bool> m_Ready = false;
+		std::atomic<bool> m_Failed = false;
+
+		// Streaming thread only
+		std::ifstream m_File;
+		uint32_t m_FileFrame = 0;
+
+		bool FillRing();
+		bool SeekFile(uint32_t frame);
+	};
+
+	// Background thread refilling every registered stream
+	class AudioStreamer
+	{
+	public:
+		AudioStreamer() = default;
+		~AudioStreamer();
+
+		AudioStreamer(const AudioStreamer&) = delete;
+		AudioStreamer& operator=(const AudioStreamer&) = delete;
+
+		void Start();
+		void Stop();
+
+		// New streams are filled right away, playback waits for IsReady
+		void Add(std::shared_ptr<AudioStream> stream);
+		void Remove(const AudioStream* stream);
+
+	private:
+		std::thread m_Thread;
+		std::mutex m_Mutex;
+		std::condition_variable m_Condition;
+		std::vector<std::shared_ptr<AudioStream>> m_Streams;
+		bool m_Running = false;
+		// Set by Add so new streams are filled without waiting out the interval
+		bool m_Added = false;
+
+		void Run();
+	};
+}
@@ -9,6 +9,7 @@
 #include "Core/MaterialLoader.h"
 #include "Core/TextureLoader.h"
 #include "Core/AudioLoader.h"
+#include "Core/PakFile.h"
 
 #include <uuid.h>
 
@@ -24,10 +25,16 @@ namespace Nightbird::Core
 	
 	struct ProjectInfo;
 
+	class BinaryReader;
+
+	// Reads from Assets.nbpak in the cooked directory when present, otherwise from loose files.
+	// Assets missing from the pak fall back to loose files, so single assets can be recooked while iterating.
 	class BinaryAssetManager : public AssetManager
 	{
 	public:
 		explicit BinaryAssetManager(const std::string& cookedDir);
+
+		bool IsUsingPak() const;
 		
 		ProjectInfo LoadProject();
 
@@ -43,6 +50,8 @@ namespace Nightbird::Core
 	private:
 		std::string m_CookedDir;
 
+		PakFile m_Pak;
+
 		std::unique_ptr<BinarySceneReader> m_SceneReader;
 		std::unique_ptr<ProjectLoader> m_ProjectLoader;
 		std::unique_ptr<TextureLoader> m_TextureLoader;
@@ -50,6 +59,8 @@ namespace Nightbird::Core
 		std::unique_ptr<MeshLoader> m_MeshLoader;
 		std::unique_ptr<AudioLoader> m_AudioLoader;
 		
+		BinaryReader OpenAsset(const uuids::uuid& uuid, const char* extension);
+
 		void LoadNestedScenes(SceneObject* object);
 	};
 }
@@ -1,19 +1,33 @@
 #pragma once
 
+#include "Core/AssetBuffer.h"
+
+#include <cstring>
+#include <memory>
+#include <span>
 #include <string>
+#include <type_traits>
 #include <vector>
-#include <fstream>
 #include <cstdint>
 
 namespace Nightbird::Core
 {
 	struct Vertex;
 
+	// Reads a cooked file or pak entry from memory. Files are memory-mapped where the platform
+	// supports it, otherwise read whole. Reading past the end yields zeros and makes the reader invalid.
 	class BinaryReader
 	{
 	public:
-		BinaryReader(const std::string& path);
+		BinaryReader() = default;
+		explicit BinaryReader(const std::string& path);
+		explicit BinaryReader(std::vector<uint8_t> data);
+		// View into memory kept alive by owner, e.g. an entry of a mapped pak
+		BinaryReader(std::shared_ptr<const void> owner, const uint8_t* data, size_t size);
+
 		bool IsValid() const;
+		// Offset of the next read from the start of the data
+		size_t GetPosition() const;
 
 		uint8_t ReadUInt8();
 		uint16_t ReadUInt16();
@@ -27,9 +41,49 @@ namespace Nightbird::Core
 		std::vector<Vertex> ReadVertices(uint32_t count);
 		std::vector<uint16_t> ReadIndices(uint32_t count);
 		void ReadRawBytes(uint8_t* destination, size_t size);
+		// Points into the reader's memory, valid while the reader is alive. nullptr if fewer than size bytes are left.
+		const uint8_t* ReadBytes(size_t size);
+
+		// Copies destination.size() elements in one go. Cooked files are written in the
+		// target's byte order, so no swapping is needed at runtime.
+		template<typename T>
+		void ReadSpan(std::span<T> destination)
+		{
+			static_assert(std::is_trivially_copyable_v<T>);
+			ReadRawBytes(reinterpret_cast<uint8_t*>(destination.data()), destination.size_bytes());
+		}
+
+		// count elements stored in native layout and byte order. References the reader's memory
+		// without copying when it is suitably aligned, the buffer keeps that memory alive.
+		template<typename T>
+		AssetBuffer<T> ReadBuffer(size_t count)
+		{
+			static_assert(std::is_trivially_copyable_v<T>);
+
+			if (!m_Valid || count > (m_Size - m_Position) / sizeof(T))
+			{
+				m_Position = m_Size;
+				m_Valid = false;
+				return {};
+			}
+
+			const uint8_t* source = m_Data + m_Position;
+			m_Position += count * sizeof(T);
+
+			if (reinterpret_cast<uintptr_t>(source) % alignof(T) == 0)
+				return AssetBuffer<T>(m_Owner, reinterpret_cast<const T*>(source), count);
+
+			std::vector<T> copy(count);
+			std::memcpy(copy.data(), source, count * sizeof(T));
+			return AssetBuffer<T>(std::move(copy));
+		}
 
 	private:
-		std::ifstream m_File;
+		std::shared_ptr<const void> m_Owner;
+		const uint8_t* m_Data = nullptr;
+		size_t m_Size = 0;
+		size_t m_Position = 0;
+		bool m_Valid = false;
 
 		template<typename T>
 		T ReadValue();
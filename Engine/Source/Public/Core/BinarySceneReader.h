@@ -18,11 +18,15 @@ namespace Nightbird::Core
 	class BinarySceneReader
 	{
 	public:
-		SceneReadResult Read(const std::string& cookedDir, const uuids::uuid& uuid);
+		SceneReadResult Read(BinaryReader& reader, const uuids::uuid& uuid);
 
 	private:
-		void ReadFields(uint8_t* object, const TypeInfo* type, BinaryReader& reader);
-		void ReadField(uint8_t* object, const TypeInfo* type, uint32_t nameHash, uint16_t size, BinaryReader& reader);
-		void SkipFields(uint16_t fieldCount, BinaryReader& reader);
+		bool ReadVersion1(BinaryReader& reader, const uuids::uuid& uuid, SceneReadResult& result);
+		bool ReadVersion2(BinaryReader& reader, const uuids::uuid& uuid, SceneReadResult& result);
+
+		// Version 1 readers, false when the file is truncated or an unknown nested object can't be skipped
+		bool ReadFields(uint8_t* object, const TypeInfo* type, uint32_t fieldCount, BinaryReader& reader);
+		bool ReadField(uint8_t* object, const FieldInfo* field, uint32_t nameHash, uint16_t size, BinaryReader& reader);
+		bool SkipFields(uint16_t fieldCount, BinaryReader& reader);
 	};
 }
@@ -18,3 +18,7 @@ namespace Nightbird::Core
 		glm::mat4 GetProjectionMatrix(float width, float height) const;
 	};
 }
+
+NB_STATIC_FIELDS(Nightbird::Core::Camera, Nightbird::Core::SpatialObject,
+	NB_STATIC_FIELD(m_Fov)
+)
@@ -1,8 +1,7 @@
 #pragma once
 
 #include "Core/Reflection.h"
-
-#include <vector>
+#include "Core/AssetBuffer.h"
 
 namespace Nightbird::Core
 {
@@ -10,16 +9,16 @@ namespace Nightbird::Core
 	{
 	public:
 		NB_TYPE_BASE()
-		Cubemap(uint32_t faceSize, std::vector<uint8_t> data);
+		Cubemap(uint32_t faceSize, AssetBuffer<uint8_t> data);
 
 		uint32_t GetFaceSize() const;
 
-		const std::vector<uint8_t>& GetData() const;
+		const AssetBuffer<uint8_t>& GetData() const;
 		void DiscardData();
 		bool HasData() const;
 
 	private:
 		uint32_t m_FaceSize;
-		std::vector<uint8_t> m_Data;
+		AssetBuffer<uint8_t> m_Data;
 	};
 }
\ No newline at end of file
@@ -15,3 +15,8 @@ namespace Nightbird::Core
 		float m_Intensity = 1.0f;
 	};
 }
+
+NB_STATIC_FIELDS(Nightbird::Core::DirectionalLight, Nightbird::Core::SpatialObject,
+	NB_STATIC_FIELD(m_Color),
+	NB_STATIC_FIELD(m_Intensity)
+)
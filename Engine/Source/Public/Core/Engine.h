@@ -5,6 +5,7 @@
 #include "Input/InputSystem.h"
 #include "Audio/AudioProvider.h"
 #include "Core/AudioAsset.h"
+#include "Core/JobSystem.h"
 
 namespace Nightbird::Core
 {
@@ -33,6 +34,8 @@ namespace Nightbird::Core
 
 		AssetManager& GetAssetManager();
 
+		JobSystem& GetJobSystem();
+
 		float GetDeltaTime() const;
 
 	private:
@@ -41,6 +44,9 @@ namespace Nightbird::Core
 
 		AssetManager& m_AssetManager;
 
+		// Declared before m_Scene so scene objects can still wait on jobs while being destroyed
+		JobSystem m_JobSystem;
+
 		std::unique_ptr<Scene> m_Scene;
 
 		Input::System m_InputSystem;
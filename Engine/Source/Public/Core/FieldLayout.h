@@ -0,0 +1,119 @@
+#pragma once
+
+#include "Core/TypeInfo.h"
+
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace Nightbird
+{
+	// Path hash of a field inside a nested object, so equal names in different objects stay distinct
+	constexpr uint32_t CombineFieldHash(uint32_t parentHash, uint32_t nameHash) noexcept
+	{
+		return (parentHash ^ nameHash) * 16777619u;
+	}
+
+	// Bytes a value takes in a packed blob, strings are stored as a 32-bit string table index.
+	// 0 for kinds that can't be packed.
+	constexpr uint32_t GetPackedSize(FieldKind kind) noexcept
+	{
+		switch (kind)
+		{
+		case FieldKind::Bool:
+			return 1;
+		case FieldKind::Int32:
+		case FieldKind::UInt32:
+		case FieldKind::Float:
+		case FieldKind::String:
+			return 4;
+		case FieldKind::Vector2:
+			return 8;
+		case FieldKind::Vector3:
+			return 12;
+		case FieldKind::Vector4:
+		case FieldKind::Quat:
+		case FieldKind::UUID:
+		case FieldKind::AssetRef:
+			return 16;
+		default:
+			return 0;
+		}
+	}
+
+	// Packed values with the same in-memory representation, these are block copied
+	constexpr bool IsPlainPackedKind(FieldKind kind) noexcept
+	{
+		return kind != FieldKind::Bool && kind != FieldKind::String && kind != FieldKind::UUID && kind != FieldKind::AssetRef;
+	}
+
+	// Fingerprint of a packed layout, fed one field at a time starting from FNVHash("")
+	constexpr uint32_t HashPackedField(uint32_t fingerprint, uint32_t pathHash, FieldKind kind) noexcept
+	{
+		for (int shift = 0; shift < 32; shift += 8)
+			fingerprint = (fingerprint ^ ((pathHash >> shift) & 0xFF)) * 16777619u;
+		return (fingerprint ^ static_cast<uint8_t>(kind)) * 16777619u;
+	}
+
+	// Leaf field of a type, fields of nested objects are expanded in place
+	struct FlatField
+	{
+		uint32_t pathHash = 0;
+		uint32_t offset = 0;
+		uint32_t packedOffset = 0;
+		FieldKind kind = FieldKind::Unknown;
+	};
+
+	// Moves packed values into an object. Runs of plain values that are contiguous both in the
+	// blob and in the object become a single copy, everything else is converted one by one.
+	struct PackedDecoder
+	{
+		struct Copy
+		{
+			uint32_t offset = 0;
+			uint32_t packedOffset = 0;
+			uint32_t size = 0;
+		};
+
+		std::vector<Copy> copies;
+		std::vector<FlatField> conversions;
+
+		void Add(const FlatField& field);
+	};
+
+	// Field tables of a type built once by TypeRegistry, so readers never walk the parent chain
+	class FieldLayout
+	{
+	public:
+		explicit FieldLayout(const TypeInfo* type);
+
+		// Fields of the type and its parents, parent fields first
+		const std::vector<const FieldInfo*>& GetFields() const noexcept { return m_Fields; }
+
+		// Packable leaf fields in the same order, with their offsets in a packed blob
+		const std::vector<FlatField>& GetFlatFields() const noexcept { return m_FlatFields; }
+		uint32_t GetPackedSize() const noexcept { return m_PackedSize; }
+
+		// Equal fingerprints mean the packed layouts match field for field
+		uint32_t GetFingerprint() const noexcept { return m_Fingerprint; }
+
+		const PackedDecoder& GetDecoder() const noexcept { return m_Decoder; }
+
+		const FieldInfo* Find(uint32_t nameHash) const noexcept;
+		const FlatField* FindFlat(uint32_t pathHash) const noexcept;
+
+	private:
+		std::vector<const FieldInfo*> m_Fields;
+		std::vector<FlatField> m_FlatFields;
+		uint32_t m_PackedSize = 0;
+		uint32_t m_Fingerprint = FNVHash("");
+
+		PackedDecoder m_Decoder;
+
+		// Sorted by hash, paired with the index into m_Fields and m_FlatFields
+		std::vector<std::pair<uint32_t, uint32_t>> m_FieldLookup;
+		std::vector<std::pair<uint32_t, uint32_t>> m_FlatLookup;
+
+		void Flatten(const TypeInfo* type, uint32_t baseOffset, uint32_t parentHash);
+	};
+}
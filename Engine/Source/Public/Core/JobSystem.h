@@ -0,0 +1,100 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace Nightbird::Core
+{
+	class JobSystem;
+
+	// Counts outstanding jobs. Jobs can be made to depend on a counter reaching zero.
+	class JobCounter
+	{
+	public:
+		bool IsDone() const;
+
+	private:
+		friend class JobSystem;
+
+		struct Continuation
+		{
+			std::function<void()> function;
+			JobCounter* counter;
+		};
+
+		std::atomic<uint32_t> m_Pending = 0;
+		std::mutex m_Mutex;
+		std::vector<Continuation> m_Continuations;
+	};
+
+	// Fixed pool of worker threads, each with its own deque.
+	// Workers pop their own newest job and steal the oldest job from others when empty.
+	// The thread that constructed the system owns queue 0 and runs jobs while it waits.
+	class JobSystem
+	{
+	public:
+		using JobFunction = std::function<void()>;
+		using RangeFunction = std::function<void(uint32_t begin, uint32_t end)>;
+
+		explicit JobSystem(uint32_t workerCount = GetDefaultWorkerCount());
+		~JobSystem();
+
+		JobSystem(const JobSystem&) = delete;
+		JobSystem& operator=(const JobSystem&) = delete;
+
+		// counter is incremented now and decremented once the job has run.
+		// If dependency is given, the job is only queued once it reaches zero.
+		void Run(JobFunction function, JobCounter* counter = nullptr, JobCounter* dependency = nullptr);
+
+		// Runs queued jobs on the calling thread until the counter reaches zero
+		void Wait(JobCounter& counter);
+
+		// Splits [0, count) into batches of batchSize and blocks until all of them have run
+		void ParallelFor(uint32_t count, uint32_t batchSize, const RangeFunction& function);
+
+		uint32_t GetWorkerCount() const;
+
+		static uint32_t GetDefaultWorkerCount();
+
+	private:
+		struct Job
+		{
+			JobFunction function;
+			JobCounter* counter = nullptr;
+		};
+
+		struct Queue
+		{
+			std::mutex mutex;
+			std::deque<Job> jobs;
+		};
+
+		std::vector<std::unique_ptr<Queue>> m_Queues;
+		std::vector<std::thread> m_Workers;
+
+		std::atomic<uint32_t> m_QueuedJobs = 0;
+		std::atomic<bool> m_Running = true;
+
+		std::mutex m_SleepMutex;
+		std::condition_variable m_WakeCondition;
+
+		void WorkerLoop(uint32_t queueIndex);
+
+		void Push(Job job);
+		bool TryPop(uint32_t queueIndex, Job& job);
+		bool TrySteal(uint32_t queueIndex, Job& job);
+		bool TryRunJob(uint32_t queueIndex);
+
+		void Execute(Job& job);
+		void Finish(JobCounter* counter);
+
+		uint32_t GetCurrentQueueIndex() const;
+	};
+}
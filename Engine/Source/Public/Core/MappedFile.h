@@ -0,0 +1,38 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+namespace Nightbird::Core
+{
+	// Read-only memory mapping of a whole file, unmapped when the last reference goes away
+	class MappedFile
+	{
+	public:
+		~MappedFile();
+
+		MappedFile(const MappedFile&) = delete;
+		MappedFile& operator=(const MappedFile&) = delete;
+
+		// Returns nullptr if the file can't be opened or the platform has no file mapping
+		static std::shared_ptr<MappedFile> Open(const std::string& path);
+
+		static bool IsSupported();
+
+		const uint8_t* GetData() const;
+		size_t GetSize() const;
+
+	private:
+		MappedFile() = default;
+
+		const uint8_t* m_Data = nullptr;
+		size_t m_Size = 0;
+
+#ifdef _WIN32
+		void* m_File = nullptr;
+		void* m_Mapping = nullptr;
+#endif
+	};
+}
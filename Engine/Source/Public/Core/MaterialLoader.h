@@ -8,11 +8,12 @@
 namespace Nightbird::Core
 {
 	class AssetManager;
+	class BinaryReader;
 	struct Material;
 
 	class MaterialLoader
 	{
 	public:
-		std::shared_ptr<Material> Load(AssetManager& assetManager, const std::string& cookedDir, const uuids::uuid& uuid);
+		std::shared_ptr<Material> Load(AssetManager& assetManager, BinaryReader& reader, const uuids::uuid& uuid);
 	};
 }
@@ -19,3 +19,7 @@ namespace Nightbird::Core
 		AssetRef<Mesh> m_Mesh;
 	};
 }
+
+NB_STATIC_FIELDS(Nightbird::Core::MeshInstance, Nightbird::Core::SpatialObject,
+	NB_STATIC_FIELD(m_Mesh)
+)
@@ -8,11 +8,12 @@
 namespace Nightbird::Core
 {
 	class AssetManager;
+	class BinaryReader;
 	class Mesh;
 
 	class MeshLoader
 	{
 	public:
-		std::shared_ptr<Mesh> Load(AssetManager& assetManager, const std::string& cookedDir, const uuids::uuid& uuid);
+		std::shared_ptr<Mesh> Load(AssetManager& assetManager, BinaryReader& reader, const uuids::uuid& uuid);
 	};
 }
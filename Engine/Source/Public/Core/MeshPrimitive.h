@@ -2,8 +2,8 @@
 
 #include "Core/Vertex.h"
 #include "Core/Material.h"
+#include "Core/AssetBuffer.h"
 
-#include <vector>
 #include <memory>
 
 namespace Nightbird::Core
@@ -11,15 +11,15 @@ namespace Nightbird::Core
 	class MeshPrimitive
 	{
 	public:
-		MeshPrimitive(std::vector<Vertex> vertices, std::vector<uint16_t> indices, std::shared_ptr<Material> material);
+		MeshPrimitive(AssetBuffer<Vertex> vertices, AssetBuffer<uint16_t> indices, std::shared_ptr<Material> material);
 
-		const std::vector<Vertex>& GetVertices() const;
-		const std::vector<uint16_t>& GetIndices() const;
+		const AssetBuffer<Vertex>& GetVertices() const;
+		const AssetBuffer<uint16_t>& GetIndices() const;
 		const std::shared_ptr<Material>& GetMaterial() const;
 
 	private:
-		std::vector<Vertex> m_Vertices;
-		std::vector<uint16_t> m_Indices;
+		AssetBuffer<Vertex> m_Vertices;
+		AssetBuffer<uint16_t> m_Indices;
 		std::shared_ptr<Material> m_Material;
 	};
 }
\ No newline at end of file
@@ -0,0 +1,74 @@
+#pragma once
+
+#include "Core/BinaryReader.h"
+
+#include <uuid.h>
+
+#include <cstdint>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace Nightbird::Core
+{
+	enum class PakEntryType : uint8_t
+	{
+		Project = 0,
+		Scene = 1,
+		Mesh = 2,
+		Material = 3,
+		Texture = 4,
+		Audio = 5
+	};
+
+	struct PakEntry
+	{
+		uuids::uuid uuid;
+		uint32_t offset = 0;
+		uint32_t size = 0;
+		PakEntryType type = PakEntryType::Project;
+		uint8_t flags = 0;
+	};
+
+	// .nbpak layout, in the target's byte order:
+	// "NPAK", version, entry count, reserved, then one 32 byte TOC entry per asset sorted by UUID
+	// (uuid, offset, size, type, flags, padding), then the entries' data, each 16 byte aligned.
+	// The project entry uses the nil UUID.
+	namespace Pak
+	{
+		constexpr uint32_t Version = 1;
+		constexpr uint32_t HeaderSize = 16;
+		constexpr uint32_t EntrySize = 32;
+		constexpr uint32_t Alignment = 16;
+
+		constexpr const char* FileName = "Assets.nbpak";
+	}
+
+	class MappedFile;
+
+	// Keeps the pak open for its lifetime. Where supported the whole pak is memory-mapped and
+	// entries are handed out as views into the mapping, otherwise they are read by offset.
+	class PakFile
+	{
+	public:
+		bool Open(const std::string& path);
+		bool IsOpen() const;
+
+		const PakEntry* Find(const uuids::uuid& uuid) const;
+
+		// Thread-safe, the reader is invalid if the entry couldn't be read
+		BinaryReader OpenEntry(const PakEntry& entry);
+
+		const std::vector<PakEntry>& GetEntries() const;
+
+	private:
+		std::shared_ptr<MappedFile> m_Mapping;
+
+		std::ifstream m_File;
+		std::mutex m_FileMutex;
+
+		std::vector<PakEntry> m_Entries;
+	};
+}
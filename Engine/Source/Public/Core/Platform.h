@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstddef>
 #include <string>
 
 namespace Nightbird::Input
@@ -28,6 +29,9 @@ namespace Nightbird::Core
 
 		virtual std::string GetCookedAssetsPath() const = 0;
 
+		// Bytes the asset cache may hold before evicting unused assets, 0 for no limit
+		virtual size_t GetAssetMemoryBudget() const { return 0; }
+
 		virtual Input::Provider& GetInputProvider() = 0;
 		virtual Audio::Provider& GetAudioProvider() = 0;
 	};
@@ -16,3 +16,9 @@ namespace Nightbird::Core
 		float m_Radius = 10.0f;
 	};
 }
+
+NB_STATIC_FIELDS(Nightbird::Core::PointLight, Nightbird::Core::SpatialObject,
+	NB_STATIC_FIELD(m_Color),
+	NB_STATIC_FIELD(m_Intensity),
+	NB_STATIC_FIELD(m_Radius)
+)
@@ -9,9 +9,11 @@ namespace Nightbird::Core
 		uuids::uuid mainSceneUUID;
 	};
 
+	class BinaryReader;
+
 	class ProjectLoader
 	{
 	public:
-		ProjectInfo Load(const std::string& cookedDir);
+		ProjectInfo Load(BinaryReader& reader);
 	};
 }
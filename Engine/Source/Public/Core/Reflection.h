@@ -70,6 +70,15 @@
 		}()); \
 	}
 
+#define NB_TYPE_FLAG(Type, Flag) \
+	namespace NB_CONCAT(NB_Reflection, Type) \
+	{ \
+		static const bool NB_CONCAT(_nb_flag_apply, __LINE__) = ([]() { \
+			Type::s_TypeInfo.flags |= static_cast<uint32_t>(Flag); \
+			return true; \
+		}()); \
+	}
+
 #define NB_FIELD(Name) \
 	{ \
 		#Name, \
@@ -0,0 +1,73 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <vector>
+
+namespace Nightbird::Core
+{
+	// Bounded lock-free ring for exactly one producer thread and one consumer thread.
+	// Push and Pop never block or allocate, Push fails when the ring is full.
+	template<typename T>
+	class SPSCQueue
+	{
+	public:
+		// capacity is rounded up to a power of two
+		explicit SPSCQueue(size_t capacity)
+		{
+			size_t size = 1;
+			while (size < capacity)
+				size <<= 1;
+
+			m_Items.resize(size);
+			m_Mask = size - 1;
+		}
+
+		SPSCQueue(const SPSCQueue&) = delete;
+		SPSCQueue& operator=(const SPSCQueue&) = delete;
+
+		// Producer thread
+		bool Push(const T& item)
+		{
+			size_t tail = m_Tail.load(std::memory_order_relaxed);
+			if (tail - m_CachedHead > m_Mask)
+			{
+				m_CachedHead = m_Head.load(std::memory_order_acquire);
+				if (tail - m_CachedHead > m_Mask)
+					return false;
+			}
+
+			m_Items[tail & m_Mask] = item;
+			m_Tail.store(tail + 1, std::memory_order_release);
+			return true;
+		}
+
+		// Consumer thread
+		bool Pop(T& outItem)
+		{
+			size_t head = m_Head.load(std::memory_order_relaxed);
+			if (head == m_CachedTail)
+			{
+				m_CachedTail = m_Tail.load(std::memory_order_acquire);
+				if (head == m_CachedTail)
+					return false;
+			}
+
+			outItem = m_Items[head & m_Mask];
+			m_Head.store(head + 1, std::memory_order_release);
+			return true;
+		}
+
+	private:
+		static constexpr size_t CacheLine = 64;
+
+		std::vector<T> m_Items;
+		size_t m_Mask = 0;
+
+		// Each side keeps a stale copy of the other's index and only reloads it when the ring looks full or empty
+		alignas(CacheLine) std::atomic<size_t> m_Head = 0;
+		size_t m_CachedTail = 0;
+		alignas(CacheLine) std::atomic<size_t> m_Tail = 0;
+		size_t m_CachedHead = 0;
+	};
+}
@@ -4,6 +4,9 @@
 #include "Core/DirectionalLight.h"
 #include "Core/PointLight.h"
 #include "Core/Skybox.h"
+#include "Core/SpatialAudio.h"
+#include "Core/TransformStore.h"
+#include "Core/SceneObject.h"
 
 #include <memory>
 #include <vector>
@@ -14,6 +17,7 @@ namespace Nightbird::Core
 	class MeshInstance;
 	class SceneObject;
 	class Camera;
+	class JobSystem;
 
 	class Scene
 	{
@@ -22,35 +26,83 @@ namespace Nightbird::Core
 
 		void Update(float delta);
 
+		// Ticks objects whose type has TypeFlags::ThreadSafeTick on the engine's job system
+		bool GetParallelUpdate() const;
+		void SetParallelUpdate(bool parallelUpdate);
+
+		// Called by SceneObject when it starts or stops ticking in this scene, never during parallel ticks
+		void AddTick(SceneObject* object);
+		void RemoveTick(SceneObject* object);
+
 		Engine* GetEngine() const;
 		void SetEngine(Engine* engine);
 
 		SceneObject* GetRoot();
 
+		TransformStore& GetTransformStore();
+
 		Camera* GetActiveCamera() const;
 		void SetActiveCamera(Camera* camera);
 
 		void ResolveAssets(AssetManager& assetManager);
 
-		std::vector<Renderable> CollectRenderables() const;
-		std::vector<DirectionalLight*> CollectDirectionalLights() const;
-		std::vector<PointLight*> CollectPointLights() const;
-		const Skybox* FindSkybox() const;
+		// Called by SceneObject::SetScene when an object enters or leaves this scene
+		void RegisterObject(SceneObject* object);
+		void UnregisterObject(SceneObject* object);
+
+		// Forces the renderables to be rebuilt on the next Update, e.g. after a mesh is assigned
+		void MarkRenderablesDirty();
+
+		const std::vector<Renderable>& GetRenderables() const;
+		const std::vector<DirectionalLight*>& GetDirectionalLights() const;
+		const std::vector<PointLight*>& GetPointLights() const;
+		const Skybox* GetSkybox() const;
 
 	private:
 		Engine* m_Engine = nullptr;
 
+		// Declared before m_Root so it outlives the objects holding handles into it
+		TransformStore m_TransformStore;
+
 		std::unique_ptr<SceneObject> m_Root;
 
 		Camera* m_ActiveCamera = nullptr;
 
+		// Ticking objects grouped by exact type, so each list runs the same Tick implementation.
+		// Removed entries are nulled and compacted after the tick pass.
+		struct TickList
+		{
+			const TypeInfo* type = nullptr;
+			std::vector<SceneObject*> objects;
+			bool hasRemoved = false;
+		};
+
+		std::vector<TickList> m_TickLists[static_cast<size_t>(TickGroup::Count)];
+		bool m_ParallelUpdate = true;
+		// Set while ParallelFor runs ticks, the tick lists and transform store must not change structurally
+		bool m_InParallelTick = false;
+
+		// Maintained incrementally as objects enter and leave the scene
+		std::vector<MeshInstance*> m_MeshInstances;
+		std::vector<DirectionalLight*> m_DirectionalLights;
+		std::vector<PointLight*> m_PointLights;
+		std::vector<Skybox*> m_Skyboxes;
+
+		SpatialAudio m_SpatialAudio;
+
+		std::vector<Renderable> m_Renderables;
+		// Transform handle -> range of m_Renderables, used to patch only moved instances
+		std::vector<uint32_t> m_RenderableFirst;
+		std::vector<uint32_t> m_RenderableCount;
+		bool m_RenderablesDirty = false;
+
+		void PreloadAssetsRecursive(SceneObject* object, AssetManager& assetManager);
 		void ResolveAssetsRecursive(SceneObject* object, AssetManager& assetManager);
 
-		void UpdateRecursive(SceneObject* object, float delta);
+		void UpdateTickGroup(TickGroup group, JobSystem* jobSystem, float delta);
+		void CompactTickLists();
 
-		void CollectRenderablesRecursive(SceneObject* object, std::vector<Renderable>& renderables) const;
-		void CollectDirectionalLightsRecursive(SceneObject* object, std::vector<DirectionalLight*>& directionalLights) const;
-		void CollectPointLightsRecursive(SceneObject* object, std::vector<PointLight*>& pointLights) const;
-		const Skybox* FindSkyboxRecursive(const SceneObject* object) const;
+		void SyncRenderables();
+		void RebuildRenderables();
 	};
 }
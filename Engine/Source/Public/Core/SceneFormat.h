@@ -0,0 +1,24 @@
+#pragma once
+
+#include <cstdint>
+
+namespace Nightbird::Core
+{
+	// .nbscene version 2 layout, in the target's byte order:
+	// "SCNE", version, string table (count, then length-prefixed strings), scene name string index,
+	// scene UUID, active camera node index, type table (count, then per type its name string index,
+	// field count and each field's path hash and kind), node table (count, then per node its type index,
+	// parent index and flags, followed by the source scene UUID if flagged), then one section per type
+	// holding the packed field values of that type's nodes in node order, laid out as by FieldLayout.
+	// Nodes are stored parent-first, a parent index of InvalidIndex places the node under the root.
+	namespace SceneFormat
+	{
+		constexpr uint32_t Version = 2;
+		constexpr uint32_t InvalidIndex = 0xFFFFFFFF;
+
+		enum NodeFlags : uint8_t
+		{
+			HasSourceScene = 1 << 0
+		};
+	}
+}
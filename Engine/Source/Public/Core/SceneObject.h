@@ -1,6 +1,7 @@
 #pragma once
 
 #include "Core/Reflection.h"
+#include "Core/StaticReflection.h"
 #include "Core/AssetManager.h"
 
 #include <uuid.h>
@@ -15,6 +16,15 @@ namespace Nightbird::Core
 	class Engine;
 	class Scene;
 
+	// Groups tick in this order, each after the previous one has finished
+	enum class TickGroup : uint8_t
+	{
+		Early,
+		Default,
+		Late,
+		Count
+	};
+
 	class SceneObject
 	{
 	public:
@@ -28,6 +38,10 @@ namespace Nightbird::Core
 		SceneObject(SceneObject&&) = default;
 		SceneObject& operator=(SceneObject&&) = default;
 
+		// Pooled, see SlabAllocator. The virtual destructor makes delete pass the derived type's size.
+		static void* operator new(size_t size);
+		static void operator delete(void* pointer, size_t size);
+
 		const std::string& GetName() const;
 		void SetName(std::string name);
 
@@ -52,14 +66,51 @@ namespace Nightbird::Core
 		virtual void EnterScene();
 		virtual void Tick(float delta);
 
+		// Objects tick if they override Tick or call SetTickEnabled(true).
+		// An object that only has SceneObject::Tick drops out of the tick lists after its first tick,
+		// so overrides should not call the base implementation.
+		bool IsTickEnabled() const;
+		void SetTickEnabled(bool enabled);
+
+		TickGroup GetTickGroup() const;
+		void SetTickGroup(TickGroup group);
+
+		// Seconds between ticks, 0 ticks every frame. Tick receives the time elapsed since the last tick.
+		float GetTickInterval() const;
+		void SetTickInterval(float interval);
+
+		// Called by Scene, returns false once the object no longer needs to tick
+		bool RunTick(float delta);
+
 		// Public for reflection
 		std::string m_Name;
 
 	protected:
+		virtual void OnSceneChanged(Scene* oldScene) {}
+		virtual void OnParentChanged() {}
+
 		Scene* m_Scene = nullptr;
 		SceneObject* m_Parent = nullptr;
 		std::vector<std::unique_ptr<SceneObject>> m_Children;
 
 		std::optional<uuids::uuid> m_SourceSceneUUID;
+
+	private:
+		enum class TickMode : uint8_t
+		{
+			Auto,
+			Enabled,
+			Disabled
+		};
+
+		TickMode m_TickMode = TickMode::Auto;
+		TickGroup m_TickGroup = TickGroup::Default;
+		bool m_InTickList = false;
+		float m_TickInterval = 0.0f;
+		float m_TickElapsed = 0.0f;
 	};
 }
+
+NB_STATIC_FIELDS(Nightbird::Core::SceneObject, void,
+	NB_STATIC_FIELD(m_Name)
+)
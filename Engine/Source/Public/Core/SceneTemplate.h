@@ -0,0 +1,34 @@
+#pragma once
+
+#include "Core/SceneReadResult.h"
+#include "Core/TypeInfo.h"
+
+#include <uuid.h>
+
+#include <memory>
+
+namespace Nightbird::Core
+{
+	class SceneObject;
+	class Camera;
+
+	// Parsed scene kept in the asset cache so nested and spawned instances don't re-read the file.
+	// The template itself is never added to a scene, instances are reflection-driven deep copies.
+	class SceneTemplate
+	{
+	public:
+		explicit SceneTemplate(SceneReadResult scene);
+		~SceneTemplate();
+
+		const uuids::uuid& GetUUID() const;
+
+		// Assets of the copy are left unresolved, the same as a freshly read scene
+		SceneReadResult Instantiate() const;
+
+	private:
+		SceneReadResult m_Scene;
+
+		std::unique_ptr<SceneObject> CloneRecursive(const SceneObject* source, Camera*& activeCamera) const;
+		static void CopyFields(const uint8_t* source, uint8_t* destination, const TypeInfo* type);
+	};
+}
@@ -15,4 +15,8 @@ namespace Nightbird::Core
 
 		AssetRef<Cubemap> m_Cubemap;
 	};
-}
\ No newline at end of file
+}
+
+NB_STATIC_FIELDS(Nightbird::Core::Skybox, Nightbird::Core::SceneObject,
+	NB_STATIC_FIELD(m_Cubemap)
+)
\ No newline at end of file
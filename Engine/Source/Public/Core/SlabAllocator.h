@@ -0,0 +1,61 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace Nightbird::Core
+{
+	struct SlabChunk;
+
+	// Fixed-size pools for small, frequently created objects such as SceneObjects.
+	// Memory comes in aligned chunks, each chunk only serves one size class, so objects of the
+	// same type end up next to each other. Requests above MaxSize go to the regular heap.
+	class SlabAllocator
+	{
+	public:
+		static constexpr size_t MaxSize = 1024;
+
+		// Allocates from the current SceneArena if one is active on this thread
+		static void* Allocate(size_t size);
+		// size must match the size passed to Allocate
+		static void Free(void* pointer, size_t size);
+	};
+
+	// Bump allocator used while reading a scene so its objects are packed in load order.
+	// Freeing an arena object only decrements its chunk's live count, a chunk is released once
+	// the arena has moved past it and its last object is gone, so objects may outlive the arena.
+	class SceneArena
+	{
+	public:
+		SceneArena() = default;
+		~SceneArena();
+
+		SceneArena(const SceneArena&) = delete;
+		SceneArena& operator=(const SceneArena&) = delete;
+
+		// size must not exceed SlabAllocator::MaxSize
+		void* Allocate(size_t size);
+
+		static SceneArena* GetCurrent();
+
+		// Routes SlabAllocator allocations on this thread to the arena while alive
+		class Scope
+		{
+		public:
+			explicit Scope(SceneArena& arena);
+			~Scope();
+
+			Scope(const Scope&) = delete;
+			Scope& operator=(const Scope&) = delete;
+
+		private:
+			SceneArena* m_Previous = nullptr;
+		};
+
+	private:
+		SlabChunk* m_Chunk = nullptr;
+		size_t m_Offset = 0;
+
+		void Retire();
+	};
+}
@@ -0,0 +1,58 @@
+#pragma once
+
+#include "Audio/AudioProvider.h"
+#include "Audio/AudioHandle.h"
+
+#include <glm/glm.hpp>
+
+#include <cstdint>
+#include <vector>
+
+namespace Nightbird::Core
+{
+	class AudioSource;
+	class Camera;
+
+	// Positions a scene's spatial AudioSources relative to a listener camera.
+	// Each frame the playing sources are gathered into flat arrays, their gains and pitch are
+	// computed in one pass over them and the results go to the audio provider in a single call.
+	class SpatialAudio
+	{
+	public:
+		// World units per second, sets how strongly movement shifts the pitch
+		static constexpr float SpeedOfSound = 343.0f;
+		static constexpr float MinPitch = 0.5f;
+		static constexpr float MaxPitch = 2.0f;
+
+		// Called by Scene as sources enter and leave it
+		void Add(AudioSource* source);
+		void Remove(AudioSource* source);
+
+		// Runs after the scene's transforms are updated, does nothing without a listener
+		void Update(const Camera* listener, float delta, Audio::Provider& provider);
+
+	private:
+		// Registered sources and the world position each had last frame, for doppler
+		std::vector<AudioSource*> m_Sources;
+		std::vector<glm::vec3> m_PreviousPositions;
+		std::vector<uint8_t> m_HasPrevious;
+
+		const Camera* m_PreviousListener = nullptr;
+		glm::vec3 m_PreviousListenerPosition = glm::vec3(0.0f);
+
+		// Playing spatial sources of the current frame, positions relative to the listener
+		std::vector<Audio::Handle> m_Handles;
+		std::vector<glm::vec3> m_Offsets;
+		std::vector<glm::vec3> m_Velocities;
+		std::vector<float> m_MinDistances;
+		std::vector<float> m_MaxDistances;
+		std::vector<uint32_t> m_Attenuations;
+		std::vector<float> m_Rolloffs;
+		std::vector<float> m_DopplerFactors;
+
+		std::vector<Audio::SpatialParams> m_Params;
+
+		void Gather(const glm::vec3& listenerPosition, float delta);
+		void Compute(const glm::vec3& listenerRight, const glm::vec3& listenerVelocity);
+	};
+}
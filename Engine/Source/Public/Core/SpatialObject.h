@@ -2,6 +2,7 @@
 
 #include "Core/SceneObject.h"
 #include "Core/Transform.h"
+#include "Core/TransformStore.h"
 
 namespace Nightbird::Core
 {
@@ -11,11 +12,47 @@ namespace Nightbird::Core
 		NB_TYPE()
 
 		using SceneObject::SceneObject;
-		~SpatialObject() override = default;
+		~SpatialObject() override;
 
-		glm::mat4 GetLocalMatrix() const;
-		glm::mat4 GetWorldMatrix() const;
+		const Transform& GetTransform() const;
+		void SetTransform(const Transform& transform);
 
+		void SetPosition(const glm::vec3& position);
+		void SetRotation(const glm::quat& rotation);
+		void SetScale(const glm::vec3& scale);
+
+		const glm::mat4& GetLocalMatrix() const;
+		const glm::mat4& GetWorldMatrix() const;
+
+		TransformStore::Handle GetTransformHandle() const;
+
+		// Must be called after writing m_Transform directly
+		void MarkTransformDirty();
+
+		// Public for reflection
 		Transform m_Transform;
+
+	protected:
+		void OnSceneChanged(Scene* oldScene) override;
+		void OnParentChanged() override;
+
+	private:
+		// While in a Scene, matrices live in its TransformStore
+		TransformStore::Handle m_TransformHandle = TransformStore::InvalidHandle;
+
+		// Lazily cached matrices for objects outside a Scene
+		mutable glm::mat4 m_LocalMatrix = glm::mat4(1.0f);
+		mutable glm::mat4 m_WorldMatrix = glm::mat4(1.0f);
+		mutable bool m_LocalDirty = true;
+		mutable bool m_WorldDirty = true;
+
+		TransformStore* GetTransformStore() const;
+		TransformStore::Handle GetParentTransformHandle() const;
+
+		void MarkWorldDirty();
 	};
 }
+
+NB_STATIC_FIELDS(Nightbird::Core::SpatialObject, Nightbird::Core::SceneObject,
+	NB_STATIC_FIELD(m_Transform)
+)
@@ -0,0 +1,304 @@
+#pragma once
+
+#include "Core/TypeInfo.h"
+#include "Core/TypeRegistry.h"
+#include "Core/FieldLayout.h"
+#include "Core/ReflectionInternal.h"
+
+#include <uuid.h>
+
+#include <array>
+#include <cstddef>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+
+// Compile-time alternative to NB_REFLECT. The field list is declared next to the class with
+// NB_STATIC_FIELDS so other types can expand it, and NB_REFLECT_STATIC in the source file fills
+// in the runtime TypeInfo from it and attaches TypeOps with specialized field code.
+//
+// Parent is the reflected parent class or void. Nested object fields must be statically reflected as well.
+#define NB_STATIC_FIELDS(Type, ParentType, ...) \
+	template<> \
+	struct Nightbird::StaticReflection<Type> \
+	{ \
+		static constexpr bool IsReflected = true; \
+		using Parent = ParentType; \
+		using _NB_CurrentType = Type; \
+		static constexpr auto Fields = std::make_tuple(__VA_ARGS__); \
+	};
+
+#define NB_STATIC_FIELD(Name) \
+	::Nightbird::MakeStaticField(#Name, &_NB_CurrentType::Name)
+
+#define NB_REFLECT_STATIC(Type, Factory) \
+	::Nightbird::TypeInfo Type::s_TypeInfo = { \
+		#Type, \
+		::Nightbird::FNVHash(#Type), \
+		::Nightbird::Detail::GetStaticParentTypeInfo<Type>(), \
+		Factory, \
+		nullptr, \
+		0 \
+	}; \
+	namespace NB_CONCAT(NB_Reflection, Type) \
+	{ \
+		inline void _nb_ApplyReflection() \
+		{ \
+			const auto& fields = ::Nightbird::Detail::StaticFieldInfos<Type>::Fields; \
+			Type::s_TypeInfo.fields = fields.data(); \
+			Type::s_TypeInfo.fieldCount = static_cast<uint32_t>(fields.size()); \
+			Type::s_TypeInfo.ops = &::Nightbird::Detail::StaticTypeOps<Type>::Ops; \
+			::Nightbird::TypeRegistry::Register(&Type::s_TypeInfo); \
+		} \
+		static const bool _nb_registration_apply = ([]() { \
+			::Nightbird::RegisterReflectionApply(&_nb_ApplyReflection); \
+			return true; \
+		}()); \
+	}
+
+namespace Nightbird
+{
+	template<typename T>
+	struct StaticReflection
+	{
+		static constexpr bool IsReflected = false;
+	};
+
+	template<typename Class, typename Value>
+	struct StaticField
+	{
+		using ValueType = Value;
+
+		const char* name;
+		uint32_t nameHash;
+		Value Class::* member;
+	};
+
+	template<typename Class, typename Value>
+	constexpr StaticField<Class, Value> MakeStaticField(const char* name, Value Class::* member)
+	{
+		return { name, FNVHash(name), member };
+	}
+
+	namespace Detail
+	{
+		template<typename T>
+		constexpr const TypeInfo* GetStaticParentTypeInfo()
+		{
+			using Parent = typename StaticReflection<T>::Parent;
+			if constexpr (std::is_void_v<Parent>)
+				return nullptr;
+			else
+				return &Parent::s_TypeInfo;
+		}
+
+		// Calls fn(get, field) for the fields of T and its parents, parents first.
+		// get maps the object passed to the outermost call to the object holding the fields.
+		template<typename T, typename Get, typename Fn>
+		constexpr void ForEachStaticField(const Get& get, Fn&& fn)
+		{
+			static_assert(StaticReflection<T>::IsReflected, "Type is not statically reflected");
+
+			using Parent = typename StaticReflection<T>::Parent;
+			if constexpr (!std::is_void_v<Parent>)
+				ForEachStaticField<Parent>(get, fn);
+
+			std::apply([&](const auto&... fields) { (fn(get, fields), ...); }, StaticReflection<T>::Fields);
+		}
+
+		// Calls fn(get, pathHash, packedOffset) for every packable leaf field in FieldLayout order,
+		// where get maps the outermost object to the field
+		template<typename T, typename Get, typename Fn>
+		constexpr void ForEachPackedField(const Get& get, uint32_t parentHash, uint32_t& packedOffset, Fn&& fn)
+		{
+			ForEachStaticField<T>(get, [&](const auto& owner, const auto& field)
+			{
+				using Value = typename std::decay_t<decltype(field)>::ValueType;
+				constexpr FieldKind kind = DeduceFieldKind<Value>();
+
+				auto member = field.member;
+				auto getField = [owner, member](auto& object) -> auto& { return owner(object).*member; };
+				uint32_t pathHash = parentHash ? CombineFieldHash(parentHash, field.nameHash) : field.nameHash;
+
+				if constexpr (kind == FieldKind::Object)
+				{
+					ForEachPackedField<Value>(getField, pathHash, packedOffset, fn);
+				}
+				else if constexpr (GetPackedSize(kind) > 0)
+				{
+					fn(getField, pathHash, packedOffset);
+					packedOffset += GetPackedSize(kind);
+				}
+			});
+		}
+
+		inline constexpr auto GetSelf = [](auto& object) -> auto& { return object; };
+
+		template<typename T>
+		void Unpack(void* object, const uint8_t* blob, const std::string_view* strings, uint32_t stringCount)
+		{
+			T& target = *static_cast<T*>(object);
+			uint32_t packedOffset = 0;
+
+			ForEachPackedField<T>(GetSelf, 0, packedOffset, [&](const auto& get, uint32_t, uint32_t offset)
+			{
+				auto& value = get(target);
+				using Value = std::decay_t<decltype(value)>;
+				const uint8_t* data = blob + offset;
+
+				if constexpr (std::is_same_v<Value, bool>)
+				{
+					value = data[0] != 0;
+				}
+				else if constexpr (std::is_same_v<Value, std::string>)
+				{
+					uint32_t index;
+					std::memcpy(&index, data, sizeof(index));
+					value = index < stringCount ? strings[index] : std::string_view();
+				}
+				else if constexpr (std::is_same_v<Value, uuids::uuid> || IsAssetRef<Value>::value)
+				{
+					std::array<uint8_t, 16> bytes;
+					std::memcpy(bytes.data(), data, 16);
+					if constexpr (IsAssetRef<Value>::value)
+						value.SetUUID(uuids::uuid(bytes));
+					else
+						value = uuids::uuid(bytes);
+				}
+				else
+				{
+					std::memcpy(&value, data, sizeof(Value));
+				}
+			});
+		}
+
+		template<typename T>
+		void Pack(const void* object, uint8_t* blob, TypeOps::StringIndexFn stringIndex, void* context)
+		{
+			const T& source = *static_cast<const T*>(object);
+			uint32_t packedOffset = 0;
+
+			ForEachPackedField<T>(GetSelf, 0, packedOffset, [&](const auto& get, uint32_t, uint32_t offset)
+			{
+				const auto& value = get(source);
+				using Value = std::decay_t<decltype(value)>;
+				uint8_t* data = blob + offset;
+
+				if constexpr (std::is_same_v<Value, bool>)
+				{
+					data[0] = value ? 1 : 0;
+				}
+				else if constexpr (std::is_same_v<Value, std::string>)
+				{
+					uint32_t index = stringIndex(context, value);
+					std::memcpy(data, &index, sizeof(index));
+				}
+				else if constexpr (std::is_same_v<Value, uuids::uuid> || IsAssetRef<Value>::value)
+				{
+					if constexpr (IsAssetRef<Value>::value)
+						std::memcpy(data, value.GetUUID().as_bytes().data(), 16);
+					else
+						std::memcpy(data, value.as_bytes().data(), 16);
+				}
+				else
+				{
+					std::memcpy(data, &value, sizeof(Value));
+				}
+			});
+		}
+
+		template<typename T>
+		void CopyFields(const T& source, T& destination)
+		{
+			ForEachStaticField<T>(GetSelf, [&](const auto&, const auto& field)
+			{
+				using Value = typename std::decay_t<decltype(field)>::ValueType;
+				const Value& from = source.*field.member;
+				Value& to = destination.*field.member;
+
+				// Only the UUID of asset references, the asset is resolved after instantiating
+				if constexpr (IsAssetRef<Value>::value)
+					to.SetUUID(from.GetUUID());
+				else if constexpr (DeduceFieldKind<Value>() == FieldKind::Object)
+					CopyFields<Value>(from, to);
+				else
+					to = from;
+			});
+		}
+
+		template<typename T>
+		bool FieldsEqual(const T& a, const T& b)
+		{
+			bool equal = true;
+			ForEachStaticField<T>(GetSelf, [&](const auto&, const auto& field)
+			{
+				using Value = typename std::decay_t<decltype(field)>::ValueType;
+				const Value& first = a.*field.member;
+				const Value& second = b.*field.member;
+
+				if constexpr (IsAssetRef<Value>::value)
+					equal = equal && first.GetUUID() == second.GetUUID();
+				else if constexpr (DeduceFieldKind<Value>() == FieldKind::Object)
+					equal = equal && FieldsEqual<Value>(first, second);
+				else
+					equal = equal && first == second;
+			});
+			return equal;
+		}
+
+		template<typename T>
+		uint32_t ComputeStaticFingerprint()
+		{
+			uint32_t fingerprint = FNVHash("");
+			uint32_t packedOffset = 0;
+
+			ForEachPackedField<T>(GetSelf, 0, packedOffset, [&](const auto& get, uint32_t pathHash, uint32_t)
+			{
+				using Value = std::decay_t<decltype(get(std::declval<T&>()))>;
+				fingerprint = HashPackedField(fingerprint, pathHash, DeduceFieldKind<Value>());
+			});
+			return fingerprint;
+		}
+
+		template<typename T>
+		struct StaticTypeOps
+		{
+			static inline const TypeOps Ops = {
+				&Unpack<T>,
+				&Pack<T>,
+				[](const void* source, void* destination) { CopyFields<T>(*static_cast<const T*>(source), *static_cast<T*>(destination)); },
+				[](const void* a, const void* b) { return FieldsEqual<T>(*static_cast<const T*>(a), *static_cast<const T*>(b)); },
+				ComputeStaticFingerprint<T>()
+			};
+		};
+
+		// offsetof isn't valid for the non standard layout scene types and warns in every file including the
+		// field list, so the offset comes from the member pointer. Only runs where NB_REFLECT_STATIC is expanded.
+		template<typename Class, typename Value>
+		uint32_t GetMemberOffset(Value Class::* member)
+		{
+			alignas(Class) unsigned char storage[sizeof(Class)];
+			const Class* object = reinterpret_cast<const Class*>(storage);
+			return static_cast<uint32_t>(reinterpret_cast<const unsigned char*>(&(object->*member)) - storage);
+		}
+
+		// Runtime FieldInfo array for the Inspector and the generic readers
+		template<typename T>
+		struct StaticFieldInfos
+		{
+			static inline const auto Fields = std::apply([](const auto&... fields)
+			{
+				return std::array<FieldInfo, sizeof...(fields)>{ FieldInfo{
+					fields.name,
+					fields.nameHash,
+					GetFieldTypeInfo<typename std::decay_t<decltype(fields)>::ValueType>(),
+					DeduceFieldKind<typename std::decay_t<decltype(fields)>::ValueType>(),
+					GetMemberOffset(fields.member),
+					static_cast<uint32_t>(sizeof(typename std::decay_t<decltype(fields)>::ValueType))
+				}... };
+			}, StaticReflection<T>::Fields);
+		};
+	}
+}
@@ -1,7 +1,8 @@
 #pragma once
 
+#include "Core/AssetBuffer.h"
+
 #include <cstdint>
-#include <vector>
 
 namespace Nightbird::Core
 {
@@ -14,19 +15,19 @@ namespace Nightbird::Core
 	class Texture
 	{
 	public:
-		Texture(uint32_t width, uint32_t height, TextureFormat format, std::vector<uint8_t> data);
+		Texture(uint32_t width, uint32_t height, TextureFormat format, AssetBuffer<uint8_t> data);
 
 		uint32_t GetWidth() const;
 		uint32_t GetHeight() const;
 
 		TextureFormat GetFormat() const;
-		const std::vector<uint8_t>& GetData() const;
+		const AssetBuffer<uint8_t>& GetData() const;
 
 	private:
 		uint32_t m_Width;
 		uint32_t m_Height;
 
 		TextureFormat m_Format;
-		std::vector<uint8_t> m_Data;
+		AssetBuffer<uint8_t> m_Data;
 	};
 }
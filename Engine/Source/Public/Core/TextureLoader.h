@@ -8,10 +8,11 @@
 namespace Nightbird::Core
 {
 	class Texture;
+	class BinaryReader;
 
 	class TextureLoader
 	{
 	public:
-		std::shared_ptr<Texture> Load(const std::string& cookedDir, const uuids::uuid& uuid);
+		std::shared_ptr<Texture> Load(BinaryReader& reader, const uuids::uuid& uuid);
 	};
 }
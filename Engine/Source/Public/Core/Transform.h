@@ -1,6 +1,7 @@
 #pragma once
 
 #include "Core/Reflection.h"
+#include "Core/StaticReflection.h"
 
 #include <glm/glm.hpp>
 #include <glm/gtc/quaternion.hpp>
@@ -18,3 +19,9 @@ namespace Nightbird::Core
 		glm::vec3 scale = glm::vec3(1.0f);
 	};
 }
+
+NB_STATIC_FIELDS(Nightbird::Core::Transform, void,
+	NB_STATIC_FIELD(position),
+	NB_STATIC_FIELD(rotation),
+	NB_STATIC_FIELD(scale)
+)
@@ -0,0 +1,73 @@
+#pragma once
+
+#include "Core/Transform.h"
+
+#include <glm/glm.hpp>
+#include <glm/gtc/quaternion.hpp>
+
+#include <atomic>
+#include <vector>
+#include <cstdint>
+
+namespace Nightbird::Core
+{
+	// Structure-of-arrays storage for a scene's transforms.
+	// Nodes are addressed by stable handles; the dense arrays are kept sorted so every parent
+	// comes before its children, letting Update() resolve all dirty world matrices in one linear pass.
+	class TransformStore
+	{
+	public:
+		using Handle = uint32_t;
+		static constexpr Handle InvalidHandle = UINT32_MAX;
+
+		Handle Allocate();
+		void Release(Handle handle);
+
+		void SetParent(Handle handle, Handle parent);
+		void SetLocal(Handle handle, const Transform& transform);
+
+		const glm::mat4& GetLocalMatrix(Handle handle);
+		const glm::mat4& GetWorldMatrix(Handle handle);
+
+		void Update();
+
+		// Set by Scene around parallel ticks, after flushing an Update. While deferred, queries skip the lazy
+		// Update and return the matrices of the last one, and SetLocal only writes the node's own slot, so
+		// threads moving different nodes don't race. Allocate, Release and SetParent are not allowed.
+		void SetDeferred(bool deferred);
+		bool IsDeferred() const;
+
+		// Handles whose world matrix was recomputed since the last ClearChanged()
+		const std::vector<Handle>& GetChanged() const;
+		void ClearChanged();
+
+		size_t GetCount() const;
+
+	private:
+		static constexpr uint32_t InvalidIndex = UINT32_MAX;
+
+		// Handle -> dense index
+		std::vector<uint32_t> m_Indices;
+		std::vector<Handle> m_FreeHandles;
+
+		// Dense, parent-first
+		std::vector<Handle> m_Handles;
+		std::vector<Handle> m_ParentHandles;
+		std::vector<uint32_t> m_Parents;
+		std::vector<glm::vec3> m_Positions;
+		std::vector<glm::quat> m_Rotations;
+		std::vector<glm::vec3> m_Scales;
+		std::vector<uint8_t> m_Dirty;
+		std::vector<glm::mat4> m_LocalMatrices;
+		std::vector<glm::mat4> m_WorldMatrices;
+
+		std::vector<Handle> m_Changed;
+
+		// Atomic so deferred SetLocal calls on different handles can run concurrently
+		std::atomic<bool> m_AnyDirty = false;
+		bool m_OrderDirty = false;
+		bool m_Deferred = false;
+
+		void Reorder();
+	};
+}
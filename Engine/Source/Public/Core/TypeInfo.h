@@ -7,6 +7,8 @@ namespace Nightbird
 {
 	struct TypeInfo;
 	struct FieldInfo;
+	class FieldLayout;
+	struct TypeOps;
 
 	// FNV-1a hash
 	constexpr uint32_t FNVHash(std::string_view s) noexcept
@@ -17,6 +19,16 @@ namespace Nightbird
 		return h;
 	}
 	
+	enum class TypeFlags : uint32_t
+	{
+		None = 0,
+		// Tick may run on a worker thread, concurrently with other ThreadSafeTick objects. It may only write the
+		// object's own state, including its own transform through SetPosition and friends. Transform queries
+		// return the matrices as of the start of the parallel pass. It must not add, remove, reparent or destroy
+		// objects, change any object's tick settings, or call into the audio provider or other engine services.
+		ThreadSafeTick = 1 << 0
+	};
+
 	struct TypeInfo
 	{
 		const char* name = nullptr;
@@ -30,8 +42,30 @@ namespace Nightbird
 		const FieldInfo* fields = nullptr;
 		uint32_t fieldCount = 0;
 
+		// Not inherited, a subclass has to opt in again
+		uint32_t flags = 0;
+
+		// Pre-order range of this type and its descendants, assigned by TypeRegistry::BuildHierarchy.
+		// 0 until assigned, IsA then falls back to walking the parent chain.
+		uint32_t hierarchyBegin = 0;
+		uint32_t hierarchyEnd = 0;
+
+		// Flattened fields including inherited ones, assigned by TypeRegistry::BuildHierarchy
+		const FieldLayout* layout = nullptr;
+
+		// Field code generated at compile time by NB_REFLECT_STATIC, nullptr for NB_REFLECT types
+		const TypeOps* ops = nullptr;
+
+		bool HasFlag(TypeFlags flag) const noexcept
+		{
+			return (flags & static_cast<uint32_t>(flag)) != 0;
+		}
+
 		bool IsA(const TypeInfo* other) const noexcept
 		{
+			if (hierarchyBegin != 0 && other->hierarchyBegin != 0)
+				return other->hierarchyBegin <= hierarchyBegin && hierarchyBegin < other->hierarchyEnd;
+
 			for (auto* current = this; current; current = current->parent)
 			{
 				if (current->nameHash == other->nameHash)
@@ -76,6 +110,21 @@ namespace Nightbird
 		Unknown
 	};
 
+	// Specialized field functions of a statically reflected type. Packed blobs follow the type's
+	// FieldLayout in host byte order, strings are stored as string table indices.
+	struct TypeOps
+	{
+		using StringIndexFn = uint32_t(*)(void* context, std::string_view string);
+
+		void (*unpack)(void* object, const uint8_t* blob, const std::string_view* strings, uint32_t stringCount) = nullptr;
+		void (*pack)(const void* object, uint8_t* blob, StringIndexFn stringIndex, void* context) = nullptr;
+		void (*copy)(const void* source, void* destination) = nullptr;
+		bool (*equals)(const void* a, const void* b) = nullptr;
+
+		// Of the generated packed layout, TypeRegistry drops the ops if it differs from the FieldLayout
+		uint32_t fingerprint = 0;
+	};
+
 	struct FieldInfo
 	{
 		const char* name = nullptr;
@@ -20,6 +20,10 @@ namespace Nightbird
 
 		static void Register(TypeInfo* type) noexcept;
 
+		// Assigns the hierarchy ranges used by TypeInfo::IsA and builds missing field layouts.
+		// Called by InitReflection, must be called again after registering types later on.
+		static void BuildHierarchy() noexcept;
+
 		static const TypeInfo* Find(std::string_view name) noexcept;
 		static const TypeInfo* Find(uint32_t hash) noexcept;
 
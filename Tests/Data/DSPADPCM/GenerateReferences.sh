@@ -0,0 +1,16 @@
+#!/bin/bash
+# Regenerates the VGAudio reference files DSPADPCMEncoderTests compares against, with the same
+# command the cooker ran before the encoder was built in. Run from this directory.
+
+VGAUDIO="${NIGHTBIRD_PATH:-../../..}/Tools/VGAudioCli/VGAudioCli.dll"
+
+if [ ! -f "$VGAUDIO" ]; then
+	echo "VGAudioCli not found at $VGAUDIO."
+	exit 1
+fi
+
+for name in Chirp Tone Short13 Short14 Short15 Short27 Short28 Short29; do
+	dotnet "$VGAUDIO" -i:0 $name.wav -o $name.dsp || exit 1
+done
+
+echo "References written."
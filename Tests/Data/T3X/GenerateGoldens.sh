@@ -0,0 +1,17 @@
+#!/bin/bash
+# Regenerates the tex3ds reference files T3XEncoderTests compares against.
+# Needs tex3ds from devkitPro. Run from this directory.
+
+if ! command -v tex3ds > /dev/null; then
+	echo "tex3ds not found, install it with devkitPro's 3ds-dev group."
+	exit 1
+fi
+
+for source in Gradient Pattern; do
+	for format in rgba5551 rgb565 etc1; do
+		tex3ds -f $format -z lz11 -o ${source}_${format}.t3x $source.png || exit 1
+		tex3ds -f $format -z lz11 -m box -o ${source}_${format}_mips.t3x $source.png || exit 1
+	done
+done
+
+echo "Goldens written."
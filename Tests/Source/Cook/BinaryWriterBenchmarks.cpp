@@ -0,0 +1,147 @@
+#include "Test.h"
+
+#include "Cook/BinaryWriter.h"
+#include "Core/BinaryReader.h"
+
+#include <algorithm>
+#include <bit>
+#include <cstring>
+#include <filesystem>
+#include <span>
+#include <vector>
+
+using namespace Nightbird;
+
+static constexpr size_t ElementCount = 16 * 1024 * 1024;
+static constexpr uint32_t Passes = 4;
+
+static double GetMegabytesPerSecond(size_t bytes, double milliseconds)
+{
+	return bytes / (1024.0 * 1024.0) / (milliseconds / 1000.0);
+}
+
+static Endianness GetSwappedEndianness()
+{
+	return std::endian::native == std::endian::little ? Endianness::Big : Endianness::Little;
+}
+
+static Endianness GetNativeEndianness()
+{
+	return std::endian::native == std::endian::little ? Endianness::Little : Endianness::Big;
+}
+
+template<typename T>
+static void BenchmarkWrite(const char* typeName, const std::vector<T>& values, const std::filesystem::path& path)
+{
+	const size_t bytes = values.size() * sizeof(T) * Passes;
+
+	for (Endianness endianness : { GetNativeEndianness(), GetSwappedEndianness() })
+	{
+		const std::string suffix = std::string(typeName) + (endianness == GetNativeEndianness() ? ", native" : ", swapped");
+
+		{
+			Editor::BinaryWriter writer(path, endianness);
+			Tests::Stopwatch stopwatch;
+			for (uint32_t pass = 0; pass < Passes; ++pass)
+			{
+				for (T value : values)
+				{
+					if constexpr (std::is_same_v<T, float>)
+						writer.WriteFloat(value);
+					else
+						writer.WriteUInt16(value);
+				}
+			}
+			writer.Flush();
+			Tests::ReportResult("Per element write, " + suffix, GetMegabytesPerSecond(bytes, stopwatch.GetMilliseconds()), "MB/s");
+		}
+
+		{
+			Editor::BinaryWriter writer(path, endianness);
+			Tests::Stopwatch stopwatch;
+			for (uint32_t pass = 0; pass < Passes; ++pass)
+				writer.WriteSpan(std::span<const T>(values));
+			writer.Flush();
+			Tests::ReportResult("WriteSpan, " + suffix, GetMegabytesPerSecond(bytes, stopwatch.GetMilliseconds()), "MB/s");
+		}
+
+		// The file holds the last pass, so reading it back checks the bytes as well
+		Core::BinaryReader reader(path.string());
+		std::vector<T> readBack(values.size());
+		reader.ReadSpan(std::span<T>(readBack));
+		NB_CHECK(reader.IsValid());
+
+		std::vector<T> expected = values;
+		if (endianness != GetNativeEndianness())
+		{
+			for (T& value : expected)
+			{
+				uint8_t* bytes = reinterpret_cast<uint8_t*>(&value);
+				std::reverse(bytes, bytes + sizeof(T));
+			}
+		}
+		NB_CHECK(std::memcmp(readBack.data(), expected.data(), values.size() * sizeof(T)) == 0);
+	}
+}
+
+template<typename T>
+static void BenchmarkRead(const char* typeName, const std::vector<T>& values, const std::filesystem::path& path)
+{
+	{
+		Editor::BinaryWriter writer(path, GetNativeEndianness());
+		for (uint32_t pass = 0; pass < Passes; ++pass)
+			writer.WriteSpan(std::span<const T>(values));
+	}
+
+	// Files are cooked in the target's byte order, the runtime only ever reads native data
+	const size_t bytes = values.size() * sizeof(T) * Passes;
+	std::vector<T> destination(values.size());
+
+	{
+		Core::BinaryReader reader(path.string());
+		Tests::Stopwatch stopwatch;
+		for (uint32_t pass = 0; pass < Passes; ++pass)
+		{
+			for (T& value : destination)
+			{
+				if constexpr (std::is_same_v<T, float>)
+					value = reader.ReadFloat();
+				else
+					value = reader.ReadUInt16();
+			}
+		}
+		Tests::ReportResult("Per element read, " + std::string(typeName), GetMegabytesPerSecond(bytes, stopwatch.GetMilliseconds()), "MB/s");
+		NB_CHECK(reader.IsValid());
+	}
+
+	{
+		Core::BinaryReader reader(path.string());
+		Tests::Stopwatch stopwatch;
+		for (uint32_t pass = 0; pass < Passes; ++pass)
+			reader.ReadSpan(std::span<T>(destination));
+		Tests::ReportResult("ReadSpan, " + std::string(typeName), GetMegabytesPerSecond(bytes, stopwatch.GetMilliseconds()), "MB/s");
+		NB_CHECK(reader.IsValid());
+	}
+
+	NB_CHECK(destination == values);
+}
+
+NB_BENCHMARK(BinaryWriter_SpanThroughput)
+{
+	std::vector<uint16_t> indices(ElementCount);
+	std::vector<float> floats(ElementCount);
+	for (size_t i = 0; i < ElementCount; ++i)
+	{
+		indices[i] = static_cast<uint16_t>(i * 2654435761u >> 16);
+		floats[i] = static_cast<float>(i) * 0.25f - 1000.0f;
+	}
+
+	const std::filesystem::path path = std::filesystem::temp_directory_path() / "NightbirdBinaryWriterBenchmark.bin";
+
+	BenchmarkWrite("uint16", indices, path);
+	BenchmarkWrite("float", floats, path);
+	BenchmarkRead("uint16", indices, path);
+	BenchmarkRead("float", floats, path);
+
+	std::filesystem::remove(path);
+}
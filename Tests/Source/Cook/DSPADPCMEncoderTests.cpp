@@ -0,0 +1,180 @@
+#include "Test.h"
+
+#include "Cook/DSPADPCMEncoder.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+using namespace Nightbird;
+
+static constexpr size_t HeaderSize = 0x60;
+
+// Reference clips and their VGAudio encodings, see Tests/Data/DSPADPCM/GenerateReferences.sh.
+// The short ones sit around the 14 sample frame boundary.
+static const char* s_Clips[] = { "Chirp", "Tone", "Short13", "Short14", "Short15", "Short27", "Short28", "Short29" };
+
+static std::vector<uint8_t> ReadFile(const std::filesystem::path& path)
+{
+	std::ifstream file(path, std::ios::binary);
+	return std::vector<uint8_t>(std::istreambuf_iterator<char>(file), {});
+}
+
+static uint32_t ReadLE32(const uint8_t* data)
+{
+	return data[0] | (data[1] << 8) | (data[2] << 16) | (static_cast<uint32_t>(data[3]) << 24);
+}
+
+static uint32_t ReadBE16(const uint8_t* data)
+{
+	return (data[0] << 8) | data[1];
+}
+
+static uint32_t ReadBE32(const uint8_t* data)
+{
+	return (static_cast<uint32_t>(data[0]) << 24) | (data[1] << 16) | (data[2] << 8) | data[3];
+}
+
+// Mono 16-bit PCM WAV, false for anything else
+static bool ReadWave(const std::vector<uint8_t>& file, std::vector<int16_t>& samples, uint32_t& sampleRate)
+{
+	if (file.size() < 12 || std::memcmp(file.data(), "RIFF", 4) != 0 || std::memcmp(file.data() + 8, "WAVE", 4) != 0)
+		return false;
+
+	bool format = false;
+	for (size_t position = 12; position + 8 <= file.size();)
+	{
+		const uint8_t* chunk = file.data() + position;
+		uint32_t size = ReadLE32(chunk + 4);
+		if (position + 8 + size > file.size())
+			return false;
+
+		if (std::memcmp(chunk, "fmt ", 4) == 0 && size >= 16)
+		{
+			uint32_t channels = chunk[10] | (chunk[11] << 8);
+			uint32_t bits = chunk[22] | (chunk[23] << 8);
+			sampleRate = ReadLE32(chunk + 12);
+			format = channels == 1 && bits == 16;
+		}
+		else if (std::memcmp(chunk, "data", 4) == 0)
+		{
+			samples.resize(size / 2);
+			std::memcpy(samples.data(), chunk + 8, samples.size() * 2);
+			return format;
+		}
+
+		position += 8 + size + (size & 1);
+	}
+
+	return false;
+}
+
+// Decodes the channel the way the DSP does, from the header's coefficients and initial history
+static std::vector<int16_t> DecodeDSP(const std::vector<uint8_t>& dsp)
+{
+	uint32_t sampleCount = ReadBE32(dsp.data());
+	int coefficients[16];
+	for (int i = 0; i < 16; ++i)
+		coefficients[i] = static_cast<int16_t>(ReadBE16(dsp.data() + 0x1C + i * 2));
+
+	int history1 = static_cast<int16_t>(ReadBE16(dsp.data() + 0x40));
+	int history2 = static_cast<int16_t>(ReadBE16(dsp.data() + 0x42));
+
+	std::vector<int16_t> samples;
+	samples.reserve(sampleCount);
+
+	for (size_t frame = HeaderSize; samples.size() < sampleCount && frame < dsp.size(); frame += 8)
+	{
+		uint8_t header = dsp[frame];
+		int scale = 1 << (header & 0xF);
+		int coefficient1 = coefficients[(header >> 4) * 2];
+		int coefficient2 = coefficients[(header >> 4) * 2 + 1];
+
+		for (uint32_t i = 0; i < 14 && samples.size() < sampleCount; ++i)
+		{
+			size_t byte = frame + 1 + i / 2;
+			if (byte >= dsp.size())
+				break;
+
+			int nibble = i % 2 ? dsp[byte] & 0xF : dsp[byte] >> 4;
+			if (nibble >= 8)
+				nibble -= 16;
+
+			int sample = std::clamp((((nibble * scale) << 11) + 1024 + coefficient1 * history1 + coefficient2 * history2) >> 11, -32768, 32767);
+			samples.push_back(static_cast<int16_t>(sample));
+			history2 = history1;
+			history1 = sample;
+		}
+	}
+
+	return samples;
+}
+
+static uint32_t CountMismatches(const std::vector<uint8_t>& a, const std::vector<uint8_t>& b, size_t begin, size_t end)
+{
+	uint32_t mismatches = 0;
+	for (size_t i = begin; i < end; ++i)
+		mismatches += i >= a.size() || i >= b.size() || a[i] != b[i];
+	return mismatches;
+}
+
+NB_TEST(DSPADPCM_MatchesVGAudio)
+{
+	for (const char* clip : s_Clips)
+	{
+		std::vector<int16_t> samples;
+		uint32_t sampleRate = 0;
+		NB_CHECK(ReadWave(ReadFile(Tests::GetDataPath(std::string("DSPADPCM/") + clip + ".wav")), samples, sampleRate));
+
+		const std::vector<uint8_t> reference = ReadFile(Tests::GetDataPath(std::string("DSPADPCM/") + clip + ".dsp"));
+		NB_CHECK(reference.size() >= HeaderSize);
+		if (samples.empty() || reference.size() < HeaderSize)
+			continue;
+
+		const std::vector<uint8_t> encoded = Editor::EncodeDSPADPCM(samples.data(), static_cast<uint32_t>(samples.size()), 1, sampleRate);
+
+		// Counts, rate, loop region and format
+		NB_CHECK_EQUAL(CountMismatches(encoded, reference, 0x00, 0x1C), 0u);
+		NB_CHECK_EQUAL(CountMismatches(encoded, reference, 0x1C, 0x3C), 0u);
+		// Gain, initial predictor/scale and history
+		NB_CHECK_EQUAL(CountMismatches(encoded, reference, 0x3C, 0x44), 0u);
+		NB_CHECK_EQUAL(CountMismatches(encoded, reference, 0x44, 0x4A), 0u);
+
+		NB_CHECK_EQUAL(encoded.size(), reference.size());
+		NB_CHECK_EQUAL(CountMismatches(encoded, reference, HeaderSize, std::max(encoded.size(), reference.size())), 0u);
+	}
+}
+
+NB_TEST(DSPADPCM_DecodedSignalToNoise)
+{
+	for (const char* clip : { "Chirp", "Tone" })
+	{
+		std::vector<int16_t> samples;
+		uint32_t sampleRate = 0;
+		NB_CHECK(ReadWave(ReadFile(Tests::GetDataPath(std::string("DSPADPCM/") + clip + ".wav")), samples, sampleRate));
+		if (samples.empty())
+			continue;
+
+		const std::vector<int16_t> decoded = DecodeDSP(Editor::EncodeDSPADPCM(samples.data(), static_cast<uint32_t>(samples.size()), 1, sampleRate));
+		NB_CHECK_EQUAL(decoded.size(), samples.size());
+		if (decoded.size() != samples.size())
+			continue;
+
+		double signal = 0.0;
+		double noise = 0.0;
+		for (size_t i = 0; i < samples.size(); ++i)
+		{
+			double difference = static_cast<double>(samples[i]) - decoded[i];
+			signal += static_cast<double>(samples[i]) * samples[i];
+			noise += difference * difference;
+		}
+
+		double snr = noise > 0.0 ? 10.0 * std::log10(signal / noise) : 99.0;
+		Tests::ReportResult(std::string(clip) + " SNR", snr, "dB");
+		NB_CHECK(snr > 30.0);
+	}
+}
@@ -0,0 +1,336 @@
+#include "Cook/T3XDecoder.h"
+
+#include <algorithm>
+
+namespace Nightbird::Tests
+{
+	static constexpr uint32_t HeaderSize = 17;
+
+	static constexpr uint8_t FormatRGBA8 = 0x0;
+	static constexpr uint8_t FormatRGB8 = 0x1;
+	static constexpr uint8_t FormatRGBA5551 = 0x2;
+	static constexpr uint8_t FormatRGB565 = 0x3;
+	static constexpr uint8_t FormatRGBA4 = 0x4;
+	static constexpr uint8_t FormatETC1 = 0xC;
+	static constexpr uint8_t FormatETC1A4 = 0xD;
+
+	// ETC1 intensity modifier tables, from the OES_compressed_ETC1_RGB8_texture specification
+	static const int s_ModifierTables[8][4] = {
+		{ 2, 8, -2, -8 }, { 5, 17, -5, -17 }, { 9, 29, -9, -29 }, { 13, 42, -13, -42 },
+		{ 18, 60, -18, -60 }, { 24, 80, -24, -80 }, { 33, 106, -33, -106 }, { 47, 183, -47, -183 }
+	};
+
+	static uint32_t ReadUInt16(const uint8_t* data)
+	{
+		return data[0] | (data[1] << 8);
+	}
+
+	static uint64_t ReadUInt64(const uint8_t* data)
+	{
+		uint64_t value = 0;
+		for (int i = 7; i >= 0; --i)
+			value = (value << 8) | data[i];
+		return value;
+	}
+
+	// The GPU widens channels by repeating their top bits
+	static uint8_t Expand(uint32_t value, uint32_t bits)
+	{
+		uint32_t result = value << (8 - bits);
+		for (uint32_t shift = bits; shift < 8; shift += bits)
+			result |= result >> shift;
+		return static_cast<uint8_t>(result);
+	}
+
+	static uint32_t GetBitsPerTexel(uint8_t format)
+	{
+		switch (format)
+		{
+		case FormatRGBA8: return 32;
+		case FormatRGB8: return 24;
+		case FormatRGBA5551:
+		case FormatRGB565:
+		case FormatRGBA4: return 16;
+		case FormatETC1: return 4;
+		case FormatETC1A4: return 8;
+		default: return 0;
+		}
+	}
+
+	static void DecodeTexel(const uint8_t* data, uint8_t format, uint8_t* pixel)
+	{
+		uint32_t value = ReadUInt16(data);
+		switch (format)
+		{
+		case FormatRGBA8:
+			pixel[0] = data[3];
+			pixel[1] = data[2];
+			pixel[2] = data[1];
+			pixel[3] = data[0];
+			break;
+		case FormatRGB8:
+			pixel[0] = data[2];
+			pixel[1] = data[1];
+			pixel[2] = data[0];
+			pixel[3] = 255;
+			break;
+		case FormatRGBA5551:
+			pixel[0] = Expand((value >> 11) & 0x1F, 5);
+			pixel[1] = Expand((value >> 6) & 0x1F, 5);
+			pixel[2] = Expand((value >> 1) & 0x1F, 5);
+			pixel[3] = (value & 1) ? 255 : 0;
+			break;
+		case FormatRGB565:
+			pixel[0] = Expand((value >> 11) & 0x1F, 5);
+			pixel[1] = Expand((value >> 5) & 0x3F, 6);
+			pixel[2] = Expand(value & 0x1F, 5);
+			pixel[3] = 255;
+			break;
+		case FormatRGBA4:
+			pixel[0] = Expand((value >> 12) & 0xF, 4);
+			pixel[1] = Expand((value >> 8) & 0xF, 4);
+			pixel[2] = Expand((value >> 4) & 0xF, 4);
+			pixel[3] = Expand(value & 0xF, 4);
+			break;
+		default:
+			break;
+		}
+	}
+
+	// Writes the 16 texels of a block, indexed x * 4 + y as the selector bits are
+	static void DecodeETC1Block(uint64_t block, uint8_t (&texels)[16][4])
+	{
+		uint32_t high = static_cast<uint32_t>(block >> 32);
+		uint32_t low = static_cast<uint32_t>(block);
+
+		bool flip = high & 1;
+		bool differential = high & 2;
+		uint32_t tables[2] = { (high >> 5) & 7, (high >> 2) & 7 };
+
+		int bases[2][3];
+		for (int channel = 0; channel < 3; ++channel)
+		{
+			if (differential)
+			{
+				int shift = 27 - channel * 8;
+				int first = (high >> shift) & 0x1F;
+				int delta = (high >> (shift - 3)) & 7;
+				int second = first + (delta >= 4 ? delta - 8 : delta);
+				bases[0][channel] = Expand(first, 5);
+				bases[1][channel] = Expand(second & 0x1F, 5);
+			}
+			else
+			{
+				int shift = 28 - channel * 8;
+				bases[0][channel] = Expand((high >> shift) & 0xF, 4);
+				bases[1][channel] = Expand((high >> (shift - 4)) & 0xF, 4);
+			}
+		}
+
+		for (uint32_t i = 0; i < 16; ++i)
+		{
+			uint32_t x = i / 4;
+			uint32_t y = i % 4;
+			uint32_t half = flip ? (y >= 2) : (x >= 2);
+
+			// Selector bits map 0, 1, 2, 3 to the small positive, large positive, small negative and large negative modifier
+			uint32_t selector = (((low >> (i + 16)) & 1) << 1) | ((low >> i) & 1);
+			int modifier = s_ModifierTables[tables[half]][selector];
+
+			for (int channel = 0; channel < 3; ++channel)
+				texels[i][channel] = static_cast<uint8_t>(std::clamp(bases[half][channel] + modifier, 0, 255));
+			texels[i][3] = 255;
+		}
+	}
+
+	// Morton order inside an 8x8 tile, x in the even bits and y in the odd ones
+	static void GetMortonPosition(uint32_t index, uint32_t& x, uint32_t& y)
+	{
+		x = y = 0;
+		for (uint32_t bit = 0; bit < 3; ++bit)
+		{
+			x |= ((index >> (bit * 2)) & 1) << bit;
+			y |= ((index >> (bit * 2 + 1)) & 1) << bit;
+		}
+	}
+
+	static void DecodeLevel(const uint8_t* data, uint32_t width, uint32_t height, uint8_t format, std::vector<uint8_t>& pixels)
+	{
+		pixels.assign(static_cast<size_t>(width) * height * 4, 0);
+
+		// Texture rows count from the bottom of the image
+		auto getPixel = [&](uint32_t x, uint32_t y) { return pixels.data() + (static_cast<size_t>(height - 1 - y) * width + x) * 4; };
+
+		const bool etc = format == FormatETC1 || format == FormatETC1A4;
+		const uint32_t texelBytes = GetBitsPerTexel(format) / 8;
+
+		for (uint32_t tileY = 0; tileY < height; tileY += 8)
+		{
+			for (uint32_t tileX = 0; tileX < width; tileX += 8)
+			{
+				if (!etc)
+				{
+					for (uint32_t index = 0; index < 64; ++index)
+					{
+						uint32_t x, y;
+						GetMortonPosition(index, x, y);
+						DecodeTexel(data, format, getPixel(tileX + x, tileY + y));
+						data += texelBytes;
+					}
+					continue;
+				}
+
+				// Four 4x4 blocks in Z order, alpha first when there is any
+				for (uint32_t block = 0; block < 4; ++block)
+				{
+					uint64_t alpha = 0;
+					if (format == FormatETC1A4)
+					{
+						alpha = ReadUInt64(data);
+						data += 8;
+					}
+
+					uint8_t texels[16][4];
+					DecodeETC1Block(ReadUInt64(data), texels);
+					data += 8;
+
+					uint32_t blockX = (block & 1) * 4;
+					uint32_t blockY = (block >> 1) * 4;
+					for (uint32_t i = 0; i < 16; ++i)
+					{
+						uint8_t* pixel = getPixel(tileX + blockX + i / 4, tileY + blockY + i % 4);
+						pixel[0] = texels[i][0];
+						pixel[1] = texels[i][1];
+						pixel[2] = texels[i][2];
+						pixel[3] = format == FormatETC1A4 ? Expand((alpha >> (i * 4)) & 0xF, 4) : 255;
+					}
+				}
+			}
+		}
+	}
+
+	bool DecompressT3XData(const uint8_t* data, size_t size, std::vector<uint8_t>& out)
+	{
+		if (size < 4)
+			return false;
+
+		uint8_t type = data[0];
+		size_t outSize = data[1] | (data[2] << 8) | (data[3] << 16);
+		size_t position = 4;
+		if (outSize == 0)
+		{
+			if (size < 8)
+				return false;
+			outSize = data[4] | (data[5] << 8) | (data[6] << 16) | (static_cast<size_t>(data[7]) << 24);
+			position = 8;
+		}
+
+		out.clear();
+		out.reserve(outSize);
+
+		if (type == 0x00)
+		{
+			if (size - position < outSize)
+				return false;
+			out.assign(data + position, data + position + outSize);
+			return true;
+		}
+
+		if (type != 0x11)
+			return false;
+
+		while (out.size() < outSize)
+		{
+			if (position >= size)
+				return false;
+			uint8_t flags = data[position++];
+
+			for (int bit = 7; bit >= 0 && out.size() < outSize; --bit)
+			{
+				if (!(flags & (1 << bit)))
+				{
+					if (position >= size)
+						return false;
+					out.push_back(data[position++]);
+					continue;
+				}
+
+				if (position + 2 > size)
+					return false;
+
+				uint32_t first = data[position];
+				uint32_t length;
+				uint32_t distance;
+
+				switch (first >> 4)
+				{
+				case 0:
+					if (position + 3 > size)
+						return false;
+					length = (((first & 0xF) << 4) | (data[position + 1] >> 4)) + 0x11;
+					distance = (((data[position + 1] & 0xF) << 8) | data[position + 2]) + 1;
+					position += 3;
+					break;
+				case 1:
+					if (position + 4 > size)
+						return false;
+					length = (((first & 0xF) << 12) | (data[position + 1] << 4) | (data[position + 2] >> 4)) + 0x111;
+					distance = (((data[position + 2] & 0xF) << 8) | data[position + 3]) + 1;
+					position += 4;
+					break;
+				default:
+					length = (first >> 4) + 1;
+					distance = (((first & 0xF) << 8) | data[position + 1]) + 1;
+					position += 2;
+					break;
+				}
+
+				if (distance > out.size() || out.size() + length > outSize)
+					return false;
+
+				for (uint32_t i = 0; i < length; ++i)
+					out.push_back(out[out.size() - distance]);
+			}
+		}
+
+		return true;
+	}
+
+	bool DecodeT3X(const std::vector<uint8_t>& file, T3XImage& image)
+	{
+		if (file.size() < HeaderSize || ReadUInt16(file.data()) != 1)
+			return false;
+
+		// Bits 6 and up of the size byte mark cube maps, which aren't supported here
+		uint8_t size = file[2];
+		if (size & 0xC0)
+			return false;
+
+		image.width = 8u << (size & 7);
+		image.height = 8u << ((size >> 3) & 7);
+		image.format = file[3];
+		image.mipLevels = file[4];
+
+		if (GetBitsPerTexel(image.format) == 0)
+			return false;
+
+		if (!DecompressT3XData(file.data() + HeaderSize, file.size() - HeaderSize, image.texels))
+			return false;
+
+		image.levels.clear();
+		size_t offset = 0;
+		for (uint32_t level = 0; level <= image.mipLevels; ++level)
+		{
+			uint32_t width = image.width >> level;
+			uint32_t height = image.height >> level;
+			size_t levelSize = static_cast<size_t>(width) * height * GetBitsPerTexel(image.format) / 8;
+			if (width < 8 || height < 8 || offset + levelSize > image.texels.size())
+				return false;
+
+			DecodeLevel(image.texels.data() + offset, width, height, image.format, image.levels.emplace_back());
+			offset += levelSize;
+		}
+
+		return offset == image.texels.size();
+	}
+}
@@ -0,0 +1,30 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace Nightbird::Tests
+{
+	// A .t3x file read back the way citro3d and the PICA GPU interpret it, written from the format
+	// description rather than from T3XEncoder so it can check the encoder
+	struct T3XImage
+	{
+		uint32_t width = 0;
+		uint32_t height = 0;
+		uint8_t format = 0;
+		uint32_t mipLevels = 0;
+
+		// Decompressed texel data of all levels, tiled as stored
+		std::vector<uint8_t> texels;
+		// RGBA8 rows from the top, one entry per level
+		std::vector<std::vector<uint8_t>> levels;
+	};
+
+	// Supports the uncompressed and LZ11 compressed files T3XEncoder and tex3ds -z lz11 write,
+	// and the RGBA8, RGB8, RGBA5551, RGB565, RGBA4, ETC1 and ETC1A4 formats
+	bool DecodeT3X(const std::vector<uint8_t>& file, T3XImage& image);
+
+	// Decodes an LZ11 or uncompressed stream with its 4 or 8 byte header, false if it is malformed
+	bool DecompressT3XData(const uint8_t* data, size_t size, std::vector<uint8_t>& out);
+}
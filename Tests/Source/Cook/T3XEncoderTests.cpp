@@ -0,0 +1,308 @@
+#include "Test.h"
+
+#include "Cook/T3XDecoder.h"
+#include "Cook/T3XEncoder.h"
+
+#define STB_IMAGE_IMPLEMENTATION
+#include <stb_image.h>
+
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+using namespace Nightbird;
+using Editor::T3XFormat;
+
+// Deterministic RGBA8 test image, smooth gradients with some noise and varying alpha
+static std::vector<uint8_t> MakeImage(uint32_t width, uint32_t height, uint32_t noise)
+{
+	std::vector<uint8_t> pixels(static_cast<size_t>(width) * height * 4);
+	uint32_t state = 12345;
+
+	for (uint32_t y = 0; y < height; ++y)
+	{
+		for (uint32_t x = 0; x < width; ++x)
+		{
+			state = state * 1664525u + 1013904223u;
+			int jitter = noise ? static_cast<int>((state >> 24) % (noise * 2 + 1)) - static_cast<int>(noise) : 0;
+
+			uint8_t* pixel = pixels.data() + (static_cast<size_t>(y) * width + x) * 4;
+			pixel[0] = static_cast<uint8_t>(std::clamp(static_cast<int>(x * 255 / width) + jitter, 0, 255));
+			pixel[1] = static_cast<uint8_t>(std::clamp(static_cast<int>(y * 255 / height) - jitter, 0, 255));
+			pixel[2] = static_cast<uint8_t>(std::clamp(static_cast<int>((x + y) * 127 / (width + height)) + 64 + jitter, 0, 255));
+			pixel[3] = static_cast<uint8_t>((x * 7 + y * 3) % 256);
+		}
+	}
+
+	return pixels;
+}
+
+// Nearest representable level, widened the way the GPU does by repeating the top bits
+static uint8_t QuantizeReference(uint8_t value, uint32_t bits)
+{
+	uint32_t max = (1u << bits) - 1;
+	uint32_t level = static_cast<uint32_t>(std::lround(value * static_cast<double>(max) / 255.0));
+	switch (bits)
+	{
+	case 1: return static_cast<uint8_t>(level * 255);
+	case 4: return static_cast<uint8_t>(level * 17);
+	case 5: return static_cast<uint8_t>((level << 3) | (level >> 2));
+	case 6: return static_cast<uint8_t>((level << 2) | (level >> 4));
+	default: return value;
+	}
+}
+
+// Bits per channel of the uncompressed formats, 0 for a channel that reads back as 255
+static void GetChannelBits(T3XFormat format, uint32_t (&bits)[4])
+{
+	switch (format)
+	{
+	case T3XFormat::RGB8: bits[0] = 8; bits[1] = 8; bits[2] = 8; bits[3] = 0; break;
+	case T3XFormat::RGBA5551: bits[0] = 5; bits[1] = 5; bits[2] = 5; bits[3] = 1; break;
+	case T3XFormat::RGB565: bits[0] = 5; bits[1] = 6; bits[2] = 5; bits[3] = 0; break;
+	case T3XFormat::RGBA4: bits[0] = 4; bits[1] = 4; bits[2] = 4; bits[3] = 4; break;
+	default: bits[0] = 8; bits[1] = 8; bits[2] = 8; bits[3] = 8; break;
+	}
+}
+
+static std::vector<uint8_t> QuantizeImage(const std::vector<uint8_t>& pixels, T3XFormat format)
+{
+	uint32_t bits[4];
+	GetChannelBits(format, bits);
+
+	std::vector<uint8_t> result(pixels.size());
+	for (size_t i = 0; i < pixels.size(); ++i)
+		result[i] = bits[i % 4] ? QuantizeReference(pixels[i], bits[i % 4]) : 255;
+	return result;
+}
+
+static std::vector<uint8_t> DownsampleReference(const std::vector<uint8_t>& pixels, uint32_t width, uint32_t height)
+{
+	std::vector<uint8_t> result(static_cast<size_t>(width / 2) * (height / 2) * 4);
+	for (uint32_t y = 0; y < height / 2; ++y)
+	{
+		for (uint32_t x = 0; x < width / 2; ++x)
+		{
+			for (uint32_t channel = 0; channel < 4; ++channel)
+			{
+				auto at = [&](uint32_t px, uint32_t py) { return pixels[(static_cast<size_t>(py) * width + px) * 4 + channel]; };
+				uint32_t sum = at(x * 2, y * 2) + at(x * 2 + 1, y * 2) + at(x * 2, y * 2 + 1) + at(x * 2 + 1, y * 2 + 1);
+				result[(static_cast<size_t>(y) * (width / 2) + x) * 4 + channel] = static_cast<uint8_t>((sum + 2) / 4);
+			}
+		}
+	}
+	return result;
+}
+
+// Over the colour channels, alpha is checked separately where a format has it
+static double GetPSNR(const std::vector<uint8_t>& a, const std::vector<uint8_t>& b)
+{
+	double error = 0.0;
+	for (size_t i = 0; i < a.size(); ++i)
+	{
+		if (i % 4 == 3)
+			continue;
+		double difference = static_cast<double>(a[i]) - b[i];
+		error += difference * difference;
+	}
+
+	double mean = error / (a.size() / 4 * 3);
+	return mean > 0.0 ? 10.0 * std::log10(255.0 * 255.0 / mean) : 99.0;
+}
+
+static uint32_t CountMismatches(const std::vector<uint8_t>& a, const std::vector<uint8_t>& b)
+{
+	if (a.size() != b.size())
+		return static_cast<uint32_t>(std::max(a.size(), b.size()));
+
+	uint32_t mismatches = 0;
+	for (size_t i = 0; i < a.size(); ++i)
+		mismatches += a[i] != b[i];
+	return mismatches;
+}
+
+NB_TEST(T3X_UncompressedFormatsDecodeExactly)
+{
+	const uint32_t width = 64;
+	const uint32_t height = 32;
+	const std::vector<uint8_t> pixels = MakeImage(width, height, 3);
+
+	for (T3XFormat format : { T3XFormat::RGBA8, T3XFormat::RGB8, T3XFormat::RGBA5551, T3XFormat::RGB565, T3XFormat::RGBA4 })
+	{
+		Tests::T3XImage image;
+		NB_CHECK(Tests::DecodeT3X(Editor::EncodeT3X(pixels.data(), width, height, format), image));
+		NB_CHECK_EQUAL(image.width, width);
+		NB_CHECK_EQUAL(image.height, height);
+		NB_CHECK_EQUAL(image.format, static_cast<uint8_t>(format));
+		NB_CHECK_EQUAL(image.mipLevels, 0u);
+
+		if (image.levels.size() == 1)
+			NB_CHECK_EQUAL(CountMismatches(image.levels[0], QuantizeImage(pixels, format)), 0u);
+	}
+}
+
+NB_TEST(T3X_MipLevelsStopAtTileSize)
+{
+	const uint32_t size = 64;
+	std::vector<uint8_t> level = MakeImage(size, size, 2);
+
+	Tests::T3XImage image;
+	NB_CHECK(Tests::DecodeT3X(Editor::EncodeT3X(level.data(), size, size, T3XFormat::RGB565, 10), image));
+	NB_CHECK_EQUAL(image.mipLevels, 3u);
+	NB_CHECK_EQUAL(image.levels.size(), static_cast<size_t>(4));
+
+	// Each level is box filtered from the previous one before quantizing
+	for (uint32_t i = 0; i < image.levels.size(); ++i)
+	{
+		if (i > 0)
+			level = DownsampleReference(level, size >> (i - 1), size >> (i - 1));
+		NB_CHECK_EQUAL(CountMismatches(image.levels[i], QuantizeImage(level, T3XFormat::RGB565)), 0u);
+	}
+}
+
+NB_TEST(T3X_ETC1Quality)
+{
+	const uint32_t size = 64;
+	const std::vector<uint8_t> pixels = MakeImage(size, size, 0);
+
+	for (T3XFormat format : { T3XFormat::ETC1, T3XFormat::ETC1A4 })
+	{
+		Tests::T3XImage image;
+		NB_CHECK(Tests::DecodeT3X(Editor::EncodeT3X(pixels.data(), size, size, format), image));
+		if (image.levels.size() != 1)
+			continue;
+
+		NB_CHECK(GetPSNR(image.levels[0], pixels) > 38.0);
+
+		// ETC1A4 alpha is plain 4-bit, ETC1 has none
+		bool alphaMatches = true;
+		for (size_t i = 3; i < pixels.size(); i += 4)
+			alphaMatches &= image.levels[0][i] == (format == T3XFormat::ETC1A4 ? QuantizeReference(pixels[i], 4) : 255);
+		NB_CHECK(alphaMatches);
+	}
+
+	// A flat colour only loses the 5-bit base precision
+	std::vector<uint8_t> flat(static_cast<size_t>(size) * size * 4);
+	for (size_t i = 0; i < flat.size(); i += 4)
+	{
+		flat[i] = 200;
+		flat[i + 1] = 101;
+		flat[i + 2] = 13;
+		flat[i + 3] = 255;
+	}
+
+	Tests::T3XImage image;
+	NB_CHECK(Tests::DecodeT3X(Editor::EncodeT3X(flat.data(), size, size, T3XFormat::ETC1), image));
+	if (image.levels.size() == 1)
+	{
+		int maxError = 0;
+		for (size_t i = 0; i < flat.size(); ++i)
+			maxError = std::max(maxError, std::abs(image.levels[0][i] - flat[i]));
+		NB_CHECK(maxError <= 4);
+	}
+}
+
+NB_TEST(T3X_CompressionFallsBackToRaw)
+{
+	const uint32_t size = 32;
+
+	// Flat data compresses, white noise doesn't and is stored raw
+	std::vector<uint8_t> flat(static_cast<size_t>(size) * size * 4, 128);
+	std::vector<uint8_t> noise(static_cast<size_t>(size) * size * 4);
+	uint32_t state = 1;
+	for (uint8_t& value : noise)
+	{
+		state = state * 1664525u + 1013904223u;
+		value = static_cast<uint8_t>(state >> 24);
+	}
+
+	std::vector<uint8_t> compressed = Editor::EncodeT3X(flat.data(), size, size, T3XFormat::RGBA8);
+	std::vector<uint8_t> raw = Editor::EncodeT3X(noise.data(), size, size, T3XFormat::RGBA8);
+	NB_CHECK(compressed.size() > 17 && compressed[17] == 0x11);
+	NB_CHECK(raw.size() > 17 && raw[17] == 0x00);
+
+	Tests::T3XImage image;
+	NB_CHECK(Tests::DecodeT3X(compressed, image) && image.levels.size() == 1 && image.levels[0] == flat);
+	NB_CHECK(Tests::DecodeT3X(raw, image) && image.levels.size() == 1 && image.levels[0] == noise);
+}
+
+NB_TEST(T3X_RejectsUnsupportedSizes)
+{
+	std::vector<uint8_t> pixels(2048 * 8 * 4);
+	NB_CHECK(Editor::EncodeT3X(pixels.data(), 24, 8, T3XFormat::RGBA8).empty());
+	NB_CHECK(Editor::EncodeT3X(pixels.data(), 4, 8, T3XFormat::RGBA8).empty());
+	NB_CHECK(Editor::EncodeT3X(pixels.data(), 2048, 8, T3XFormat::RGBA8).empty());
+}
+
+// Reference files from tex3ds, see Tests/Data/T3X/GenerateGoldens.sh
+NB_TEST(T3X_MatchesTex3dsGoldens)
+{
+	struct Format
+	{
+		const char* name;
+		T3XFormat format;
+	};
+	const Format formats[] = { { "rgba5551", T3XFormat::RGBA5551 }, { "rgb565", T3XFormat::RGB565 }, { "etc1", T3XFormat::ETC1 } };
+
+	uint32_t missing = 0;
+	for (const char* source : { "Gradient", "Pattern" })
+	{
+		int width = 0;
+		int height = 0;
+		int channels = 0;
+		std::string sourcePath = Tests::GetDataPath(std::string("T3X/") + source + ".png").string();
+		stbi_uc* pixels = stbi_load(sourcePath.c_str(), &width, &height, &channels, 4);
+		NB_CHECK(pixels != nullptr);
+		if (!pixels)
+			continue;
+
+		for (const Format& format : formats)
+		{
+			for (const char* suffix : { "", "_mips" })
+			{
+				const std::string name = std::string(source) + "_" + format.name + suffix + ".t3x";
+				std::ifstream file(Tests::GetDataPath("T3X/" + name), std::ios::binary);
+				if (!file)
+				{
+					Tests::ReportNote("Missing tex3ds reference file: " + name);
+					++missing;
+					continue;
+				}
+
+				Tests::T3XImage golden;
+				NB_CHECK(Tests::DecodeT3X(std::vector<uint8_t>(std::istreambuf_iterator<char>(file), {}), golden));
+				NB_CHECK_EQUAL(golden.format, static_cast<uint8_t>(format.format));
+
+				Tests::T3XImage encoded;
+				NB_CHECK(Tests::DecodeT3X(Editor::EncodeT3X(pixels, width, height, format.format, golden.mipLevels), encoded));
+				NB_CHECK_EQUAL(encoded.mipLevels, golden.mipLevels);
+				if (encoded.levels.size() != golden.levels.size())
+					continue;
+
+				// Uncompressed formats must match texel for texel, ETC1 encoders differ so
+				// ours has to be about as close to the source as tex3ds is
+				if (format.format != T3XFormat::ETC1)
+				{
+					NB_CHECK_EQUAL(CountMismatches(encoded.texels, golden.texels), 0u);
+					continue;
+				}
+
+				std::vector<uint8_t> level(pixels, pixels + static_cast<size_t>(width) * height * 4);
+				for (size_t i = 0; i < golden.levels.size(); ++i)
+				{
+					if (i > 0)
+						level = DownsampleReference(level, width >> (i - 1), height >> (i - 1));
+					NB_CHECK(GetPSNR(encoded.levels[i], level) >= GetPSNR(golden.levels[i], level) - 1.0);
+				}
+			}
+		}
+
+		stbi_image_free(pixels);
+	}
+
+	// Without them nothing shows the encoder matches tex3ds, generate them with Tests/Data/T3X/GenerateGoldens.sh
+	NB_CHECK_EQUAL(missing, 0u);
+}
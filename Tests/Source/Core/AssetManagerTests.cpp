@@ -0,0 +1,71 @@
+#include "Test.h"
+
+#include "Core/AssetManager.h"
+#include "Core/SceneObject.h"
+#include "Core/Texture.h"
+
+#include <memory>
+#include <vector>
+
+using namespace Nightbird;
+
+// Every texture is 1 KB of zeros, read counts show when the cache had to load one again
+class TestAssetManager : public Core::AssetManager
+{
+public:
+	uint32_t textureReads = 0;
+
+protected:
+	Core::SceneReadResult LoadScene(const uuids::uuid&) override { return {}; }
+	std::shared_ptr<Core::Mesh> LoadMesh(const uuids::uuid&) override { return nullptr; }
+	std::shared_ptr<Core::Material> LoadMaterial(const uuids::uuid&) override { return nullptr; }
+	std::shared_ptr<Core::Cubemap> LoadCubemap(const uuids::uuid&) override { return nullptr; }
+	std::shared_ptr<Core::AudioAsset> LoadAudio(const uuids::uuid&) override { return nullptr; }
+
+	std::shared_ptr<Core::Texture> LoadTexture(const uuids::uuid&) override
+	{
+		++textureReads;
+		return std::make_shared<Core::Texture>(16, 16, Core::TextureFormat::RGBA8, Core::AssetBuffer<uint8_t>(std::vector<uint8_t>(1024)));
+	}
+};
+
+static uuids::uuid MakeUUID(uint8_t index)
+{
+	std::array<uint8_t, 16> bytes = { index };
+	return uuids::uuid(bytes);
+}
+
+NB_TEST(AssetManager_UpdateKeepsRecentlyLoadedAssets)
+{
+	TestAssetManager assetManager;
+	assetManager.SetMemoryBudget(1);
+
+	// Handed out as a weak_ptr on a worker, the caller hasn't locked it by the next Update
+	std::weak_ptr<Core::Texture> texture = assetManager.Load<Core::Texture>(MakeUUID(1));
+	assetManager.Update();
+	NB_CHECK(!texture.expired());
+
+	assetManager.Load<Core::Texture>(MakeUUID(1));
+	NB_CHECK_EQUAL(assetManager.textureReads, 1u);
+
+	// Unused for two frames, now it goes
+	assetManager.Update();
+	assetManager.Update();
+	NB_CHECK(texture.expired());
+	NB_CHECK_EQUAL(assetManager.GetMemoryUsage(), size_t(0));
+}
+
+NB_TEST(AssetManager_LoadSharedHoldsPastEviction)
+{
+	TestAssetManager assetManager;
+	assetManager.SetMemoryBudget(1);
+
+	std::shared_ptr<Core::Texture> texture = assetManager.LoadShared<Core::Texture>(MakeUUID(1));
+	NB_CHECK(texture != nullptr);
+
+	assetManager.Update();
+	assetManager.Update();
+	assetManager.Update();
+	NB_CHECK(assetManager.LoadShared<Core::Texture>(MakeUUID(1)) == texture);
+	NB_CHECK_EQUAL(assetManager.textureReads, 1u);
+}
@@ -0,0 +1,55 @@
+#include "Test.h"
+
+#include "Core/JobSystem.h"
+
+#include <algorithm>
+#include <atomic>
+
+using namespace Nightbird;
+
+// Cost of scheduling an empty job, from Run to its counter reaching zero
+NB_BENCHMARK(JobSystem_SchedulingOverhead)
+{
+	constexpr uint32_t JobCount = 100000;
+
+	const uint32_t defaultWorkers = Core::JobSystem::GetDefaultWorkerCount();
+
+	for (uint32_t workers : { 0u, 1u, std::max(defaultWorkers, 2u) })
+	{
+		Core::JobSystem jobSystem(workers);
+
+		Tests::Stopwatch stopwatch;
+		Core::JobCounter counter;
+		for (uint32_t i = 0; i < JobCount; ++i)
+			jobSystem.Run([]() {}, &counter);
+		jobSystem.Wait(counter);
+
+		Tests::ReportResult("Run + Wait, " + std::to_string(workers) + " workers", stopwatch.GetMilliseconds() * 1.0e6 / JobCount, "ns/job");
+	}
+}
+
+NB_BENCHMARK(JobSystem_ParallelForOverhead)
+{
+	constexpr uint32_t Count = 1 << 20;
+	constexpr uint32_t Iterations = 20;
+
+	// At least one worker, with none ParallelFor runs inline and measures nothing
+	Core::JobSystem jobSystem(std::max(Core::JobSystem::GetDefaultWorkerCount(), 1u));
+
+	for (uint32_t batchSize : { 64u, 1024u, 16384u })
+	{
+		std::atomic<uint64_t> sum = 0;
+
+		Tests::Stopwatch stopwatch;
+		for (uint32_t iteration = 0; iteration < Iterations; ++iteration)
+		{
+			jobSystem.ParallelFor(Count, batchSize, [&sum](uint32_t begin, uint32_t end)
+			{
+				sum.fetch_add(end - begin, std::memory_order_relaxed);
+			});
+		}
+
+		double batches = static_cast<double>(Iterations) * ((Count + batchSize - 1) / batchSize);
+		Tests::ReportResult("ParallelFor batch " + std::to_string(batchSize), stopwatch.GetMilliseconds() * 1.0e6 / batches, "ns/batch");
+	}
+}
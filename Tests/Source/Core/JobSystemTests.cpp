@@ -0,0 +1,216 @@
+#include "Test.h"
+
+#include "Core/JobSystem.h"
+
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <set>
+#include <thread>
+#include <vector>
+
+using namespace Nightbird;
+
+NB_TEST(JobSystem_WorkersStealFromMainQueue)
+{
+	Core::JobSystem jobSystem(3);
+
+	// Jobs pushed from the main thread land in its queue, while it sleeps only workers can take them
+	std::mutex mutex;
+	std::set<std::thread::id> threads;
+	std::atomic<uint32_t> ran = 0;
+
+	Core::JobCounter counter;
+	for (int i = 0; i < 64; ++i)
+	{
+		jobSystem.Run([&]()
+		{
+			std::this_thread::sleep_for(std::chrono::microseconds(200));
+			std::lock_guard<std::mutex> lock(mutex);
+			threads.insert(std::this_thread::get_id());
+			++ran;
+		}, &counter);
+	}
+
+	Tests::Stopwatch stopwatch;
+	while (ran < 64 && stopwatch.GetMilliseconds() < 5000.0)
+		std::this_thread::sleep_for(std::chrono::milliseconds(1));
+
+	NB_CHECK_EQUAL(ran.load(), 64u);
+	NB_CHECK(threads.size() > 1);
+	NB_CHECK(threads.count(std::this_thread::get_id()) == 0);
+
+	jobSystem.Wait(counter);
+}
+
+NB_TEST(JobSystem_DependencyRunsAfterCounter)
+{
+	Core::JobSystem jobSystem(2);
+
+	std::atomic<bool> release = false;
+	std::atomic<uint32_t> first = 0;
+	std::atomic<bool> continuationSawAll = false;
+
+	Core::JobCounter firstCounter;
+	for (int i = 0; i < 4; ++i)
+	{
+		jobSystem.Run([&]()
+		{
+			while (!release)
+				std::this_thread::yield();
+			++first;
+		}, &firstCounter);
+	}
+
+	Core::JobCounter secondCounter;
+	jobSystem.Run([&]() { continuationSawAll = first == 4; }, &secondCounter, &firstCounter);
+
+	// Held back until the dependency finishes, yet already counted
+	NB_CHECK(!secondCounter.IsDone());
+
+	release = true;
+	jobSystem.Wait(secondCounter);
+
+	NB_CHECK(firstCounter.IsDone());
+	NB_CHECK(continuationSawAll.load());
+}
+
+NB_TEST(JobSystem_DependencyAlreadyDone)
+{
+	Core::JobSystem jobSystem(2);
+
+	Core::JobCounter done;
+	Core::JobCounter counter;
+	std::atomic<bool> ran = false;
+
+	jobSystem.Run([&]() { ran = true; }, &counter, &done);
+	jobSystem.Wait(counter);
+
+	NB_CHECK(ran.load());
+}
+
+NB_TEST(JobSystem_ContinuationChain)
+{
+	Core::JobSystem jobSystem(2);
+
+	// Each stage depends on the previous one, so they must run strictly in order
+	constexpr int Stages = 16;
+	Core::JobCounter counters[Stages];
+	std::vector<int> order;
+	std::mutex mutex;
+
+	for (int i = 0; i < Stages; ++i)
+	{
+		jobSystem.Run([&, i]()
+		{
+			std::lock_guard<std::mutex> lock(mutex);
+			order.push_back(i);
+		}, &counters[i], i > 0 ? &counters[i - 1] : nullptr);
+	}
+
+	jobSystem.Wait(counters[Stages - 1]);
+
+	NB_CHECK_EQUAL(order.size(), static_cast<size_t>(Stages));
+	NB_CHECK(std::is_sorted(order.begin(), order.end()));
+}
+
+static void CheckParallelFor(Core::JobSystem& jobSystem, uint32_t count, uint32_t batchSize)
+{
+	std::vector<std::atomic<uint32_t>> hits(count);
+	std::atomic<uint32_t> calls = 0;
+	std::atomic<uint32_t> largestBatch = 0;
+
+	jobSystem.ParallelFor(count, batchSize, [&](uint32_t begin, uint32_t end)
+	{
+		++calls;
+
+		uint32_t size = end - begin;
+		uint32_t largest = largestBatch.load();
+		while (size > largest && !largestBatch.compare_exchange_weak(largest, size))
+		{
+		}
+
+		for (uint32_t i = begin; i < end; ++i)
+			++hits[i];
+	});
+
+	bool exactlyOnce = std::all_of(hits.begin(), hits.end(), [](const std::atomic<uint32_t>& hit) { return hit == 1; });
+	NB_CHECK(exactlyOnce);
+	NB_CHECK(largestBatch <= std::max(batchSize, 1u));
+
+	if (count == 0)
+		NB_CHECK_EQUAL(calls.load(), 0u);
+	else
+		NB_CHECK_EQUAL(calls.load(), (count + std::max(batchSize, 1u) - 1) / std::max(batchSize, 1u));
+}
+
+NB_TEST(JobSystem_ParallelForRanges)
+{
+	Core::JobSystem jobSystem(3);
+
+	CheckParallelFor(jobSystem, 0, 64);
+	CheckParallelFor(jobSystem, 1, 64);
+	CheckParallelFor(jobSystem, 64, 64);
+	CheckParallelFor(jobSystem, 65, 64);
+	CheckParallelFor(jobSystem, 1000, 64);
+	CheckParallelFor(jobSystem, 1000, 7);
+	CheckParallelFor(jobSystem, 5, 0);
+}
+
+NB_TEST(JobSystem_WaitHelpsFromMainThread)
+{
+	Core::JobSystem jobSystem(1);
+
+	// Occupy the only worker until the main thread has run the second job itself
+	std::atomic<bool> blockerStarted = false;
+	std::atomic<bool> release = false;
+
+	Core::JobCounter blocker;
+	jobSystem.Run([&]()
+	{
+		blockerStarted = true;
+		while (!release)
+			std::this_thread::yield();
+	}, &blocker);
+
+	while (!blockerStarted)
+		std::this_thread::yield();
+
+	std::thread::id ranOn;
+	Core::JobCounter counter;
+	jobSystem.Run([&]() { ranOn = std::this_thread::get_id(); }, &counter);
+	jobSystem.Wait(counter);
+
+	NB_CHECK(ranOn == std::this_thread::get_id());
+
+	release = true;
+	jobSystem.Wait(blocker);
+}
+
+NB_TEST(JobSystem_ZeroWorkersRunInline)
+{
+	Core::JobSystem jobSystem(0);
+	NB_CHECK_EQUAL(jobSystem.GetWorkerCount(), 0u);
+
+	std::thread::id ranOn;
+	Core::JobCounter counter;
+	jobSystem.Run([&]() { ranOn = std::this_thread::get_id(); }, &counter);
+
+	// Ran during Run, nothing is left to wait for
+	NB_CHECK(counter.IsDone());
+	NB_CHECK(ranOn == std::this_thread::get_id());
+
+	Core::JobCounter dependent;
+	bool continuationRan = false;
+	jobSystem.Run([&]() { continuationRan = true; }, &dependent, &counter);
+	NB_CHECK(continuationRan);
+
+	uint32_t calls = 0;
+	jobSystem.ParallelFor(1000, 64, [&](uint32_t begin, uint32_t end)
+	{
+		++calls;
+		NB_CHECK_EQUAL(begin, 0u);
+		NB_CHECK_EQUAL(end, 1000u);
+	});
+	NB_CHECK_EQUAL(calls, 1u);
+}
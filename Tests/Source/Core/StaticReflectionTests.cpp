@@ -0,0 +1,43 @@
+#include "Test.h"
+
+#include "Core/SpatialObject.h"
+#include "Core/Transform.h"
+
+using namespace Nightbird;
+
+static uint32_t GetAddressOffset(const void* object, const void* member)
+{
+	return static_cast<uint32_t>(static_cast<const uint8_t*>(member) - static_cast<const uint8_t*>(object));
+}
+
+NB_TEST(StaticReflection_FieldOffsetsMatchMembers)
+{
+	Core::Transform transform;
+	const TypeInfo& type = Core::Transform::s_TypeInfo;
+	NB_CHECK_EQUAL(type.fieldCount, 3u);
+
+	const void* members[] = { &transform.position, &transform.rotation, &transform.scale };
+	for (uint32_t i = 0; i < type.fieldCount && i < 3; ++i)
+		NB_CHECK_EQUAL(type.fields[i].offset, GetAddressOffset(&transform, members[i]));
+}
+
+NB_TEST(StaticReflection_NestedOffsetInVirtualClass)
+{
+	// SpatialObject has a vtable, the flattened offset has to land on the real member
+	Core::SpatialObject object;
+	object.SetPosition(glm::vec3(1.0f, 2.0f, 3.0f));
+
+	const FieldLayout* layout = Core::SpatialObject::s_TypeInfo.layout;
+	NB_CHECK(layout != nullptr);
+	if (!layout)
+		return;
+
+	const FlatField* field = layout->FindFlat(CombineFieldHash(FNVHash("m_Transform"), FNVHash("position")));
+	NB_CHECK(field != nullptr);
+	if (!field)
+		return;
+
+	const glm::vec3& position = *reinterpret_cast<const glm::vec3*>(reinterpret_cast<const uint8_t*>(&object) + field->offset);
+	NB_CHECK(position == glm::vec3(1.0f, 2.0f, 3.0f));
+	NB_CHECK_EQUAL(GetAddressOffset(&object, &object.GetTransform().position), field->offset);
+}
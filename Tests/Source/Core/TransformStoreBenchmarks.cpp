@@ -0,0 +1,119 @@
+#include "Test.h"
+
+#include "Core/Scene.h"
+#include "Core/SpatialObject.h"
+
+#include <glm/gtc/quaternion.hpp>
+
+#include <cmath>
+#include <memory>
+#include <vector>
+
+using namespace Nightbird;
+
+static constexpr uint32_t NodeCount = 100000;
+static constexpr uint32_t Frames = 20;
+
+// A 4-ary tree of NodeCount nodes under root, returned in parent-first order
+static std::vector<Core::SpatialObject*> BuildTree(Core::SceneObject* root)
+{
+	std::vector<Core::SpatialObject*> nodes;
+	nodes.reserve(NodeCount);
+
+	for (uint32_t i = 0; i < NodeCount; ++i)
+	{
+		auto node = std::make_unique<Core::SpatialObject>();
+		node->SetPosition(glm::vec3(1.0f, 0.0f, 0.0f));
+
+		Core::SpatialObject* pointer = node.get();
+		if (i == 0)
+			root->AddChild(std::move(node));
+		else
+			nodes[(i - 1) / 4]->AddChild(std::move(node));
+
+		nodes.push_back(pointer);
+	}
+
+	return nodes;
+}
+
+// The path before SpatialObject cached anything, every query walks up to the root
+static glm::mat4 GetWorldMatrixUncached(const Core::SpatialObject* node)
+{
+	const auto* parent = Cast<Core::SpatialObject>(node->GetParent());
+	glm::mat4 local = node->GetTransform().GetLocalMatrix();
+	return parent ? GetWorldMatrixUncached(parent) * local : local;
+}
+
+// Moves every stride-th node, then reads the world matrix of every node
+static double RunFrame(const std::vector<Core::SpatialObject*>& nodes, Core::TransformStore* store, uint32_t frame, uint32_t stride)
+{
+	glm::quat rotation = glm::angleAxis(0.001f * frame, glm::vec3(0.0f, 1.0f, 0.0f));
+	for (size_t i = frame % stride; i < nodes.size(); i += stride)
+		nodes[i]->SetRotation(rotation);
+
+	if (store)
+		store->Update();
+
+	double sum = 0.0;
+	for (Core::SpatialObject* node : nodes)
+		sum += node->GetWorldMatrix()[3][0];
+
+	return sum;
+}
+
+NB_BENCHMARK(TransformStore_VersusRecursive)
+{
+	{
+		Core::SpatialObject root;
+		std::vector<Core::SpatialObject*> nodes = BuildTree(&root);
+
+		Tests::Stopwatch stopwatch;
+		double sum = 0.0;
+		for (Core::SpatialObject* node : nodes)
+			sum += GetWorldMatrixUncached(node)[3][0];
+		Tests::ReportResult("Recursive uncached, 100k nodes, full pass", stopwatch.GetMilliseconds(), "ms");
+		NB_CHECK(sum > 0.0);
+	}
+
+	// Outside a Scene, SpatialObject resolves world matrices recursively through its parents
+	Core::SpatialObject recursiveRoot;
+	std::vector<Core::SpatialObject*> recursiveNodes = BuildTree(&recursiveRoot);
+
+	Core::Scene scene;
+	scene.SetEngine(nullptr);
+	std::vector<Core::SpatialObject*> storeNodes = BuildTree(scene.GetRoot());
+	Core::TransformStore& store = scene.GetTransformStore();
+
+	{
+		Core::Scene scene;
+		scene.SetEngine(nullptr);
+		BuildTree(scene.GetRoot());
+
+		Tests::Stopwatch stopwatch;
+		scene.GetTransformStore().Update();
+		Tests::ReportResult("TransformStore, 100k nodes, first full pass", stopwatch.GetMilliseconds(), "ms");
+	}
+
+	for (uint32_t stride : { 1u, 100u })
+	{
+		const std::string moved = stride == 1 ? "all moved" : "1% moved";
+		double recursiveSum = 0.0;
+		double storeSum = 0.0;
+
+		Tests::Stopwatch recursiveTime;
+		for (uint32_t frame = 0; frame < Frames; ++frame)
+			recursiveSum += RunFrame(recursiveNodes, nullptr, frame, stride);
+		Tests::ReportResult("Recursive cached, 100k nodes, " + moved, recursiveTime.GetMilliseconds() / Frames, "ms/frame");
+
+		Tests::Stopwatch storeTime;
+		for (uint32_t frame = 0; frame < Frames; ++frame)
+			storeSum += RunFrame(storeNodes, &store, frame, stride);
+		Tests::ReportResult("TransformStore, 100k nodes, " + moved, storeTime.GetMilliseconds() / Frames, "ms/frame");
+
+		store.ClearChanged();
+
+		// Both paths see the same transforms, so they must agree
+		NB_CHECK(std::abs(recursiveSum - storeSum) <= 1.0e-4 * std::abs(recursiveSum));
+	}
+}
@@ -0,0 +1,79 @@
+#include "Test.h"
+
+#include "Core/JobSystem.h"
+#include "Core/TransformStore.h"
+
+#include <vector>
+
+using namespace Nightbird;
+
+NB_TEST(TransformStore_ParentFirstUpdate)
+{
+	Core::TransformStore store;
+	Core::TransformStore::Handle parent = store.Allocate();
+	Core::TransformStore::Handle child = store.Allocate();
+	store.SetParent(child, parent);
+
+	Core::Transform transform;
+	transform.position = glm::vec3(1.0f, 2.0f, 3.0f);
+	store.SetLocal(parent, transform);
+	store.SetLocal(child, transform);
+
+	glm::vec4 position = store.GetWorldMatrix(child)[3];
+	NB_CHECK(position == glm::vec4(2.0f, 4.0f, 6.0f, 1.0f));
+}
+
+NB_TEST(TransformStore_DeferredQueriesReturnLastUpdate)
+{
+	Core::TransformStore store;
+	Core::TransformStore::Handle handle = store.Allocate();
+	store.Update();
+
+	Core::Transform transform;
+	transform.position = glm::vec3(5.0f, 0.0f, 0.0f);
+
+	store.SetDeferred(true);
+	store.SetLocal(handle, transform);
+
+	// No lazy Update while deferred, the write shows up only after it ends
+	NB_CHECK(store.GetWorldMatrix(handle)[3].x == 0.0f);
+
+	store.SetDeferred(false);
+	NB_CHECK(store.GetWorldMatrix(handle)[3].x == 5.0f);
+}
+
+NB_TEST(TransformStore_DeferredParallelWrites)
+{
+	constexpr uint32_t Count = 10000;
+
+	Core::TransformStore store;
+	std::vector<Core::TransformStore::Handle> handles;
+	for (uint32_t i = 0; i < Count; ++i)
+		handles.push_back(store.Allocate());
+	store.Update();
+	store.ClearChanged();
+
+	// Every job moves its own nodes and reads others, as parallel ticks do
+	Core::JobSystem jobSystem(3);
+	store.SetDeferred(true);
+	jobSystem.ParallelFor(Count, 64, [&](uint32_t begin, uint32_t end)
+	{
+		for (uint32_t i = begin; i < end; ++i)
+		{
+			Core::Transform transform;
+			transform.position = glm::vec3(static_cast<float>(i), 0.0f, 0.0f);
+			store.SetLocal(handles[i], transform);
+
+			NB_CHECK(store.GetWorldMatrix(handles[(i + 4096) % Count])[3].x == 0.0f);
+		}
+	});
+	store.SetDeferred(false);
+
+	store.Update();
+	NB_CHECK_EQUAL(store.GetChanged().size(), static_cast<size_t>(Count));
+
+	bool allMoved = true;
+	for (uint32_t i = 0; i < Count; ++i)
+		allMoved &= store.GetWorldMatrix(handles[i])[3].x == static_cast<float>(i);
+	NB_CHECK(allMoved);
+}
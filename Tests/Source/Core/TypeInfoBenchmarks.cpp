@@ -0,0 +1,73 @@
+#include "Test.h"
+
+#include "Core/TypeRegistry.h"
+
+#include <string>
+#include <vector>
+
+using namespace Nightbird;
+
+static constexpr uint32_t Depth = 64;
+static constexpr uint32_t Queries = 1000000;
+
+// A single chain of Depth types, each deriving from the one before it
+static std::vector<TypeInfo>& GetChain()
+{
+	static std::vector<std::string> names;
+	static std::vector<TypeInfo> chain;
+	if (!chain.empty())
+		return chain;
+
+	names.reserve(Depth);
+	chain.resize(Depth);
+	for (uint32_t i = 0; i < Depth; ++i)
+	{
+		names.push_back("IsABenchmarkType" + std::to_string(i));
+		chain[i].name = names[i].c_str();
+		chain[i].nameHash = FNVHash(names[i]);
+		chain[i].parent = i > 0 ? &chain[i - 1] : nullptr;
+	}
+
+	return chain;
+}
+
+// Asks whether the deepest type is each type of the chain, half of them hits at the far end
+static uint32_t RunQueries(const std::vector<TypeInfo>& chain, const TypeInfo* deepest)
+{
+	uint32_t hits = 0;
+	for (uint32_t i = 0; i < Queries; ++i)
+	{
+		const TypeInfo& other = chain[i % Depth];
+		hits += deepest->IsA(&other) ? 1 : 0;
+		hits += other.IsA(deepest) ? 1 : 0;
+	}
+	return hits;
+}
+
+NB_BENCHMARK(TypeInfo_IsADeepHierarchy)
+{
+	std::vector<TypeInfo>& chain = GetChain();
+
+	// Unassigned ranges take the parent chain walk that IsA used before BuildHierarchy existed
+	std::vector<TypeInfo> walked = chain;
+	for (uint32_t i = 0; i < Depth; ++i)
+		walked[i].parent = i > 0 ? &walked[i - 1] : nullptr;
+
+	Tests::Stopwatch walkTime;
+	uint32_t walkHits = RunQueries(walked, &walked[Depth - 1]);
+	Tests::ReportResult("IsA parent walk, depth 64", walkTime.GetMilliseconds() * 1.0e6 / (Queries * 2.0), "ns/query");
+
+	for (TypeInfo& type : chain)
+		TypeRegistry::Register(&type);
+	TypeRegistry::BuildHierarchy();
+
+	NB_CHECK_EQUAL(chain[Depth - 1].hierarchyBegin, chain[0].hierarchyBegin + Depth - 1);
+
+	Tests::Stopwatch rangeTime;
+	uint32_t rangeHits = RunQueries(chain, &chain[Depth - 1]);
+	Tests::ReportResult("IsA hierarchy range, depth 64", rangeTime.GetMilliseconds() * 1.0e6 / (Queries * 2.0), "ns/query");
+
+	// The deepest type is every type of the chain, but only itself is the deepest type
+	NB_CHECK_EQUAL(walkHits, Queries + Queries / Depth);
+	NB_CHECK_EQUAL(rangeHits, walkHits);
+}
@@ -0,0 +1,108 @@
+#include "Test.h"
+
+#include "Core/TypeRegistry.h"
+
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+// Runs every test, or every benchmark with --bench. A further argument runs only names containing it.
+// Test data is read from Tests/Data under the working directory unless --data gives another path.
+namespace Nightbird::Tests
+{
+	struct TestCase
+	{
+		const char* name;
+		TestFunction function;
+	};
+
+	static std::vector<TestCase>& GetTests()
+	{
+		static std::vector<TestCase> tests;
+		return tests;
+	}
+
+	static std::vector<TestCase>& GetBenchmarks()
+	{
+		static std::vector<TestCase> benchmarks;
+		return benchmarks;
+	}
+
+	static std::filesystem::path s_DataDirectory = std::filesystem::path("Tests") / "Data";
+	static uint32_t s_Failures = 0;
+
+	bool RegisterTest(const char* name, TestFunction function)
+	{
+		GetTests().push_back({ name, function });
+		return true;
+	}
+
+	bool RegisterBenchmark(const char* name, TestFunction function)
+	{
+		GetBenchmarks().push_back({ name, function });
+		return true;
+	}
+
+	void ReportFailure(const char* file, int line, const std::string& message)
+	{
+		std::printf("  FAILED %s:%d: %s\n", file, line, message.c_str());
+		++s_Failures;
+	}
+
+	void ReportResult(const std::string& name, double value, const char* unit)
+	{
+		std::printf("  %-48s %12.3f %s\n", name.c_str(), value, unit);
+	}
+
+	void ReportNote(const std::string& message)
+	{
+		std::printf("  note: %s\n", message.c_str());
+	}
+
+	std::filesystem::path GetDataPath(const std::filesystem::path& relativePath)
+	{
+		return s_DataDirectory / relativePath;
+	}
+}
+
+int main(int argc, char** argv)
+{
+	using namespace Nightbird::Tests;
+
+	bool benchmark = false;
+	const char* filter = nullptr;
+
+	for (int i = 1; i < argc; ++i)
+	{
+		if (std::strcmp(argv[i], "--bench") == 0)
+			benchmark = true;
+		else if (std::strcmp(argv[i], "--data") == 0 && i + 1 < argc)
+			s_DataDirectory = argv[++i];
+		else
+			filter = argv[i];
+	}
+
+	// Field layouts and hierarchy ranges, as the applications set them up
+	Nightbird::TypeRegistry::InitReflection();
+
+	uint32_t run = 0;
+	uint32_t failed = 0;
+
+	for (const TestCase& test : benchmark ? GetBenchmarks() : GetTests())
+	{
+		if (filter && !std::strstr(test.name, filter))
+			continue;
+
+		std::printf("%s\n", test.name);
+
+		uint32_t failuresBefore = s_Failures;
+		test.function();
+
+		++run;
+		if (s_Failures != failuresBefore)
+			++failed;
+	}
+
+	std::printf("%u run, %u failed\n", run, failed);
+	return failed == 0 ? 0 : 1;
+}
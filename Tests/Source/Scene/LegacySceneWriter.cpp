@@ -0,0 +1,154 @@
+#include "Scene/LegacySceneWriter.h"
+
+#include "Core/SceneObject.h"
+#include "Core/TypeInfo.h"
+
+#include "Cook/BinaryWriter.h"
+
+#include <glm/glm.hpp>
+#include <glm/gtc/quaternion.hpp>
+
+#include <bit>
+#include <cstring>
+#include <span>
+#include <string>
+#include <unordered_map>
+
+namespace Nightbird::Tests
+{
+	using NodeUUIDs = std::unordered_map<const Core::SceneObject*, uuids::uuid>;
+
+	// Sequential rather than random, so the same scene always gives the same file
+	static void AssignNodeUUIDs(const Core::SceneObject* object, NodeUUIDs& uuids)
+	{
+		std::array<uint8_t, 16> bytes = {};
+		uint32_t index = static_cast<uint32_t>(uuids.size()) + 1;
+		std::memcpy(bytes.data(), &index, sizeof(index));
+		uuids[object] = uuids::uuid(bytes);
+
+		if (object->HasSourceScene() && object->GetParent())
+			return;
+
+		for (const auto& child : object->GetChildren())
+			AssignNodeUUIDs(child.get(), uuids);
+	}
+
+	static void WriteUUID(const uuids::uuid& uuid, Editor::BinaryWriter& writer)
+	{
+		auto bytes = uuid.as_bytes();
+		writer.WriteRawBytes(reinterpret_cast<const uint8_t*>(bytes.data()), 16);
+	}
+
+	static void WriteFields(void* object, const TypeInfo* type, Editor::BinaryWriter& writer)
+	{
+		if (!object || !type)
+			return;
+
+		if (type->parent)
+			WriteFields(object, type->parent, writer);
+
+		if (!type->HasFields())
+			return;
+
+		for (const FieldInfo* field = type->Begin(); field != type->End(); ++field)
+		{
+			writer.WriteUInt32(field->nameHash);
+
+			switch (field->kind)
+			{
+			case FieldKind::Bool:
+				writer.WriteUInt16(sizeof(uint8_t));
+				writer.WriteUInt8(*field->GetPtrAs<bool>(object) ? 1 : 0);
+				break;
+			case FieldKind::Int32:
+			case FieldKind::UInt32:
+			case FieldKind::Float:
+				writer.WriteUInt16(sizeof(uint32_t));
+				writer.WriteUInt32(*field->GetPtrAs<uint32_t>(object));
+				break;
+			case FieldKind::String:
+			{
+				const std::string& string = *field->GetPtrAs<std::string>(object);
+				writer.WriteUInt16(static_cast<uint16_t>(sizeof(uint32_t) + string.size()));
+				writer.WriteUInt32(static_cast<uint32_t>(string.size()));
+				writer.WriteRawBytes(reinterpret_cast<const uint8_t*>(string.data()), string.size());
+				break;
+			}
+			case FieldKind::Vector2:
+			case FieldKind::Vector3:
+			case FieldKind::Vector4:
+			case FieldKind::Quat:
+			{
+				size_t count = field->kind == FieldKind::Vector2 ? 2 : field->kind == FieldKind::Vector3 ? 3 : 4;
+				writer.WriteUInt16(static_cast<uint16_t>(sizeof(float) * count));
+				writer.WriteSpan(std::span<const float>(field->GetPtrAs<float>(object), count));
+				break;
+			}
+			case FieldKind::UUID:
+			case FieldKind::AssetRef:
+				writer.WriteUInt16(16);
+				WriteUUID(*field->GetPtrAs<uuids::uuid>(object), writer);
+				break;
+			case FieldKind::Object:
+				// Nested fields follow inline without a count
+				writer.WriteUInt16(0);
+				WriteFields(field->GetPtr(object), field->type, writer);
+				break;
+			default:
+				break;
+			}
+		}
+	}
+
+	static void WriteNode(const Core::SceneObject* object, const uuids::uuid& parentUUID, const NodeUUIDs& uuids, Editor::BinaryWriter& writer)
+	{
+		WriteUUID(uuids.at(object), writer);
+		WriteUUID(parentUUID, writer);
+
+		writer.WriteUInt8(object->HasSourceScene() ? 1 : 0);
+		if (object->HasSourceScene())
+			WriteUUID(object->GetSourceSceneUUID().value(), writer);
+
+		const TypeInfo* type = object->GetTypeInfo();
+		uint16_t typeNameLength = static_cast<uint16_t>(std::strlen(type->name));
+		writer.WriteUInt16(typeNameLength);
+		writer.WriteRawBytes(reinterpret_cast<const uint8_t*>(type->name), typeNameLength);
+
+		// Top level fields only, nested object fields count as one
+		uint16_t fieldCount = 0;
+		for (const TypeInfo* current = type; current; current = current->parent)
+			fieldCount += static_cast<uint16_t>(current->fieldCount);
+		writer.WriteUInt16(fieldCount);
+
+		WriteFields(const_cast<Core::SceneObject*>(object), type, writer);
+
+		if (object->HasSourceScene())
+			return;
+
+		for (const auto& child : object->GetChildren())
+			WriteNode(child.get(), uuids.at(object), uuids, writer);
+	}
+
+	void WriteVersion1Scene(Core::SceneObject* root, const std::filesystem::path& path)
+	{
+		NodeUUIDs uuids;
+		AssignNodeUUIDs(root, uuids);
+
+		Editor::BinaryWriter writer(path, std::endian::native == std::endian::little ? Endianness::Little : Endianness::Big);
+
+		writer.WriteRawBytes(reinterpret_cast<const uint8_t*>("SCNE"), 4);
+		writer.WriteUInt32(1);
+
+		const std::string& name = root->GetName();
+		writer.WriteUInt32(static_cast<uint32_t>(name.size()));
+		writer.WriteRawBytes(reinterpret_cast<const uint8_t*>(name.data()), name.size());
+
+		// Scene and active camera UUIDs
+		WriteUUID(uuids::uuid(), writer);
+		WriteUUID(uuids::uuid(), writer);
+
+		writer.WriteUInt32(static_cast<uint32_t>(uuids.size() - 1));
+		for (const auto& child : root->GetChildren())
+			WriteNode(child.get(), uuids::uuid(), uuids, writer);
+	}
+}
@@ -0,0 +1,17 @@
+#pragma once
+
+#include <uuid.h>
+
+#include <filesystem>
+
+namespace Nightbird::Core
+{
+	class SceneObject;
+}
+
+namespace Nightbird::Tests
+{
+	// Writes the version 1 binary scene format, which the editor no longer produces but the
+	// runtime still loads. Every node carries UUIDs and each field is tagged with its name hash and size.
+	void WriteVersion1Scene(Core::SceneObject* root, const std::filesystem::path& path);
+}
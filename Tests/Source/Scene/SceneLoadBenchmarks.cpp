@@ -0,0 +1,111 @@
+#include "Test.h"
+
+#include "Scene/LegacySceneWriter.h"
+#include "Scene/BinarySceneWriter.h"
+
+#include "Core/BinaryReader.h"
+#include "Core/BinarySceneReader.h"
+#include "Core/MeshInstance.h"
+#include "Core/PointLight.h"
+#include "Core/SpatialObject.h"
+
+#include <bit>
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace Nightbird;
+
+// A 4-ary tree of nodeCount nodes mixing a few common types, with every field set
+static std::unique_ptr<Core::SceneObject> BuildScene(uint32_t nodeCount)
+{
+	auto root = std::make_unique<Core::SceneObject>();
+	root->SetName("Benchmark");
+
+	std::vector<Core::SceneObject*> nodes;
+	nodes.reserve(nodeCount);
+
+	for (uint32_t i = 0; i < nodeCount; ++i)
+	{
+		std::unique_ptr<Core::SpatialObject> node;
+		switch (i % 4)
+		{
+		case 1:
+			node = std::make_unique<Core::MeshInstance>();
+			break;
+		case 2:
+			node = std::make_unique<Core::PointLight>();
+			break;
+		default:
+			node = std::make_unique<Core::SpatialObject>();
+			break;
+		}
+
+		node->SetName("Node" + std::to_string(i % 64));
+		node->SetPosition(glm::vec3(static_cast<float>(i), 1.0f, 2.0f));
+
+		Core::SceneObject* pointer = node.get();
+		if (i == 0)
+			root->AddChild(std::move(node));
+		else
+			nodes[(i - 1) / 4]->AddChild(std::move(node));
+
+		nodes.push_back(pointer);
+	}
+
+	return root;
+}
+
+static uint32_t CountNodes(const Core::SceneObject* object)
+{
+	uint32_t count = 1;
+	for (const auto& child : object->GetChildren())
+		count += CountNodes(child.get());
+	return count;
+}
+
+static void BenchmarkLoad(const std::string& name, const std::filesystem::path& path, uint32_t nodeCount, uint32_t runs)
+{
+	double total = 0.0;
+	for (uint32_t run = 0; run < runs; ++run)
+	{
+		Tests::Stopwatch stopwatch;
+		Core::BinaryReader reader(path.string());
+		Core::BinarySceneReader sceneReader;
+		Core::SceneReadResult result = sceneReader.Read(reader, uuids::uuid());
+		total += stopwatch.GetMilliseconds();
+
+		NB_CHECK_EQUAL(CountNodes(result.root.get()), nodeCount + 1);
+	}
+
+	Tests::ReportResult(name, total / runs, "ms");
+}
+
+NB_BENCHMARK(SceneLoad_Version2VersusVersion1)
+{
+	const std::filesystem::path directory = std::filesystem::temp_directory_path();
+	const std::filesystem::path version1Path = directory / "NightbirdSceneV1Benchmark.scene";
+	const std::filesystem::path version2Path = directory / "NightbirdSceneV2Benchmark.scene";
+
+	for (uint32_t nodeCount : { 10000u, 100000u })
+	{
+		std::unique_ptr<Core::SceneObject> root = BuildScene(nodeCount);
+		Tests::WriteVersion1Scene(root.get(), version1Path);
+
+		Editor::BinarySceneWriter writer;
+		writer.Write(root.get(), uuids::uuid(), version2Path, std::endian::native == std::endian::little ? Endianness::Little : Endianness::Big);
+
+		const std::string nodes = std::to_string(nodeCount / 1000) + "k nodes";
+		const uint32_t runs = nodeCount <= 10000 ? 10 : 3;
+
+		BenchmarkLoad("Version 1 load, " + nodes, version1Path, nodeCount, runs);
+		BenchmarkLoad("Version 2 load, " + nodes, version2Path, nodeCount, runs);
+
+		Tests::ReportResult("Version 1 size, " + nodes, std::filesystem::file_size(version1Path) / 1024.0, "KB");
+		Tests::ReportResult("Version 2 size, " + nodes, std::filesystem::file_size(version2Path) / 1024.0, "KB");
+	}
+
+	std::filesystem::remove(version1Path);
+	std::filesystem::remove(version2Path);
+}
@@ -0,0 +1,115 @@
+#include "Test.h"
+
+#include "Core/AudioSource.h"
+#include "Core/BinaryReader.h"
+#include "Core/BinarySceneReader.h"
+
+#include <cstring>
+#include <string>
+#include <vector>
+
+using namespace Nightbird;
+
+// Builds a version 1 scene by hand, in native byte order like the cooker writes for the host
+class Version1Scene
+{
+public:
+	explicit Version1Scene(uint32_t nodeCount)
+	{
+		Append("SCNE", 4);
+		Write<uint32_t>(1);
+		Write<uint32_t>(0);
+		Append(nullptr, 32);
+		Write<uint32_t>(nodeCount);
+	}
+
+	void BeginNode(uint8_t index, const std::string& typeName, uint16_t fieldCount)
+	{
+		uint8_t uuid[16] = { index };
+		Append(uuid, 16);
+		Append(nullptr, 16);
+		Write<uint8_t>(0);
+		Write<uint16_t>(static_cast<uint16_t>(typeName.size()));
+		Append(typeName.data(), typeName.size());
+		Write<uint16_t>(fieldCount);
+	}
+
+	template<typename T>
+	void WriteField(const char* name, T value)
+	{
+		Write<uint32_t>(FNVHash(name));
+		Write<uint16_t>(sizeof(T));
+		Write<T>(value);
+	}
+
+	void WriteNestedField(const char* name)
+	{
+		Write<uint32_t>(FNVHash(name));
+		Write<uint16_t>(0);
+	}
+
+	template<typename T>
+	void Write(T value)
+	{
+		Append(&value, sizeof(T));
+	}
+
+	Core::SceneReadResult Read()
+	{
+		Core::BinaryReader reader(m_Data);
+		Core::BinarySceneReader sceneReader;
+		return sceneReader.Read(reader, uuids::uuid());
+	}
+
+private:
+	std::vector<uint8_t> m_Data;
+
+	void Append(const void* data, size_t size)
+	{
+		size_t offset = m_Data.size();
+		m_Data.resize(offset + size);
+		if (data)
+			std::memcpy(m_Data.data() + offset, data, size);
+	}
+};
+
+NB_TEST(Version1Scene_ReadsStoredFieldCount)
+{
+	// Written before AudioSource had its spatial fields, with one field since removed
+	Version1Scene scene(2);
+	scene.BeginNode(1, "Nightbird::Core::AudioSource", 3);
+	scene.WriteField<uint8_t>("m_Loop", 1);
+	scene.WriteField<uint32_t>("m_Removed", 7);
+	scene.WriteField<float>("m_Volume", 0.5f);
+	scene.BeginNode(2, "Nightbird::Core::AudioSource", 1);
+	scene.WriteField<float>("m_Volume", 0.25f);
+
+	Core::SceneReadResult result = scene.Read();
+	NB_CHECK_EQUAL(result.root->GetChildren().size(), size_t(2));
+	if (result.root->GetChildren().size() != 2)
+		return;
+
+	const auto* first = Cast<Core::AudioSource>(result.root->GetChildren()[0].get());
+	const auto* second = Cast<Core::AudioSource>(result.root->GetChildren()[1].get());
+	NB_CHECK(first != nullptr && second != nullptr);
+	if (!first || !second)
+		return;
+
+	NB_CHECK(first->GetLoop());
+	NB_CHECK_EQUAL(first->GetVolume(), 0.5f);
+	NB_CHECK_EQUAL(first->GetMaxDistance(), 50.0f);
+	NB_CHECK(!second->GetLoop());
+	NB_CHECK_EQUAL(second->GetVolume(), 0.25f);
+}
+
+NB_TEST(Version1Scene_RejectsUnknownNestedField)
+{
+	// Nested fields carry no count or size, so nothing after this can be found again
+	Version1Scene scene(1);
+	scene.BeginNode(1, "Nightbird::Core::AudioSource", 2);
+	scene.WriteNestedField("m_Removed");
+	scene.WriteField<float>("m_Volume", 0.5f);
+
+	Core::SceneReadResult result = scene.Read();
+	NB_CHECK(result.root->GetChildren().empty());
+}
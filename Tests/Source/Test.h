@@ -0,0 +1,58 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <string>
+
+namespace Nightbird::Tests
+{
+	using TestFunction = void (*)();
+
+	// Called by the NB_TEST and NB_BENCHMARK macros during static initialization
+	bool RegisterTest(const char* name, TestFunction function);
+	bool RegisterBenchmark(const char* name, TestFunction function);
+
+	void ReportFailure(const char* file, int line, const std::string& message);
+	void ReportResult(const std::string& name, double value, const char* unit);
+	// For checks that couldn't run, e.g. because optional reference data isn't checked in
+	void ReportNote(const std::string& message);
+
+	// Checked in data under Tests/Data
+	std::filesystem::path GetDataPath(const std::filesystem::path& relativePath);
+
+	class Stopwatch
+	{
+	public:
+		Stopwatch() : m_Start(std::chrono::steady_clock::now()) {}
+
+		double GetMilliseconds() const
+		{
+			return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - m_Start).count();
+		}
+
+	private:
+		std::chrono::steady_clock::time_point m_Start;
+	};
+}
+
+#define NB_TEST(name) \
+	static void name(); \
+	static const bool name##_Registered = Nightbird::Tests::RegisterTest(#name, &name); \
+	static void name()
+
+#define NB_BENCHMARK(name) \
+	static void name(); \
+	static const bool name##_Registered = Nightbird::Tests::RegisterBenchmark(#name, &name); \
+	static void name()
+
+#define NB_CHECK(condition) \
+	do { if (!(condition)) Nightbird::Tests::ReportFailure(__FILE__, __LINE__, #condition); } while (0)
+
+#define NB_CHECK_EQUAL(actual, expected) \
+	do { \
+		const auto& nbActual = (actual); \
+		const auto& nbExpected = (expected); \
+		if (!(nbActual == nbExpected)) \
+			Nightbird::Tests::ReportFailure(__FILE__, __LINE__, std::string(#actual " == " #expected ", got ") + std::to_string(nbActual) + " expected " + std::to_string(nbExpected)); \
+	} while (0)
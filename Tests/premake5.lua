@@ -0,0 +1,40 @@
+project "Tests"
+	kind "ConsoleApp"
+	language "C++"
+	cppdialect "C++20"
+
+	removeconfigurations { "AppDebug", "AppRelease" }
+	removeplatforms { "WiiU", "3DS" }
+
+	local outBinDir = "%{wks.location}/Binaries/" .. outputdir
+
+	targetdir (outBinDir)
+	objdir ("%{wks.location}/Intermediate/" .. outputdir .. "/%{prj.name}")
+
+	-- Test data paths are relative to the workspace root
+	debugdir ("%{wks.location}")
+
+	files {
+		"Source/**.h",
+		"Source/**.cpp",
+
+		-- Editor code under test, the Editor itself is an application
+		"%{wks.location}/Editor/Source/Private/Cook/BinaryWriter.cpp",
+		"%{wks.location}/Editor/Source/Private/Cook/ByteSwap.cpp",
+		"%{wks.location}/Editor/Source/Private/Cook/DSPADPCMEncoder.cpp",
+		"%{wks.location}/Editor/Source/Private/Cook/T3XEncoder.cpp",
+		"%{wks.location}/Editor/Source/Private/Scene/BinarySceneWriter.cpp"
+	}
+
+	includedirs {
+		"Source",
+		"%{wks.location}/Engine/Source/Public",
+		"%{wks.location}/Editor/Source/Private",
+		"%{wks.location}/Engine/Vendor/glm",
+		"%{wks.location}/Engine/Vendor/stb",
+		"%{wks.location}/Engine/Vendor/stduuid"
+	}
+
+	defines { "NB_EDITOR_BUILD" }
+
+	links { "Engine" }
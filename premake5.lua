@@ -62,3 +62,7 @@ group "Nightbird/Editor/Backends/Libraries"
 	include "Editor/Backends/Libraries/EditorGlfwPlatform"
 	include "Editor/Backends/Libraries/EditorVulkanRenderer"
 group ""
+
+group "Nightbird/Tests"
+	include "Tests"
+group ""